@@ -0,0 +1,441 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+#ifndef QUICKY_UTILS_BIGNUM_ARRAY_H
+#define QUICKY_UTILS_BIGNUM_ARRAY_H
+
+#include "ext_uint.h"
+#include "limb_kernel.h"
+#include "bignum_workspace.h"
+#include "quicky_exception.h"
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <algorithm>
+
+namespace quicky_utils
+{
+    /**
+     * Container of unsigned numbers sharing the same number of limbs and
+     * stored in structure of arrays layout: limb l of all elements are
+     * contiguous. Element wise operations iterate on elements in their inner
+     * loop without any branch so that compiler can vectorize them across
+     * elements. Results are computed modulo 2 ^ (number of result limbs *
+     * limb size), missing operand limbs are considered as null
+     * @tparam T limb type
+     */
+    template <typename T>
+    class bignum_array
+    {
+      public:
+        /**
+         * Constructor of an array of null numbers
+         * @param p_size number of elements
+         * @param p_nb_limbs number of limbs of each element
+         */
+        bignum_array(size_t p_size
+                    ,size_t p_nb_limbs
+                    );
+
+        /**
+         * Number of elements
+         * @return number of elements
+         */
+        [[nodiscard]]
+        size_t get_size() const;
+
+        /**
+         * Number of limbs of each element
+         * @return number of limbs of each element
+         */
+        [[nodiscard]]
+        size_t get_nb_limbs() const;
+
+        /**
+         * Accessor to limb p_limb of all elements
+         * @param p_limb limb index
+         * @return pointer on limb of first element
+         */
+        T * get_limbs(size_t p_limb);
+
+        /**
+         * Accessor to limb p_limb of all elements
+         * @param p_limb limb index
+         * @return pointer on limb of first element
+         */
+        const T * get_limbs(size_t p_limb) const;
+
+        /**
+         * Store a number, exception is thrown if it does not fit
+         * @param p_index element index
+         * @param p_value value to store
+         */
+        void set(size_t p_index
+                ,const ext_uint<T> & p_value
+                );
+
+        /**
+         * Extract a number
+         * @param p_index element index
+         * @return stored value
+         */
+        [[nodiscard]]
+        ext_uint<T> get(size_t p_index) const;
+
+        /**
+         * Compute p_result = p_op1 + p_op2 element wise.
+         * p_result can be aliased with operands
+         */
+        static
+        void add(bignum_array & p_result
+                ,const bignum_array & p_op1
+                ,const bignum_array & p_op2
+                );
+
+        /**
+         * Compute p_result = p_op1 - p_op2 element wise.
+         * p_result can be aliased with operands
+         */
+        static
+        void sub(bignum_array & p_result
+                ,const bignum_array & p_op1
+                ,const bignum_array & p_op2
+                );
+
+        /**
+         * Compute p_result = p_op1 * p_op2 element wise. Result is exact if it
+         * has as many limbs as both operands. p_result must not be aliased
+         * with operands
+         */
+        static
+        void mul(bignum_array & p_result
+                ,const bignum_array & p_op1
+                ,const bignum_array & p_op2
+                );
+
+        /**
+         * Compare element wise
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @param p_result -1, 0 or 1 for each element if element of first
+         * operand is lower, equal or greater than element of second one
+         */
+        static
+        void compare(const bignum_array & p_op1
+                    ,const bignum_array & p_op2
+                    ,std::vector<int> & p_result
+                    );
+
+      private:
+        typedef typename limb_kernel<T>::double_type double_type;
+
+        /**
+         * Check that operands have same number of elements as result
+         * @param p_result result
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         */
+        static
+        void check_sizes(const bignum_array & p_result
+                        ,const bignum_array & p_op1
+                        ,const bignum_array & p_op2
+                        );
+
+        /**
+         * Limb of an operand or null limbs if operand is too short
+         * @param p_op operand
+         * @param p_limb limb index
+         * @param p_zero null limbs
+         * @return pointer on limb of first element
+         */
+        static
+        const T * get_operand_limbs(const bignum_array & p_op
+                                   ,size_t p_limb
+                                   ,const T * p_zero
+                                   );
+
+        size_t m_size;
+        size_t m_nb_limbs;
+
+        /**
+         * Limbs, limb l of element i is located at l * m_size + i
+         */
+        std::vector<T> m_limbs;
+
+        static_assert(std::is_unsigned<T>::value, "Limb type must be unsigned");
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bignum_array<T>::bignum_array(size_t p_size
+                                 ,size_t p_nb_limbs
+                                 ):
+    m_size(p_size),
+    m_nb_limbs(p_nb_limbs),
+    m_limbs(p_size * p_nb_limbs, 0)
+    {
+        if(!p_nb_limbs)
+        {
+            throw quicky_exception::quicky_logic_exception("bignum_array elements must have at least one limb", __LINE__, __FILE__);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    size_t
+    bignum_array<T>::get_size() const
+    {
+        return m_size;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    size_t
+    bignum_array<T>::get_nb_limbs() const
+    {
+        return m_nb_limbs;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    T *
+    bignum_array<T>::get_limbs(size_t p_limb)
+    {
+        assert(p_limb < m_nb_limbs);
+        return m_limbs.data() + p_limb * m_size;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    const T *
+    bignum_array<T>::get_limbs(size_t p_limb) const
+    {
+        assert(p_limb < m_nb_limbs);
+        return m_limbs.data() + p_limb * m_size;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    bignum_array<T>::set(size_t p_index
+                        ,const ext_uint<T> & p_value
+                        )
+    {
+        assert(p_index < m_size);
+        const std::vector<T> & l_ext = p_value.get_extension();
+        size_t l_size = limb_kernel<T>::significant_size(l_ext.data(), l_ext.size());
+        if(l_size > m_nb_limbs)
+        {
+            throw quicky_exception::quicky_logic_exception("Value needs " + std::to_string(l_size) + " limbs whereas bignum_array elements have " + std::to_string(m_nb_limbs), __LINE__, __FILE__);
+        }
+        for(size_t l_limb = 0; l_limb < m_nb_limbs; ++l_limb)
+        {
+            m_limbs[l_limb * m_size + p_index] = l_limb < l_size ? l_ext[l_limb] : 0;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    bignum_array<T>::get(size_t p_index) const
+    {
+        assert(p_index < m_size);
+        bignum_workspace<T> & l_workspace = bignum_workspace<T>::get();
+        typename bignum_workspace<T>::buffer l_limbs = l_workspace.acquire(m_nb_limbs);
+        for(size_t l_limb = 0; l_limb < m_nb_limbs; ++l_limb)
+        {
+            l_limbs.data()[l_limb] = m_limbs[l_limb * m_size + p_index];
+        }
+        return ext_uint<T>::from_limbs(l_limbs.data(), limb_kernel<T>::significant_size(l_limbs.data(), m_nb_limbs));
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    bignum_array<T>::check_sizes(const bignum_array & p_result
+                                ,const bignum_array & p_op1
+                                ,const bignum_array & p_op2
+                                )
+    {
+        if(p_op1.m_size != p_result.m_size || p_op2.m_size != p_result.m_size)
+        {
+            throw quicky_exception::quicky_logic_exception("bignum_array operands must have the same number of elements", __LINE__, __FILE__);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    const T *
+    bignum_array<T>::get_operand_limbs(const bignum_array & p_op
+                                      ,size_t p_limb
+                                      ,const T * p_zero
+                                      )
+    {
+        return p_limb < p_op.m_nb_limbs ? p_op.get_limbs(p_limb) : p_zero;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    bignum_array<T>::add(bignum_array & p_result
+                        ,const bignum_array & p_op1
+                        ,const bignum_array & p_op2
+                        )
+    {
+        check_sizes(p_result, p_op1, p_op2);
+        size_t l_size = p_result.m_size;
+        bignum_workspace<T> & l_workspace = bignum_workspace<T>::get();
+        typename bignum_workspace<T>::buffer l_zero_buffer = l_workspace.acquire(l_size);
+        typename bignum_workspace<T>::buffer l_carry_buffer = l_workspace.acquire(l_size);
+        T * l_zero = l_zero_buffer.data();
+        T * l_carry = l_carry_buffer.data();
+        std::fill(l_zero, l_zero + l_size, 0);
+        std::fill(l_carry, l_carry + l_size, 0);
+        for(size_t l_limb = 0; l_limb < p_result.m_nb_limbs; ++l_limb)
+        {
+            const T * l_op1 = get_operand_limbs(p_op1, l_limb, l_zero);
+            const T * l_op2 = get_operand_limbs(p_op2, l_limb, l_zero);
+            T * l_result = p_result.get_limbs(l_limb);
+            for(size_t l_index = 0; l_index < l_size; ++l_index)
+            {
+                T l_sum = (T)(l_op1[l_index] + l_carry[l_index]);
+                T l_new_carry = l_sum < l_carry[l_index];
+                T l_value = (T)(l_sum + l_op2[l_index]);
+                l_carry[l_index] = (T)(l_new_carry + (l_value < l_sum));
+                l_result[l_index] = l_value;
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    bignum_array<T>::sub(bignum_array & p_result
+                        ,const bignum_array & p_op1
+                        ,const bignum_array & p_op2
+                        )
+    {
+        check_sizes(p_result, p_op1, p_op2);
+        size_t l_size = p_result.m_size;
+        bignum_workspace<T> & l_workspace = bignum_workspace<T>::get();
+        typename bignum_workspace<T>::buffer l_zero_buffer = l_workspace.acquire(l_size);
+        typename bignum_workspace<T>::buffer l_borrow_buffer = l_workspace.acquire(l_size);
+        T * l_zero = l_zero_buffer.data();
+        T * l_borrow = l_borrow_buffer.data();
+        std::fill(l_zero, l_zero + l_size, 0);
+        std::fill(l_borrow, l_borrow + l_size, 0);
+        for(size_t l_limb = 0; l_limb < p_result.m_nb_limbs; ++l_limb)
+        {
+            const T * l_op1 = get_operand_limbs(p_op1, l_limb, l_zero);
+            const T * l_op2 = get_operand_limbs(p_op2, l_limb, l_zero);
+            T * l_result = p_result.get_limbs(l_limb);
+            for(size_t l_index = 0; l_index < l_size; ++l_index)
+            {
+                T l_diff = (T)(l_op1[l_index] - l_op2[l_index]);
+                T l_new_borrow = l_diff > l_op1[l_index];
+                T l_value = (T)(l_diff - l_borrow[l_index]);
+                l_borrow[l_index] = (T)(l_new_borrow + (l_value > l_diff));
+                l_result[l_index] = l_value;
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    bignum_array<T>::mul(bignum_array & p_result
+                        ,const bignum_array & p_op1
+                        ,const bignum_array & p_op2
+                        )
+    {
+        check_sizes(p_result, p_op1, p_op2);
+        if(&p_result == &p_op1 || &p_result == &p_op2)
+        {
+            throw quicky_exception::quicky_logic_exception("bignum_array multiplication result must not be an operand", __LINE__, __FILE__);
+        }
+        size_t l_size = p_result.m_size;
+        std::fill(p_result.m_limbs.begin(), p_result.m_limbs.end(), 0);
+        bignum_workspace<T> & l_workspace = bignum_workspace<T>::get();
+        typename bignum_workspace<T>::buffer l_carry_buffer = l_workspace.acquire(l_size);
+        T * l_carry = l_carry_buffer.data();
+        // Schoolbook multiplication where each limb product is applied to all
+        // elements before moving to next one
+        for(size_t l_limb1 = 0; l_limb1 < p_op1.m_nb_limbs && l_limb1 < p_result.m_nb_limbs; ++l_limb1)
+        {
+            const T * l_op1 = p_op1.get_limbs(l_limb1);
+            std::fill(l_carry, l_carry + l_size, 0);
+            size_t l_limb2 = 0;
+            for(; l_limb2 < p_op2.m_nb_limbs && l_limb1 + l_limb2 < p_result.m_nb_limbs; ++l_limb2)
+            {
+                const T * l_op2 = p_op2.get_limbs(l_limb2);
+                T * l_result = p_result.get_limbs(l_limb1 + l_limb2);
+                for(size_t l_index = 0; l_index < l_size; ++l_index)
+                {
+                    double_type l_product = (double_type)l_op1[l_index] * l_op2[l_index] + l_result[l_index] + l_carry[l_index];
+                    l_result[l_index] = (T)l_product;
+                    l_carry[l_index] = (T)(l_product >> limb_kernel<T>::m_nb_bits);
+                }
+            }
+            if(l_limb1 + l_limb2 < p_result.m_nb_limbs)
+            {
+                std::copy(l_carry, l_carry + l_size, p_result.get_limbs(l_limb1 + l_limb2));
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    bignum_array<T>::compare(const bignum_array & p_op1
+                            ,const bignum_array & p_op2
+                            ,std::vector<int> & p_result
+                            )
+    {
+        if(p_op1.m_size != p_op2.m_size)
+        {
+            throw quicky_exception::quicky_logic_exception("bignum_array operands must have the same number of elements", __LINE__, __FILE__);
+        }
+        size_t l_size = p_op1.m_size;
+        p_result.assign(l_size, 0);
+        bignum_workspace<T> & l_workspace = bignum_workspace<T>::get();
+        typename bignum_workspace<T>::buffer l_zero_buffer = l_workspace.acquire(l_size);
+        T * l_zero = l_zero_buffer.data();
+        std::fill(l_zero, l_zero + l_size, 0);
+        // From most significant limb, first difference decides
+        size_t l_limb = std::max(p_op1.m_nb_limbs, p_op2.m_nb_limbs);
+        while(l_limb)
+        {
+            --l_limb;
+            const T * l_op1 = get_operand_limbs(p_op1, l_limb, l_zero);
+            const T * l_op2 = get_operand_limbs(p_op2, l_limb, l_zero);
+            for(size_t l_index = 0; l_index < l_size; ++l_index)
+            {
+                int l_limb_result = (int)(l_op1[l_index] > l_op2[l_index]) - (int)(l_op1[l_index] < l_op2[l_index]);
+                p_result[l_index] = p_result[l_index] ? p_result[l_index] : l_limb_result;
+            }
+        }
+    }
+
+#ifdef QUICKY_UTILS_SELF_TEST
+    /**
+     * Method regrouping tests of bignum_array class
+     */
+    bool
+    test_bignum_array();
+#endif // QUICKY_UTILS_SELF_TEST
+}
+#endif //QUICKY_UTILS_BIGNUM_ARRAY_H
+// EOF
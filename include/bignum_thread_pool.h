@@ -0,0 +1,445 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+#ifndef QUICKY_UTILS_BIGNUM_THREAD_POOL_H
+#define QUICKY_UTILS_BIGNUM_THREAD_POOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <atomic>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace quicky_utils
+{
+    /**
+     * Pool of worker threads shared by big number operations.
+     * Work is described as independent tasks writing disjoint data so results
+     * do not depend on number of threads nor on scheduling. Only one parallel
+     * region is active at a time: a region requested while pool is busy, or
+     * from inside a task, is executed by calling thread alone.
+     * Default concurrency is 1 meaning that everything is sequential
+     */
+    class bignum_thread_pool
+    {
+      public:
+        /**
+         * Define maximum number of threads, calling thread included, used by
+         * a parallel region
+         * @param p_nb_threads maximum number of threads, 0 means number of
+         * hardware threads
+         */
+        inline static
+        void set_max_threads(unsigned int p_nb_threads);
+
+        /**
+         * Maximum number of threads used by a parallel region
+         * @return maximum number of threads, calling thread included
+         */
+        inline static
+        unsigned int get_max_threads();
+
+        /**
+         * Define minimal amount of work, expressed in limbs or elementary
+         * operations, that justifies a task of its own
+         * @param p_grain minimal number of items per task
+         */
+        inline static
+        void set_grain(size_t p_grain);
+
+        /**
+         * Minimal number of items per task
+         * @return minimal number of items per task
+         */
+        inline static
+        size_t get_grain();
+
+        /**
+         * Compute number of tasks to use to process items so that each task
+         * has at least grain items
+         * @param p_nb_items number of items
+         * @return number of tasks, 1 if work should stay sequential
+         */
+        inline static
+        size_t get_nb_tasks(size_t p_nb_items);
+
+        /**
+         * Execute p_function(p_begin, p_end) on ranges covering [0, p_nb_items[
+         * Ranges only depend on number of items and number of tasks
+         * @param p_nb_items number of items
+         * @param p_nb_tasks number of ranges
+         * @param p_function function called on each range
+         */
+        template <typename FUNCTION>
+        static
+        void parallel_for(size_t p_nb_items
+                         ,size_t p_nb_tasks
+                         ,const FUNCTION & p_function
+                         );
+
+        /**
+         * Execute p_function(p_begin, p_end) on ranges covering [0, p_nb_items[
+         * whose size is defined by get_nb_tasks
+         * @param p_nb_items number of items
+         * @param p_function function called on each range
+         */
+        template <typename FUNCTION>
+        static
+        void parallel_for(size_t p_nb_items
+                         ,const FUNCTION & p_function
+                         );
+
+        /**
+         * Execute two independent functions, potentially concurrently
+         * @param p_function1 first function
+         * @param p_function2 second function
+         */
+        template <typename FUNCTION1, typename FUNCTION2>
+        static
+        void parallel_invoke(const FUNCTION1 & p_function1
+                            ,const FUNCTION2 & p_function2
+                            );
+
+        bignum_thread_pool(const bignum_thread_pool &) = delete;
+        bignum_thread_pool & operator=(const bignum_thread_pool &) = delete;
+
+        inline
+        ~bignum_thread_pool();
+
+      private:
+        inline
+        bignum_thread_pool();
+
+        /**
+         * Unique pool instance, workers are created on demand
+         * @return pool
+         */
+        inline static
+        bignum_thread_pool & get();
+
+        /**
+         * Indicate if calling thread is currently executing a parallel region
+         * @return reference on thread local indicator
+         */
+        inline static
+        bool & is_in_region();
+
+        /**
+         * Execute tasks [0, p_nb_tasks[ using workers. First exception
+         * thrown by lowest task is rethrown once all tasks are completed
+         * @param p_nb_tasks number of tasks
+         * @param p_function function executing a task
+         */
+        inline
+        void run(size_t p_nb_tasks
+                ,const std::function<void(size_t)> & p_function
+                );
+
+        /**
+         * Execute remaining tasks of current region
+         */
+        inline
+        void execute_tasks();
+
+        /**
+         * Main loop of worker threads
+         * @param p_id worker index
+         */
+        inline
+        void worker_loop(size_t p_id);
+
+        /**
+         * Protect region description and worker synchronisation
+         */
+        std::mutex m_mutex;
+
+        /**
+         * Ensure that only one region is active
+         */
+        std::mutex m_region_mutex;
+
+        std::condition_variable m_start_condition;
+        std::condition_variable m_end_condition;
+        std::vector<std::thread> m_workers;
+
+        const std::function<void(size_t)> * m_function;
+        size_t m_nb_tasks;
+        std::atomic<size_t> m_next_task;
+
+        /**
+         * Number of workers taking part to current region
+         */
+        size_t m_nb_participants;
+        size_t m_nb_finished;
+        uint64_t m_generation;
+        bool m_stop;
+
+        std::exception_ptr m_exception;
+        size_t m_exception_task;
+
+        inline static std::atomic<unsigned int> m_max_threads{1};
+        inline static std::atomic<size_t> m_grain{4096};
+    };
+
+    //-------------------------------------------------------------------------
+    bignum_thread_pool::bignum_thread_pool()
+    :m_function(nullptr)
+    ,m_nb_tasks(0)
+    ,m_next_task(0)
+    ,m_nb_participants(0)
+    ,m_nb_finished(0)
+    ,m_generation(0)
+    ,m_stop(false)
+    ,m_exception_task(0)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    bignum_thread_pool::~bignum_thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> l_lock(m_mutex);
+            m_stop = true;
+        }
+        m_start_condition.notify_all();
+        for(auto & l_iter: m_workers)
+        {
+            l_iter.join();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    bignum_thread_pool &
+    bignum_thread_pool::get()
+    {
+        static bignum_thread_pool l_pool;
+        return l_pool;
+    }
+
+    //-------------------------------------------------------------------------
+    bool &
+    bignum_thread_pool::is_in_region()
+    {
+        static thread_local bool l_in_region = false;
+        return l_in_region;
+    }
+
+    //-------------------------------------------------------------------------
+    void
+    bignum_thread_pool::set_max_threads(unsigned int p_nb_threads)
+    {
+        m_max_threads = p_nb_threads ? p_nb_threads : std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    //-------------------------------------------------------------------------
+    unsigned int
+    bignum_thread_pool::get_max_threads()
+    {
+        return m_max_threads;
+    }
+
+    //-------------------------------------------------------------------------
+    void
+    bignum_thread_pool::set_grain(size_t p_grain)
+    {
+        m_grain = std::max(p_grain, (size_t)1);
+    }
+
+    //-------------------------------------------------------------------------
+    size_t
+    bignum_thread_pool::get_grain()
+    {
+        return m_grain;
+    }
+
+    //-------------------------------------------------------------------------
+    size_t
+    bignum_thread_pool::get_nb_tasks(size_t p_nb_items)
+    {
+        return std::max((size_t)1, std::min((size_t)m_max_threads, p_nb_items / m_grain));
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename FUNCTION>
+    void
+    bignum_thread_pool::parallel_for(size_t p_nb_items
+                                    ,size_t p_nb_tasks
+                                    ,const FUNCTION & p_function
+                                    )
+    {
+        p_nb_tasks = std::max((size_t)1, std::min(p_nb_tasks, p_nb_items));
+        auto l_range = [&](size_t p_task)
+        {
+            p_function(p_task * p_nb_items / p_nb_tasks, (p_task + 1) * p_nb_items / p_nb_tasks);
+        };
+        if(1 == p_nb_tasks)
+        {
+            p_function(0, p_nb_items);
+            return;
+        }
+        get().run(p_nb_tasks, l_range);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename FUNCTION>
+    void
+    bignum_thread_pool::parallel_for(size_t p_nb_items
+                                    ,const FUNCTION & p_function
+                                    )
+    {
+        parallel_for(p_nb_items, get_nb_tasks(p_nb_items), p_function);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename FUNCTION1, typename FUNCTION2>
+    void
+    bignum_thread_pool::parallel_invoke(const FUNCTION1 & p_function1
+                                       ,const FUNCTION2 & p_function2
+                                       )
+    {
+        if(m_max_threads < 2)
+        {
+            p_function1();
+            p_function2();
+            return;
+        }
+        get().run(2, [&](size_t p_task)
+                     {
+                         if(p_task)
+                         {
+                             p_function2();
+                         }
+                         else
+                         {
+                             p_function1();
+                         }
+                     }
+                 );
+    }
+
+    //-------------------------------------------------------------------------
+    void
+    bignum_thread_pool::run(size_t p_nb_tasks
+                           ,const std::function<void(size_t)> & p_function
+                           )
+    {
+        size_t l_nb_threads = std::min((size_t)m_max_threads, p_nb_tasks);
+        std::unique_lock<std::mutex> l_region_lock(m_region_mutex, std::defer_lock);
+        if(l_nb_threads < 2 || is_in_region() || !l_region_lock.try_lock())
+        {
+            for(size_t l_task = 0; l_task < p_nb_tasks; ++l_task)
+            {
+                p_function(l_task);
+            }
+            return;
+        }
+        is_in_region() = true;
+        {
+            std::lock_guard<std::mutex> l_lock(m_mutex);
+            while(m_workers.size() < l_nb_threads - 1)
+            {
+                m_workers.emplace_back(&bignum_thread_pool::worker_loop, this, m_workers.size());
+            }
+            m_function = &p_function;
+            m_nb_tasks = p_nb_tasks;
+            m_next_task = 0;
+            m_nb_participants = l_nb_threads - 1;
+            m_nb_finished = 0;
+            m_exception = nullptr;
+            m_exception_task = p_nb_tasks;
+            ++m_generation;
+        }
+        m_start_condition.notify_all();
+        execute_tasks();
+        std::exception_ptr l_exception;
+        {
+            std::unique_lock<std::mutex> l_lock(m_mutex);
+            m_end_condition.wait(l_lock, [&]{return m_nb_finished == m_nb_participants;});
+            m_function = nullptr;
+            l_exception = m_exception;
+        }
+        is_in_region() = false;
+        if(l_exception)
+        {
+            std::rethrow_exception(l_exception);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    void
+    bignum_thread_pool::execute_tasks()
+    {
+        for(size_t l_task = m_next_task++; l_task < m_nb_tasks; l_task = m_next_task++)
+        {
+            try
+            {
+                (*m_function)(l_task);
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> l_lock(m_mutex);
+                if(l_task < m_exception_task)
+                {
+                    m_exception_task = l_task;
+                    m_exception = std::current_exception();
+                }
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    void
+    bignum_thread_pool::worker_loop(size_t p_id)
+    {
+        is_in_region() = true;
+        uint64_t l_generation = 0;
+        std::unique_lock<std::mutex> l_lock(m_mutex);
+        while(true)
+        {
+            m_start_condition.wait(l_lock, [&]{return m_stop || m_generation != l_generation;});
+            if(m_stop)
+            {
+                return;
+            }
+            l_generation = m_generation;
+            if(p_id >= m_nb_participants)
+            {
+                continue;
+            }
+            l_lock.unlock();
+            execute_tasks();
+            l_lock.lock();
+            ++m_nb_finished;
+            m_end_condition.notify_one();
+        }
+    }
+
+#ifdef QUICKY_UTILS_SELF_TEST
+    /**
+     * Method regrouping tests of bignum_thread_pool class and of parallel
+     * big number operations
+     */
+    bool
+    test_bignum_thread_pool();
+#endif // QUICKY_UTILS_SELF_TEST
+}
+#endif //QUICKY_UTILS_BIGNUM_THREAD_POOL_H
+// EOF
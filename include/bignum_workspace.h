@@ -0,0 +1,258 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+#ifndef QUICKY_UTILS_BIGNUM_WORKSPACE_H
+#define QUICKY_UTILS_BIGNUM_WORKSPACE_H
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <cstddef>
+#include <cassert>
+
+namespace quicky_utils
+{
+    /**
+     * Thread local arena providing scratch limb buffers to extensible
+     * integer operators. Buffers are released in reverse order of
+     * acquisition so once arena has reached its working size, temporaries
+     * no longer cause any heap allocation
+     * @tparam T limb type
+     */
+    template <typename T>
+    class bignum_workspace
+    {
+      public:
+        /**
+         * Scratch buffer leased from workspace and given back when destroyed
+         */
+        class buffer
+        {
+          public:
+            buffer(const buffer &) = delete;
+            buffer & operator=(const buffer &) = delete;
+
+            ~buffer();
+
+            /**
+             * Accessor to buffer limbs. Content is not initialised
+             * @return pointer on first limb
+             */
+            T * data() const;
+
+            /**
+             * Number of limbs of buffer
+             * @return number of limbs
+             */
+            [[nodiscard]]
+            size_t size() const;
+
+          private:
+            friend class bignum_workspace;
+
+            buffer(bignum_workspace & p_workspace
+                  ,size_t p_size
+                  );
+
+            bignum_workspace & m_workspace;
+            size_t m_previous_block;
+            size_t m_previous_offset;
+            T * m_data;
+            size_t m_size;
+        };
+
+        /**
+         * Workspace of calling thread
+         * @return workspace of calling thread
+         */
+        static
+        bignum_workspace & get();
+
+        /**
+         * Lease a buffer. Buffers must be destroyed in reverse order of
+         * acquisition which is naturally the case for local variables
+         * @param p_size number of limbs
+         * @return leased buffer
+         */
+        buffer acquire(size_t p_size);
+
+        /**
+         * Number of heap allocations done by workspace since its creation
+         * @return number of allocated blocks
+         */
+        [[nodiscard]]
+        size_t get_nb_allocations() const;
+
+        /**
+         * Indicate if some buffers are currently leased
+         * @return true if no buffer is leased
+         */
+        [[nodiscard]]
+        bool is_idle() const;
+
+        bignum_workspace(const bignum_workspace &) = delete;
+        bignum_workspace & operator=(const bignum_workspace &) = delete;
+
+      private:
+        bignum_workspace();
+
+        /**
+         * Minimal number of limbs of a block
+         */
+        static constexpr size_t m_min_block_size = 1024;
+
+        std::vector<std::unique_ptr<T[]>> m_blocks;
+        std::vector<size_t> m_block_sizes;
+
+        /**
+         * Block from which next buffer will be leased
+         */
+        size_t m_block;
+
+        /**
+         * Number of leased limbs in current block
+         */
+        size_t m_offset;
+
+        size_t m_nb_allocations;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bignum_workspace<T>::bignum_workspace():
+    m_block(0),
+    m_offset(0),
+    m_nb_allocations(0)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bignum_workspace<T> &
+    bignum_workspace<T>::get()
+    {
+        static thread_local bignum_workspace<T> l_workspace;
+        return l_workspace;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename bignum_workspace<T>::buffer
+    bignum_workspace<T>::acquire(size_t p_size)
+    {
+        return buffer(*this, p_size);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    size_t
+    bignum_workspace<T>::get_nb_allocations() const
+    {
+        return m_nb_allocations;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    bignum_workspace<T>::is_idle() const
+    {
+        return !m_block && !m_offset;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bignum_workspace<T>::buffer::buffer(bignum_workspace & p_workspace
+                                       ,size_t p_size
+                                       ):
+    m_workspace(p_workspace),
+    m_previous_block(p_workspace.m_block),
+    m_previous_offset(p_workspace.m_offset),
+    m_data(nullptr),
+    m_size(p_size)
+    {
+        bignum_workspace & l_ws = m_workspace;
+        if(l_ws.m_block >= l_ws.m_blocks.size() || l_ws.m_offset + p_size > l_ws.m_block_sizes[l_ws.m_block])
+        {
+            // Current block is too small: switch to next one
+            if(l_ws.m_block < l_ws.m_blocks.size() && l_ws.m_offset)
+            {
+                ++l_ws.m_block;
+                l_ws.m_offset = 0;
+            }
+            if(l_ws.m_block >= l_ws.m_blocks.size() || l_ws.m_block_sizes[l_ws.m_block] < p_size)
+            {
+                // Blocks located after current one are not used so they can be replaced
+                size_t l_block_size = std::max(p_size, l_ws.m_block_sizes.empty() ? m_min_block_size : 2 * l_ws.m_block_sizes.back());
+                if(l_ws.m_block >= l_ws.m_blocks.size())
+                {
+                    l_ws.m_blocks.emplace_back(new T[l_block_size]);
+                    l_ws.m_block_sizes.push_back(l_block_size);
+                }
+                else
+                {
+                    l_ws.m_blocks[l_ws.m_block].reset(new T[l_block_size]);
+                    l_ws.m_block_sizes[l_ws.m_block] = l_block_size;
+                }
+                ++l_ws.m_nb_allocations;
+            }
+        }
+        m_data = l_ws.m_blocks[l_ws.m_block].get() + l_ws.m_offset;
+        l_ws.m_offset += p_size;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bignum_workspace<T>::buffer::~buffer()
+    {
+        assert(m_workspace.m_offset >= m_size && m_data == m_workspace.m_blocks[m_workspace.m_block].get() + m_workspace.m_offset - m_size);
+        m_workspace.m_block = m_previous_block;
+        m_workspace.m_offset = m_previous_offset;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    T *
+    bignum_workspace<T>::buffer::data() const
+    {
+        return m_data;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    size_t
+    bignum_workspace<T>::buffer::size() const
+    {
+        return m_size;
+    }
+
+#ifdef QUICKY_UTILS_SELF_TEST
+    /**
+     * Method regrouping tests of bignum_workspace class and of operators
+     * relying on it
+     */
+    bool
+    test_bignum_workspace();
+
+    /**
+     * Number of calls to global operator new since program start, used by
+     * benchmarks to report heap allocations per operation
+     */
+    size_t
+    get_nb_heap_allocations();
+#endif // QUICKY_UTILS_SELF_TEST
+}
+#endif //QUICKY_UTILS_BIGNUM_WORKSPACE_H
+// EOF
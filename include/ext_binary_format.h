@@ -0,0 +1,1015 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+#ifndef QUICKY_UTILS_EXT_BINARY_FORMAT_H
+#define QUICKY_UTILS_EXT_BINARY_FORMAT_H
+
+#include "ext_uint.h"
+#include "ext_int.h"
+#include "limb_kernel.h"
+#include "quicky_exception.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <limits>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace quicky_utils
+{
+    /**
+     * Binary format of a sequence of extensible integers whose limbs can be
+     * used in place once stored data is mapped in memory.
+     * Data begins with a 16 bytes header: magic "QKBIGNUM", format version,
+     * limb size in bytes and 6 null bytes. Each number is then stored as:
+     * - LEB128 varint equal to 2 * number of limbs, plus 1 if negative
+     * - null bytes up to next offset multiple of limb size
+     * - magnitude limbs, least significant first, each in little endian
+     * Null number has no limb and upper limb of others is not null.
+     * Limbs are aligned as soon as data is aligned on limb size
+     * @tparam T limb type
+     */
+    template <typename T>
+    class ext_binary_format
+    {
+      public:
+        static_assert(std::is_unsigned<T>::value, "Limb type must be unsigned");
+
+        static constexpr size_t m_header_size = 16;
+        static constexpr uint8_t m_version = 1;
+        static constexpr size_t m_max_varint_size = 10;
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        static constexpr bool m_little_endian_host = false;
+#else
+        static constexpr bool m_little_endian_host = true;
+#endif
+
+        /**
+         * Fill header of data
+         * @param p_header header to fill
+         */
+        static
+        void make_header(uint8_t * p_header);
+
+        /**
+         * Check that header of data is valid for limb type
+         * @param p_header header to check, m_header_size bytes
+         */
+        static
+        void check_header(const uint8_t * p_header);
+
+        /**
+         * Number of null bytes to insert before limbs
+         * @param p_offset offset following varint
+         * @return number of bytes to reach next multiple of limb size
+         */
+        static
+        size_t get_padding(uint64_t p_offset);
+
+        /**
+         * Encode a varint
+         * @param p_value value to encode
+         * @param p_buffer destination of at least m_max_varint_size bytes
+         * @return number of bytes written
+         */
+        static
+        size_t encode_varint(uint64_t p_value
+                            ,uint8_t * p_buffer
+                            );
+
+        /**
+         * Accumulate a byte of a varint being decoded. Non canonical
+         * encodings are rejected: null last byte of a multi byte varint,
+         * bits above 64 in tenth byte or more than m_max_varint_size bytes
+         * @param p_value varint being decoded
+         * @param p_index index of byte in varint
+         * @param p_byte byte to accumulate
+         * @return true if other bytes follow
+         */
+        static
+        bool decode_varint_byte(uint64_t & p_value
+                               ,unsigned int p_index
+                               ,uint8_t p_byte
+                               );
+
+        /**
+         * Convert limb between host and little endian byte order
+         * @param p_limb limb to convert
+         * @return converted limb
+         */
+        static
+        T swap_to_little_endian(T p_limb);
+    };
+
+    /**
+     * Write extensible integers in binary format to a stream
+     * @tparam T limb type
+     */
+    template <typename T>
+    class ext_binary_writer
+    {
+      public:
+        typedef ext_int<typename std::make_signed<T>::type> signed_type;
+
+        /**
+         * Constructor writing header
+         * @param p_stream binary stream receiving data
+         */
+        explicit
+        ext_binary_writer(std::ostream & p_stream);
+
+        /**
+         * Append a number
+         * @param p_value number to write
+         */
+        void write(const ext_uint<T> & p_value);
+
+        /**
+         * Append a signed number
+         * @param p_value number to write
+         */
+        void write(const signed_type & p_value);
+
+        /**
+         * Number of numbers written
+         * @return number of numbers
+         */
+        [[nodiscard]]
+        uint64_t get_nb_values() const;
+
+        /**
+         * Number of bytes written, header included
+         * @return number of bytes
+         */
+        [[nodiscard]]
+        uint64_t get_size() const;
+
+      private:
+        /**
+         * Write a number given by its magnitude and its sign
+         * @param p_limbs magnitude limbs
+         * @param p_nb_limbs number of limbs, upper one being non null
+         * @param p_negative true if number is negative
+         */
+        void write_record(const T * p_limbs
+                         ,size_t p_nb_limbs
+                         ,bool p_negative
+                         );
+
+        void write_bytes(const void * p_data
+                        ,size_t p_size
+                        );
+
+        std::ostream & m_stream;
+        uint64_t m_offset;
+        uint64_t m_nb_values;
+    };
+
+    /**
+     * Read extensible integers in binary format from a stream, limbs being
+     * copied in read numbers
+     * @tparam T limb type
+     */
+    template <typename T>
+    class ext_binary_reader
+    {
+      public:
+        typedef ext_int<typename std::make_signed<T>::type> signed_type;
+
+        /**
+         * Constructor reading and checking header
+         * @param p_stream binary stream providing data
+         */
+        explicit
+        ext_binary_reader(std::istream & p_stream);
+
+        /**
+         * Read next number
+         * @param p_value read number
+         * @return false if end of stream is reached
+         */
+        bool read(ext_uint<T> & p_value);
+
+        /**
+         * Read next signed number
+         * @param p_value read number
+         * @return false if end of stream is reached
+         */
+        bool read(signed_type & p_value);
+
+      private:
+        /**
+         * Read next number
+         * @param p_limbs magnitude limbs
+         * @param p_negative true if number is negative
+         * @return false if end of stream is reached
+         */
+        bool read_record(std::vector<T> & p_limbs
+                        ,bool & p_negative
+                        );
+
+        void read_bytes(void * p_data
+                       ,size_t p_size
+                       );
+
+        /**
+         * Maximum number of limbs read at once so that memory allocated for
+         * a number never exceeds much the size of data actually read
+         */
+        static constexpr size_t m_max_nb_chunk_limbs = 4096;
+
+        std::istream & m_stream;
+        uint64_t m_offset;
+    };
+
+    /**
+     * Read only view on magnitude limbs stored elsewhere
+     * @tparam T limb type
+     */
+    template <typename T>
+    class ext_uint_view
+    {
+      public:
+        /**
+         * Constructor of a view on null number
+         */
+        ext_uint_view();
+
+        /**
+         * Constructor
+         * @param p_limbs limbs, least significant first
+         * @param p_nb_limbs number of limbs, upper one being non null
+         */
+        ext_uint_view(const T * p_limbs
+                     ,size_t p_nb_limbs
+                     );
+
+        /**
+         * Limbs of number
+         * @return pointer on least significant limb
+         */
+        [[nodiscard]]
+        const T * data() const;
+
+        /**
+         * Number of limbs, 0 for null number
+         * @return number of limbs
+         */
+        [[nodiscard]]
+        size_t get_nb_words() const;
+
+        /**
+         * Return limb located at p_index
+         * @param p_index index of limb
+         * @return limb
+         */
+        [[nodiscard]]
+        const T & get_word(size_t p_index) const;
+
+        /**
+         * Copy limbs into an ext_uint
+         * @return number
+         */
+        [[nodiscard]]
+        ext_uint<T> to_ext_uint() const;
+
+        /**
+         * Three-way comparison
+         * @return -1, 0 or 1 if this is lower, equal or greater than p_op
+         */
+        [[nodiscard]]
+        int compare(const ext_uint_view & p_op) const;
+
+        /**
+         * Three-way comparison
+         * @return -1, 0 or 1 if this is lower, equal or greater than p_op
+         */
+        [[nodiscard]]
+        int compare(const ext_uint<T> & p_op) const;
+
+        bool operator==(const ext_uint<T> & p_op) const;
+
+        bool operator!=(const ext_uint<T> & p_op) const;
+
+      private:
+        const T * m_limbs;
+        size_t m_nb_limbs;
+    };
+
+    /**
+     * Access to numbers stored in binary format in a memory region, for
+     * example a mapped file. Construction only checks header so its cost does
+     * not depend on data size. Numbers are decoded while iterating and their
+     * magnitude is provided as views on region limbs, nothing is copied.
+     * Region must be aligned on limb size and host must be little endian
+     * @tparam T limb type
+     */
+    template <typename T>
+    class ext_binary_view
+    {
+      public:
+        typedef ext_int<typename std::make_signed<T>::type> signed_type;
+
+        /**
+         * Forward iterator on stored numbers. Dereferencing provides number
+         * magnitude, sign is provided by is_negative
+         */
+        class const_iterator
+        {
+          public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef ext_uint_view<T> value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const ext_uint_view<T> * pointer;
+            typedef const ext_uint_view<T> & reference;
+
+            const_iterator();
+
+            reference operator*() const;
+
+            pointer operator->() const;
+
+            const_iterator & operator++();
+
+            const_iterator operator++(int);
+
+            bool operator==(const const_iterator & p_op) const;
+
+            bool operator!=(const const_iterator & p_op) const;
+
+            /**
+             * Sign of current number
+             * @return true if current number is negative
+             */
+            [[nodiscard]]
+            bool is_negative() const;
+
+            /**
+             * Copy current number
+             * @return current number
+             */
+            [[nodiscard]]
+            ext_uint<T> to_ext_uint() const;
+
+            /**
+             * Copy current number
+             * @return current number
+             */
+            [[nodiscard]]
+            signed_type to_ext_int() const;
+
+          private:
+            friend class ext_binary_view<T>;
+
+            const_iterator(const uint8_t * p_begin
+                          ,const uint8_t * p_position
+                          ,const uint8_t * p_end
+                          );
+
+            /**
+             * Decode number located at m_position
+             */
+            void decode();
+
+            const uint8_t * m_begin;
+            const uint8_t * m_position;
+            const uint8_t * m_next;
+            const uint8_t * m_end;
+            ext_uint_view<T> m_magnitude;
+            bool m_negative;
+        };
+
+        /**
+         * Constructor
+         * @param p_data beginning of region, aligned on limb size
+         * @param p_size size of region in bytes
+         */
+        ext_binary_view(const void * p_data
+                       ,size_t p_size
+                       );
+
+        [[nodiscard]]
+        const_iterator begin() const;
+
+        [[nodiscard]]
+        const_iterator end() const;
+
+      private:
+        const uint8_t * m_data;
+        size_t m_size;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    ext_binary_format<T>::make_header(uint8_t * p_header)
+    {
+        std::memset(p_header, 0, m_header_size);
+        std::memcpy(p_header, "QKBIGNUM", 8);
+        p_header[8] = m_version;
+        p_header[9] = (uint8_t)sizeof(T);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    ext_binary_format<T>::check_header(const uint8_t * p_header)
+    {
+        if(std::memcmp(p_header, "QKBIGNUM", 8))
+        {
+            throw quicky_exception::quicky_runtime_exception("Invalid binary format magic", __LINE__, __FILE__);
+        }
+        if(m_version != p_header[8])
+        {
+            throw quicky_exception::quicky_runtime_exception("Unsupported binary format version " + std::to_string(p_header[8]), __LINE__, __FILE__);
+        }
+        if(sizeof(T) != p_header[9])
+        {
+            throw quicky_exception::quicky_runtime_exception("Binary format limb size " + std::to_string(p_header[9]) + " differs from " + std::to_string(sizeof(T)), __LINE__, __FILE__);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    size_t
+    ext_binary_format<T>::get_padding(uint64_t p_offset)
+    {
+        return (size_t)((sizeof(T) - p_offset % sizeof(T)) % sizeof(T));
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    size_t
+    ext_binary_format<T>::encode_varint(uint64_t p_value
+                                       ,uint8_t * p_buffer
+                                       )
+    {
+        size_t l_size = 0;
+        while(p_value >= 0x80)
+        {
+            p_buffer[l_size++] = (uint8_t)(p_value | 0x80);
+            p_value >>= 7;
+        }
+        p_buffer[l_size++] = (uint8_t)p_value;
+        return l_size;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    ext_binary_format<T>::decode_varint_byte(uint64_t & p_value
+                                            ,unsigned int p_index
+                                            ,uint8_t p_byte
+                                            )
+    {
+        // Last possible byte only holds bit 63 of value
+        if(p_index + 1 >= m_max_varint_size && p_byte > 1)
+        {
+            throw quicky_exception::quicky_runtime_exception("Invalid varint in binary format", __LINE__, __FILE__);
+        }
+        p_value |= ((uint64_t)(p_byte & 0x7F)) << (7 * p_index);
+        if(p_byte & 0x80)
+        {
+            return true;
+        }
+        if(p_index && !p_byte)
+        {
+            throw quicky_exception::quicky_runtime_exception("Non canonical varint in binary format", __LINE__, __FILE__);
+        }
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    T
+    ext_binary_format<T>::swap_to_little_endian(T p_limb)
+    {
+        if(m_little_endian_host)
+        {
+            return p_limb;
+        }
+        T l_result = 0;
+        for(size_t l_index = 0; l_index < sizeof(T); ++l_index)
+        {
+            l_result = (T)((l_result << 8) | (p_limb & 0xFF));
+            p_limb = (T)(p_limb >> 8);
+        }
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_binary_writer<T>::ext_binary_writer(std::ostream & p_stream)
+    :m_stream(p_stream)
+    ,m_offset(0)
+    ,m_nb_values(0)
+    {
+        uint8_t l_header[ext_binary_format<T>::m_header_size];
+        ext_binary_format<T>::make_header(l_header);
+        write_bytes(l_header, sizeof(l_header));
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    ext_binary_writer<T>::write(const ext_uint<T> & p_value)
+    {
+        const std::vector<T> & l_ext = p_value.get_extension();
+        write_record(l_ext.data(), l_ext.back() ? l_ext.size() : 0, false);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    ext_binary_writer<T>::write(const signed_type & p_value)
+    {
+        bool l_negative = p_value.get_root() < 0;
+        ext_uint<T> l_magnitude(l_negative ? -p_value : p_value);
+        const std::vector<T> & l_ext = l_magnitude.get_extension();
+        write_record(l_ext.data(), l_ext.back() ? l_ext.size() : 0, l_negative);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    uint64_t
+    ext_binary_writer<T>::get_nb_values() const
+    {
+        return m_nb_values;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    uint64_t
+    ext_binary_writer<T>::get_size() const
+    {
+        return m_offset;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    ext_binary_writer<T>::write_record(const T * p_limbs
+                                      ,size_t p_nb_limbs
+                                      ,bool p_negative
+                                      )
+    {
+        uint8_t l_buffer[ext_binary_format<T>::m_max_varint_size + sizeof(T)];
+        size_t l_size = ext_binary_format<T>::encode_varint(2 * (uint64_t)p_nb_limbs + p_negative, l_buffer);
+        size_t l_padding = ext_binary_format<T>::get_padding(m_offset + l_size);
+        std::memset(l_buffer + l_size, 0, l_padding);
+        write_bytes(l_buffer, l_size + l_padding);
+        if(ext_binary_format<T>::m_little_endian_host)
+        {
+            write_bytes(p_limbs, p_nb_limbs * sizeof(T));
+        }
+        else
+        {
+            for(size_t l_index = 0; l_index < p_nb_limbs; ++l_index)
+            {
+                T l_limb = ext_binary_format<T>::swap_to_little_endian(p_limbs[l_index]);
+                write_bytes(&l_limb, sizeof(T));
+            }
+        }
+        ++m_nb_values;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    ext_binary_writer<T>::write_bytes(const void * p_data
+                                     ,size_t p_size
+                                     )
+    {
+        m_stream.write(static_cast<const char *>(p_data), (std::streamsize)p_size);
+        if(!m_stream)
+        {
+            throw quicky_exception::quicky_runtime_exception("Unable to write binary format", __LINE__, __FILE__);
+        }
+        m_offset += p_size;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_binary_reader<T>::ext_binary_reader(std::istream & p_stream)
+    :m_stream(p_stream)
+    ,m_offset(0)
+    {
+        uint8_t l_header[ext_binary_format<T>::m_header_size];
+        read_bytes(l_header, sizeof(l_header));
+        ext_binary_format<T>::check_header(l_header);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    ext_binary_reader<T>::read(ext_uint<T> & p_value)
+    {
+        std::vector<T> l_limbs;
+        bool l_negative;
+        if(!read_record(l_limbs, l_negative))
+        {
+            return false;
+        }
+        if(l_negative)
+        {
+            throw quicky_exception::quicky_runtime_exception("Negative number read as ext_uint", __LINE__, __FILE__);
+        }
+        p_value = ext_uint<T>::from_limbs(l_limbs.data(), l_limbs.size());
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    ext_binary_reader<T>::read(signed_type & p_value)
+    {
+        std::vector<T> l_limbs;
+        bool l_negative;
+        if(!read_record(l_limbs, l_negative))
+        {
+            return false;
+        }
+        p_value = signed_type(ext_uint<T>::from_limbs(l_limbs.data(), l_limbs.size()));
+        if(l_negative)
+        {
+            p_value = -p_value;
+        }
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    ext_binary_reader<T>::read_record(std::vector<T> & p_limbs
+                                     ,bool & p_negative
+                                     )
+    {
+        if(std::char_traits<char>::eq_int_type(m_stream.peek(), std::char_traits<char>::eof()))
+        {
+            return false;
+        }
+        uint64_t l_varint = 0;
+        bool l_continue = true;
+        for(unsigned int l_index = 0; l_continue; ++l_index)
+        {
+            uint8_t l_byte;
+            read_bytes(&l_byte, 1);
+            l_continue = ext_binary_format<T>::decode_varint_byte(l_varint, l_index, l_byte);
+        }
+        uint8_t l_padding[sizeof(T)];
+        size_t l_padding_size = ext_binary_format<T>::get_padding(m_offset);
+        read_bytes(l_padding, l_padding_size);
+        for(size_t l_index = 0; l_index < l_padding_size; ++l_index)
+        {
+            if(l_padding[l_index])
+            {
+                throw quicky_exception::quicky_runtime_exception("Non canonical padding in binary format", __LINE__, __FILE__);
+            }
+        }
+        p_negative = l_varint & 1;
+        uint64_t l_nb_limbs = l_varint >> 1;
+        if(l_nb_limbs > std::numeric_limits<size_t>::max() / sizeof(T))
+        {
+            throw quicky_exception::quicky_runtime_exception("Invalid limb count " + std::to_string(l_nb_limbs) + " in binary format", __LINE__, __FILE__);
+        }
+        // Count comes from data so limbs are read by chunks, a corrupted
+        // count making read fail before allocating much memory
+        p_limbs.clear();
+        while(p_limbs.size() < l_nb_limbs)
+        {
+            size_t l_size = p_limbs.size();
+            size_t l_nb_chunk_limbs = (size_t)std::min<uint64_t>(l_nb_limbs - l_size, m_max_nb_chunk_limbs);
+            p_limbs.resize(l_size + l_nb_chunk_limbs);
+            read_bytes(p_limbs.data() + l_size, l_nb_chunk_limbs * sizeof(T));
+        }
+        for(auto & l_iter: p_limbs)
+        {
+            l_iter = ext_binary_format<T>::swap_to_little_endian(l_iter);
+        }
+        if((p_limbs.size() && !p_limbs.back()) || (p_negative && p_limbs.empty()))
+        {
+            throw quicky_exception::quicky_runtime_exception("Non canonical number in binary format", __LINE__, __FILE__);
+        }
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    ext_binary_reader<T>::read_bytes(void * p_data
+                                    ,size_t p_size
+                                    )
+    {
+        m_stream.read(static_cast<char *>(p_data), (std::streamsize)p_size);
+        if(!m_stream)
+        {
+            throw quicky_exception::quicky_runtime_exception("Truncated binary format", __LINE__, __FILE__);
+        }
+        m_offset += p_size;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint_view<T>::ext_uint_view()
+    :m_limbs(nullptr)
+    ,m_nb_limbs(0)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint_view<T>::ext_uint_view(const T * p_limbs
+                                   ,size_t p_nb_limbs
+                                   )
+    :m_limbs(p_limbs)
+    ,m_nb_limbs(p_nb_limbs)
+    {
+        assert(!p_nb_limbs || p_limbs[p_nb_limbs - 1]);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    const T *
+    ext_uint_view<T>::data() const
+    {
+        return m_limbs;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    size_t
+    ext_uint_view<T>::get_nb_words() const
+    {
+        return m_nb_limbs;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    const T &
+    ext_uint_view<T>::get_word(size_t p_index) const
+    {
+        assert(p_index < m_nb_limbs);
+        return m_limbs[p_index];
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    ext_uint_view<T>::to_ext_uint() const
+    {
+        return ext_uint<T>::from_limbs(m_limbs, m_nb_limbs);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    int
+    ext_uint_view<T>::compare(const ext_uint_view & p_op) const
+    {
+        return limb_kernel<T>::compare(m_limbs, m_nb_limbs, p_op.m_limbs, p_op.m_nb_limbs);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    int
+    ext_uint_view<T>::compare(const ext_uint<T> & p_op) const
+    {
+        const std::vector<T> & l_ext = p_op.get_extension();
+        return limb_kernel<T>::compare(m_limbs, m_nb_limbs, l_ext.data(), l_ext.back() ? l_ext.size() : 0);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    ext_uint_view<T>::operator==(const ext_uint<T> & p_op) const
+    {
+        return !compare(p_op);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    ext_uint_view<T>::operator!=(const ext_uint<T> & p_op) const
+    {
+        return compare(p_op);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_binary_view<T>::ext_binary_view(const void * p_data
+                                       ,size_t p_size
+                                       )
+    :m_data(static_cast<const uint8_t *>(p_data))
+    ,m_size(p_size)
+    {
+        if(!ext_binary_format<T>::m_little_endian_host)
+        {
+            throw quicky_exception::quicky_runtime_exception("Binary format view requires a little endian host", __LINE__, __FILE__);
+        }
+        if(reinterpret_cast<uintptr_t>(p_data) % alignof(T))
+        {
+            throw quicky_exception::quicky_runtime_exception("Binary format region is not aligned on limb size", __LINE__, __FILE__);
+        }
+        if(p_size < ext_binary_format<T>::m_header_size)
+        {
+            throw quicky_exception::quicky_runtime_exception("Truncated binary format header", __LINE__, __FILE__);
+        }
+        ext_binary_format<T>::check_header(m_data);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename ext_binary_view<T>::const_iterator
+    ext_binary_view<T>::begin() const
+    {
+        return const_iterator(m_data, m_data + ext_binary_format<T>::m_header_size, m_data + m_size);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename ext_binary_view<T>::const_iterator
+    ext_binary_view<T>::end() const
+    {
+        return const_iterator(m_data, m_data + m_size, m_data + m_size);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_binary_view<T>::const_iterator::const_iterator()
+    :m_begin(nullptr)
+    ,m_position(nullptr)
+    ,m_next(nullptr)
+    ,m_end(nullptr)
+    ,m_negative(false)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_binary_view<T>::const_iterator::const_iterator(const uint8_t * p_begin
+                                                      ,const uint8_t * p_position
+                                                      ,const uint8_t * p_end
+                                                      )
+    :m_begin(p_begin)
+    ,m_position(p_position)
+    ,m_next(p_position)
+    ,m_end(p_end)
+    ,m_negative(false)
+    {
+        decode();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    ext_binary_view<T>::const_iterator::decode()
+    {
+        m_magnitude = ext_uint_view<T>();
+        m_negative = false;
+        if(m_position == m_end)
+        {
+            return;
+        }
+        const uint8_t * l_position = m_position;
+        uint64_t l_varint = 0;
+        bool l_continue = true;
+        for(unsigned int l_index = 0; l_continue; ++l_index)
+        {
+            if(l_position == m_end)
+            {
+                throw quicky_exception::quicky_runtime_exception("Invalid varint in binary format", __LINE__, __FILE__);
+            }
+            l_continue = ext_binary_format<T>::decode_varint_byte(l_varint, l_index, *l_position++);
+        }
+        size_t l_remaining = (size_t)(m_end - l_position);
+        size_t l_padding = ext_binary_format<T>::get_padding((uint64_t)(l_position - m_begin));
+        uint64_t l_nb_limbs = l_varint >> 1;
+        if(l_padding > l_remaining || l_nb_limbs > (l_remaining - l_padding) / sizeof(T))
+        {
+            throw quicky_exception::quicky_runtime_exception("Truncated binary format", __LINE__, __FILE__);
+        }
+        for(size_t l_index = 0; l_index < l_padding; ++l_index)
+        {
+            if(l_position[l_index])
+            {
+                throw quicky_exception::quicky_runtime_exception("Non canonical padding in binary format", __LINE__, __FILE__);
+            }
+        }
+        const T * l_limbs = reinterpret_cast<const T *>(l_position + l_padding);
+        m_negative = l_varint & 1;
+        if((l_nb_limbs && !l_limbs[l_nb_limbs - 1]) || (m_negative && !l_nb_limbs))
+        {
+            throw quicky_exception::quicky_runtime_exception("Non canonical number in binary format", __LINE__, __FILE__);
+        }
+        m_magnitude = ext_uint_view<T>(l_limbs, (size_t)l_nb_limbs);
+        m_next = reinterpret_cast<const uint8_t *>(l_limbs + l_nb_limbs);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename ext_binary_view<T>::const_iterator::reference
+    ext_binary_view<T>::const_iterator::operator*() const
+    {
+        return m_magnitude;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename ext_binary_view<T>::const_iterator::pointer
+    ext_binary_view<T>::const_iterator::operator->() const
+    {
+        return &m_magnitude;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename ext_binary_view<T>::const_iterator &
+    ext_binary_view<T>::const_iterator::operator++()
+    {
+        m_position = m_next;
+        decode();
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename ext_binary_view<T>::const_iterator
+    ext_binary_view<T>::const_iterator::operator++(int)
+    {
+        const_iterator l_previous(*this);
+        ++(*this);
+        return l_previous;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    ext_binary_view<T>::const_iterator::operator==(const const_iterator & p_op) const
+    {
+        return m_position == p_op.m_position;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    ext_binary_view<T>::const_iterator::operator!=(const const_iterator & p_op) const
+    {
+        return m_position != p_op.m_position;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    ext_binary_view<T>::const_iterator::is_negative() const
+    {
+        return m_negative;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    ext_binary_view<T>::const_iterator::to_ext_uint() const
+    {
+        if(m_negative)
+        {
+            throw quicky_exception::quicky_runtime_exception("Negative number read as ext_uint", __LINE__, __FILE__);
+        }
+        return m_magnitude.to_ext_uint();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename ext_binary_view<T>::signed_type
+    ext_binary_view<T>::const_iterator::to_ext_int() const
+    {
+        signed_type l_result(m_magnitude.to_ext_uint());
+        return m_negative ? -l_result : l_result;
+    }
+
+#ifdef QUICKY_UTILS_SELF_TEST
+    /**
+     * Method regrouping tests of binary format of extensible integers
+     */
+    bool
+    test_ext_binary_format();
+#endif // QUICKY_UTILS_SELF_TEST
+}
+#endif //QUICKY_UTILS_EXT_BINARY_FORMAT_H
+// EOF
@@ -0,0 +1,36 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+#ifndef QUICKY_UTILS_EXT_FRACT_H
+#define QUICKY_UTILS_EXT_FRACT_H
+
+#include "ext_uint.h"
+#include "ext_int.h"
+#include "ext_gcd.h"
+#include "fract.h"
+
+namespace quicky_utils
+{
+#ifdef QUICKY_UTILS_SELF_TEST
+    /**
+     * Method regrouping tests of fractions of extensible integers
+     */
+    bool
+    test_ext_fract();
+#endif // QUICKY_UTILS_SELF_TEST
+}
+#endif //QUICKY_UTILS_EXT_FRACT_H
+// EOF
@@ -0,0 +1,704 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+#ifndef QUICKY_UTILS_EXT_GCD_H
+#define QUICKY_UTILS_EXT_GCD_H
+
+#include "ext_uint.h"
+#include "ext_int.h"
+#include "limb_kernel.h"
+#include <vector>
+#include <limits>
+#include <utility>
+#include <type_traits>
+
+namespace quicky_utils
+{
+    /**
+     * Greatest common divisor algorithms for extensible integers.
+     * Numbers fitting in two limbs use binary GCD. Bigger ones use Lehmer
+     * algorithm: Euclid steps are simulated on the upper two limbs and
+     * accumulated in a matrix of single limb cofactors that is then applied
+     * to whole numbers with limb_kernel routines
+     * @tparam T limb type
+     */
+    template <typename T>
+    class gcd_kernel
+    {
+      public:
+        typedef typename limb_double<T>::type double_type;
+        typedef typename limb_double<T>::signed_type signed_double_type;
+
+        /**
+         * Binary GCD of two double limbs numbers
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @return greatest common divisor, 0 if both operands are null
+         */
+        static
+        double_type binary_gcd(double_type p_op1
+                              ,double_type p_op2
+                              );
+
+        /**
+         * Greatest common divisor
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @return greatest common divisor, 0 if both operands are null
+         */
+        static
+        ext_uint<T> gcd(const ext_uint<T> & p_op1
+                       ,const ext_uint<T> & p_op2
+                       );
+
+        /**
+         * Extended greatest common divisor of p_op1 >= p_op2
+         * g = (-1)^k * p_coef1 * p_op1 + (-1)^(k+1) * p_coef2 * p_op2
+         * @param p_op1 first operand
+         * @param p_op2 second operand lower or equal than first one
+         * @param p_coef1 magnitude of first Bezout coefficient
+         * @param p_coef2 magnitude of second Bezout coefficient
+         * @param p_odd true if k is odd
+         * @return greatest common divisor
+         */
+        static
+        ext_uint<T> extended_gcd(const ext_uint<T> & p_op1
+                                ,const ext_uint<T> & p_op2
+                                ,ext_uint<T> & p_coef1
+                                ,ext_uint<T> & p_coef2
+                                ,bool & p_odd
+                                );
+
+      private:
+
+        /**
+         * Matrix of cofactors accumulated by Lehmer simulation
+         * new op1 = A * op1 + B * op2, new op2 = C * op1 + D * op2
+         * Signs of A and D are opposite to signs of B and C and depend on
+         * parity of number of simulated steps
+         */
+        struct lehmer_matrix
+        {
+            T m_a;
+            T m_b;
+            T m_c;
+            T m_d;
+            bool m_a_negative;
+            unsigned int m_nb_steps;
+        };
+
+        /**
+         * Simulate Euclid steps on upper bits of operands
+         * @param p_op1 first operand, greater than second one
+         * @param p_op2 second operand
+         * @param p_matrix computed cofactors
+         * @return false if no step could be simulated
+         */
+        static
+        bool lehmer_simulation(const std::vector<T> & p_op1
+                              ,const std::vector<T> & p_op2
+                              ,lehmer_matrix & p_matrix
+                              );
+
+        /**
+         * Apply Lehmer matrix to operands. p_op2 is extended to p_op1 size
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @param p_matrix cofactors
+         * @param p_scratch1 scratch buffer
+         * @param p_scratch2 scratch buffer
+         */
+        static
+        void apply(std::vector<T> & p_op1
+                  ,std::vector<T> & p_op2
+                  ,const lehmer_matrix & p_matrix
+                  ,std::vector<T> & p_scratch1
+                  ,std::vector<T> & p_scratch2
+                  );
+
+        /**
+         * Compute p_result = p_pos * p_pos_mult - p_neg * p_neg_mult
+         * @param p_result buffer of p_size + 1 limbs
+         * @param p_size number of limbs of operands
+         */
+        static
+        void combine(T * p_result
+                    ,const T * p_pos
+                    ,T p_pos_mult
+                    ,const T * p_neg
+                    ,T p_neg_mult
+                    ,size_t p_size
+                    );
+
+        /**
+         * Euclid step p_op1, p_op2 <- p_op2, p_op1 mod p_op2
+         * @param p_op1 first operand
+         * @param p_op2 non null second operand
+         * @param p_quotient quotient of division
+         * @param p_remainder scratch buffer
+         */
+        static
+        void division_step(std::vector<T> & p_op1
+                          ,std::vector<T> & p_op2
+                          ,std::vector<T> & p_quotient
+                          ,std::vector<T> & p_remainder
+                          );
+
+        /**
+         * Extract bits [p_shift, p_shift + 2 * limb bits - 2[ of number
+         */
+        static
+        double_type top_bits(const std::vector<T> & p_op
+                            ,size_t p_shift
+                            );
+
+        /**
+         * Remove upper null limbs, null number having no limb
+         */
+        static
+        void shrink(std::vector<T> & p_op);
+
+        static
+        double_type to_double(const std::vector<T> & p_op);
+
+        static
+        ext_uint<T> from_double(double_type p_op);
+
+        static
+        unsigned int count_trailing_zeros(double_type p_op);
+
+        static
+        signed_double_type abs(signed_double_type p_op);
+
+        static constexpr unsigned int m_nb_bits = limb_kernel<T>::m_nb_bits;
+    };
+
+    /**
+     * Greatest common divisor
+     * @param p_op1 first operand
+     * @param p_op2 second operand
+     * @return greatest common divisor, 0 if both operands are null
+     */
+    template <typename T>
+    ext_uint<T> gcd(const ext_uint<T> & p_op1
+                   ,const ext_uint<T> & p_op2
+                   );
+
+    /**
+     * Least common multiple
+     * @param p_op1 first operand
+     * @param p_op2 second operand
+     * @return least common multiple, 0 if one operand is null
+     */
+    template <typename T>
+    ext_uint<T> lcm(const ext_uint<T> & p_op1
+                   ,const ext_uint<T> & p_op2
+                   );
+
+    /**
+     * Extended greatest common divisor
+     * @param p_op1 first operand
+     * @param p_op2 second operand
+     * @param p_coef1 Bezout coefficient of first operand
+     * @param p_coef2 Bezout coefficient of second operand
+     * @return g = gcd(p_op1, p_op2) = p_coef1 * p_op1 + p_coef2 * p_op2
+     */
+    template <typename T>
+    ext_uint<T> extended_gcd(const ext_uint<T> & p_op1
+                            ,const ext_uint<T> & p_op2
+                            ,ext_int<typename std::make_signed<T>::type> & p_coef1
+                            ,ext_int<typename std::make_signed<T>::type> & p_coef2
+                            );
+
+    /**
+     * Greatest common divisor
+     * @param p_op1 first operand
+     * @param p_op2 second operand
+     * @return non negative greatest common divisor
+     */
+    template <typename T>
+    ext_int<T> gcd(const ext_int<T> & p_op1
+                  ,const ext_int<T> & p_op2
+                  );
+
+    /**
+     * Least common multiple
+     * @param p_op1 first operand
+     * @param p_op2 second operand
+     * @return non negative least common multiple
+     */
+    template <typename T>
+    ext_int<T> lcm(const ext_int<T> & p_op1
+                  ,const ext_int<T> & p_op2
+                  );
+
+    /**
+     * Extended greatest common divisor
+     * @param p_op1 first operand
+     * @param p_op2 second operand
+     * @param p_coef1 Bezout coefficient of first operand
+     * @param p_coef2 Bezout coefficient of second operand
+     * @return non negative g = p_coef1 * p_op1 + p_coef2 * p_op2
+     */
+    template <typename T>
+    ext_int<T> extended_gcd(const ext_int<T> & p_op1
+                           ,const ext_int<T> & p_op2
+                           ,ext_int<T> & p_coef1
+                           ,ext_int<T> & p_coef2
+                           );
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename gcd_kernel<T>::double_type
+    gcd_kernel<T>::binary_gcd(double_type p_op1
+                             ,double_type p_op2
+                             )
+    {
+        if(!p_op1)
+        {
+            return p_op2;
+        }
+        if(!p_op2)
+        {
+            return p_op1;
+        }
+        unsigned int l_shift = count_trailing_zeros((double_type)(p_op1 | p_op2));
+        p_op1 = (double_type)(p_op1 >> count_trailing_zeros(p_op1));
+        do
+        {
+            p_op2 = (double_type)(p_op2 >> count_trailing_zeros(p_op2));
+            if(p_op1 > p_op2)
+            {
+                std::swap(p_op1, p_op2);
+            }
+            p_op2 = (double_type)(p_op2 - p_op1);
+        } while(p_op2);
+        return (double_type)(p_op1 << l_shift);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    gcd_kernel<T>::gcd(const ext_uint<T> & p_op1
+                      ,const ext_uint<T> & p_op2
+                      )
+    {
+        std::vector<T> l_op1(p_op1.get_extension());
+        std::vector<T> l_op2(p_op2.get_extension());
+        shrink(l_op1);
+        shrink(l_op2);
+        if(limb_kernel<T>::compare(l_op1.data(), l_op1.size(), l_op2.data(), l_op2.size()) < 0)
+        {
+            l_op1.swap(l_op2);
+        }
+        std::vector<T> l_scratch1;
+        std::vector<T> l_scratch2;
+        while(l_op2.size() > 2)
+        {
+            lehmer_matrix l_matrix;
+            if(lehmer_simulation(l_op1, l_op2, l_matrix))
+            {
+                apply(l_op1, l_op2, l_matrix, l_scratch1, l_scratch2);
+            }
+            else
+            {
+                division_step(l_op1, l_op2, l_scratch1, l_scratch2);
+            }
+        }
+        if(l_op2.empty())
+        {
+            return ext_uint<T>::from_limbs(l_op1.data(), l_op1.size());
+        }
+        if(l_op1.size() > 2)
+        {
+            division_step(l_op1, l_op2, l_scratch1, l_scratch2);
+        }
+        return from_double(binary_gcd(to_double(l_op1), to_double(l_op2)));
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    gcd_kernel<T>::extended_gcd(const ext_uint<T> & p_op1
+                               ,const ext_uint<T> & p_op2
+                               ,ext_uint<T> & p_coef1
+                               ,ext_uint<T> & p_coef2
+                               ,bool & p_odd
+                               )
+    {
+        assert(p_op1 >= p_op2);
+        std::vector<T> l_op1(p_op1.get_extension());
+        std::vector<T> l_op2(p_op2.get_extension());
+        shrink(l_op1);
+        shrink(l_op2);
+        // Cofactors of p_op1 and p_op2 for current l_op1 and l_op2
+        ext_uint<T> l_s0({1});
+        ext_uint<T> l_s1;
+        ext_uint<T> l_t0;
+        ext_uint<T> l_t1({1});
+        p_odd = false;
+        std::vector<T> l_scratch1;
+        std::vector<T> l_scratch2;
+        while(!l_op2.empty())
+        {
+            lehmer_matrix l_matrix;
+            if(lehmer_simulation(l_op1, l_op2, l_matrix))
+            {
+                apply(l_op1, l_op2, l_matrix, l_scratch1, l_scratch2);
+                // Cofactors signs alternate so their magnitudes are added
+                ext_uint<T> l_a({l_matrix.m_a});
+                ext_uint<T> l_b({l_matrix.m_b});
+                ext_uint<T> l_c({l_matrix.m_c});
+                ext_uint<T> l_d({l_matrix.m_d});
+                ext_uint<T> l_s = l_a * l_s0 + l_b * l_s1;
+                l_s1 = l_c * l_s0 + l_d * l_s1;
+                l_s0 = l_s;
+                ext_uint<T> l_t = l_a * l_t0 + l_b * l_t1;
+                l_t1 = l_c * l_t0 + l_d * l_t1;
+                l_t0 = l_t;
+                if(l_matrix.m_nb_steps & 1u)
+                {
+                    p_odd = !p_odd;
+                }
+            }
+            else
+            {
+                division_step(l_op1, l_op2, l_scratch1, l_scratch2);
+                ext_uint<T> l_quotient = ext_uint<T>::from_limbs(l_scratch1.data(), l_scratch1.size());
+                ext_uint<T> l_s = l_s0 + l_quotient * l_s1;
+                l_s0 = l_s1;
+                l_s1 = l_s;
+                ext_uint<T> l_t = l_t0 + l_quotient * l_t1;
+                l_t0 = l_t1;
+                l_t1 = l_t;
+                p_odd = !p_odd;
+            }
+        }
+        p_coef1 = l_s0;
+        p_coef2 = l_t0;
+        return ext_uint<T>::from_limbs(l_op1.data(), l_op1.size());
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    gcd_kernel<T>::lehmer_simulation(const std::vector<T> & p_op1
+                                    ,const std::vector<T> & p_op2
+                                    ,lehmer_matrix & p_matrix
+                                    )
+    {
+        // Keep two bits of margin so that sums with cofactors fit in signed double type
+        size_t l_nb_bits = p_op1.size() * m_nb_bits - limb_kernel<T>::count_leading_zeros(p_op1.back());
+        size_t l_shift = l_nb_bits > 2 * m_nb_bits - 2 ? l_nb_bits - (2 * m_nb_bits - 2) : 0;
+        signed_double_type l_x = (signed_double_type)top_bits(p_op1, l_shift);
+        signed_double_type l_y = (signed_double_type)top_bits(p_op2, l_shift);
+        const signed_double_type l_max = (signed_double_type)std::numeric_limits<T>::max();
+
+        // Knuth algorithm L: a step is valid when both quotient bounds are equal
+        signed_double_type l_a = 1;
+        signed_double_type l_b = 0;
+        signed_double_type l_c = 0;
+        signed_double_type l_d = 1;
+        unsigned int l_nb_steps = 0;
+        while(l_y + l_c > 0 && l_y + l_d > 0)
+        {
+            signed_double_type l_q = (signed_double_type)((l_x + l_a) / (l_y + l_c));
+            if(l_q != (signed_double_type)((l_x + l_b) / (l_y + l_d)))
+            {
+                break;
+            }
+            // New cofactor magnitudes are |A| + q |C| and |B| + q |D|
+            if((l_c && l_q > (signed_double_type)((l_max - abs(l_a)) / abs(l_c))) ||
+               (l_d && l_q > (signed_double_type)((l_max - abs(l_b)) / abs(l_d)))
+              )
+            {
+                break;
+            }
+            signed_double_type l_tmp = (signed_double_type)(l_a - l_q * l_c);
+            l_a = l_c;
+            l_c = l_tmp;
+            l_tmp = (signed_double_type)(l_b - l_q * l_d);
+            l_b = l_d;
+            l_d = l_tmp;
+            l_tmp = (signed_double_type)(l_x - l_q * l_y);
+            l_x = l_y;
+            l_y = l_tmp;
+            ++l_nb_steps;
+        }
+        if(!l_nb_steps)
+        {
+            return false;
+        }
+        p_matrix.m_a = (T)abs(l_a);
+        p_matrix.m_b = (T)abs(l_b);
+        p_matrix.m_c = (T)abs(l_c);
+        p_matrix.m_d = (T)abs(l_d);
+        // After k steps sign of A is (-1)^k, A being null after first step
+        p_matrix.m_a_negative = l_nb_steps & 1u;
+        p_matrix.m_nb_steps = l_nb_steps;
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    gcd_kernel<T>::apply(std::vector<T> & p_op1
+                        ,std::vector<T> & p_op2
+                        ,const lehmer_matrix & p_matrix
+                        ,std::vector<T> & p_scratch1
+                        ,std::vector<T> & p_scratch2
+                        )
+    {
+        size_t l_size = p_op1.size();
+        p_op2.resize(l_size, 0);
+        p_scratch1.resize(l_size + 1);
+        p_scratch2.resize(l_size + 1);
+        if(!p_matrix.m_a_negative)
+        {
+            combine(p_scratch1.data(), p_op1.data(), p_matrix.m_a, p_op2.data(), p_matrix.m_b, l_size);
+            combine(p_scratch2.data(), p_op2.data(), p_matrix.m_d, p_op1.data(), p_matrix.m_c, l_size);
+        }
+        else
+        {
+            combine(p_scratch1.data(), p_op2.data(), p_matrix.m_b, p_op1.data(), p_matrix.m_a, l_size);
+            combine(p_scratch2.data(), p_op1.data(), p_matrix.m_c, p_op2.data(), p_matrix.m_d, l_size);
+        }
+        p_op1.swap(p_scratch1);
+        p_op2.swap(p_scratch2);
+        shrink(p_op1);
+        shrink(p_op2);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    gcd_kernel<T>::combine(T * p_result
+                          ,const T * p_pos
+                          ,T p_pos_mult
+                          ,const T * p_neg
+                          ,T p_neg_mult
+                          ,size_t p_size
+                          )
+    {
+        p_result[p_size] = limb_kernel<T>::mul_1(p_result, p_pos, p_size, p_pos_mult);
+        T l_borrow = limb_kernel<T>::submul_1(p_result, p_neg, p_size, p_neg_mult);
+        assert(p_result[p_size] >= l_borrow);
+        p_result[p_size] = (T)(p_result[p_size] - l_borrow);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    gcd_kernel<T>::division_step(std::vector<T> & p_op1
+                                ,std::vector<T> & p_op2
+                                ,std::vector<T> & p_quotient
+                                ,std::vector<T> & p_remainder
+                                )
+    {
+        assert(!p_op2.empty());
+        p_quotient.resize(p_op1.size() - p_op2.size() + 1);
+        p_remainder.resize(p_op2.size());
+        limb_kernel<T>::divrem(p_quotient.data(), p_remainder.data(), p_op1.data(), p_op1.size(), p_op2.data(), p_op2.size());
+        p_op1.swap(p_op2);
+        p_op2.swap(p_remainder);
+        shrink(p_op2);
+        shrink(p_quotient);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename gcd_kernel<T>::double_type
+    gcd_kernel<T>::top_bits(const std::vector<T> & p_op
+                           ,size_t p_shift
+                           )
+    {
+        size_t l_index = p_shift / m_nb_bits;
+        unsigned int l_bit_shift = p_shift % m_nb_bits;
+        double_type l_result = 0;
+        if(l_index < p_op.size())
+        {
+            l_result = (double_type)(p_op[l_index] >> l_bit_shift);
+        }
+        if(l_index + 1 < p_op.size())
+        {
+            l_result |= (double_type)(((double_type)p_op[l_index + 1]) << (m_nb_bits - l_bit_shift));
+        }
+        if(l_bit_shift && l_index + 2 < p_op.size())
+        {
+            l_result |= (double_type)(((double_type)p_op[l_index + 2]) << (2 * m_nb_bits - l_bit_shift));
+        }
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    gcd_kernel<T>::shrink(std::vector<T> & p_op)
+    {
+        p_op.resize(limb_kernel<T>::significant_size(p_op.data(), p_op.size()));
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename gcd_kernel<T>::double_type
+    gcd_kernel<T>::to_double(const std::vector<T> & p_op)
+    {
+        assert(p_op.size() <= 2);
+        double_type l_result = 0;
+        for(size_t l_index = p_op.size(); l_index > 0; --l_index)
+        {
+            l_result = (double_type)((l_result << m_nb_bits) | p_op[l_index - 1]);
+        }
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    gcd_kernel<T>::from_double(double_type p_op)
+    {
+        T l_limbs[2] = {(T)p_op, (T)(p_op >> m_nb_bits)};
+        return ext_uint<T>::from_limbs(l_limbs, 2);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    unsigned int
+    gcd_kernel<T>::count_trailing_zeros(double_type p_op)
+    {
+        assert(p_op);
+        if((T)p_op)
+        {
+            return limb_kernel<T>::count_trailing_zeros((T)p_op);
+        }
+        return m_nb_bits + limb_kernel<T>::count_trailing_zeros((T)(p_op >> m_nb_bits));
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename gcd_kernel<T>::signed_double_type
+    gcd_kernel<T>::abs(signed_double_type p_op)
+    {
+        return p_op < 0 ? (signed_double_type)-p_op : p_op;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T> gcd(const ext_uint<T> & p_op1
+                   ,const ext_uint<T> & p_op2
+                   )
+    {
+        return gcd_kernel<T>::gcd(p_op1, p_op2);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T> lcm(const ext_uint<T> & p_op1
+                   ,const ext_uint<T> & p_op2
+                   )
+    {
+        if(!p_op1 || !p_op2)
+        {
+            return ext_uint<T>();
+        }
+        ext_uint<T> l_quotient;
+        ext_uint<T> l_remainder;
+        ext_uint<T>::divrem(p_op1, gcd_kernel<T>::gcd(p_op1, p_op2), l_quotient, l_remainder);
+        return l_quotient * p_op2;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T> extended_gcd(const ext_uint<T> & p_op1
+                            ,const ext_uint<T> & p_op2
+                            ,ext_int<typename std::make_signed<T>::type> & p_coef1
+                            ,ext_int<typename std::make_signed<T>::type> & p_coef2
+                            )
+    {
+        typedef ext_int<typename std::make_signed<T>::type> t_coef;
+        bool l_swap = p_op1 < p_op2;
+        ext_uint<T> l_coef1;
+        ext_uint<T> l_coef2;
+        bool l_odd;
+        ext_uint<T> l_gcd = l_swap ? gcd_kernel<T>::extended_gcd(p_op2, p_op1, l_coef1, l_coef2, l_odd) : gcd_kernel<T>::extended_gcd(p_op1, p_op2, l_coef1, l_coef2, l_odd);
+        t_coef l_signed_coef1(l_coef1);
+        t_coef l_signed_coef2(l_coef2);
+        if(l_odd)
+        {
+            l_signed_coef1 = -l_signed_coef1;
+        }
+        else
+        {
+            l_signed_coef2 = -l_signed_coef2;
+        }
+        p_coef1 = l_swap ? l_signed_coef2 : l_signed_coef1;
+        p_coef2 = l_swap ? l_signed_coef1 : l_signed_coef2;
+        return l_gcd;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_int<T> gcd(const ext_int<T> & p_op1
+                  ,const ext_int<T> & p_op2
+                  )
+    {
+        typedef ext_uint<typename ext_int<T>::ubase_type> t_magnitude;
+        return ext_int<T>(gcd(t_magnitude(p_op1.get_root() < 0 ? -p_op1 : p_op1), t_magnitude(p_op2.get_root() < 0 ? -p_op2 : p_op2)));
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_int<T> lcm(const ext_int<T> & p_op1
+                  ,const ext_int<T> & p_op2
+                  )
+    {
+        typedef ext_uint<typename ext_int<T>::ubase_type> t_magnitude;
+        return ext_int<T>(lcm(t_magnitude(p_op1.get_root() < 0 ? -p_op1 : p_op1), t_magnitude(p_op2.get_root() < 0 ? -p_op2 : p_op2)));
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_int<T> extended_gcd(const ext_int<T> & p_op1
+                           ,const ext_int<T> & p_op2
+                           ,ext_int<T> & p_coef1
+                           ,ext_int<T> & p_coef2
+                           )
+    {
+        typedef ext_uint<typename ext_int<T>::ubase_type> t_magnitude;
+        bool l_negative1 = p_op1.get_root() < 0;
+        bool l_negative2 = p_op2.get_root() < 0;
+        ext_int<T> l_gcd(extended_gcd(t_magnitude(l_negative1 ? -p_op1 : p_op1), t_magnitude(l_negative2 ? -p_op2 : p_op2), p_coef1, p_coef2));
+        if(l_negative1)
+        {
+            p_coef1 = -p_coef1;
+        }
+        if(l_negative2)
+        {
+            p_coef2 = -p_coef2;
+        }
+        return l_gcd;
+    }
+
+#ifdef QUICKY_UTILS_SELF_TEST
+    /**
+     * Method regrouping tests of gcd functions
+     */
+    bool
+    test_ext_gcd();
+#endif // QUICKY_UTILS_SELF_TEST
+}
+#endif //QUICKY_UTILS_EXT_GCD_H
+// EOF
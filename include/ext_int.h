@@ -20,14 +20,18 @@
 #include "safe_int.h"
 #include "quicky_exception.h"
 #include "type_string.h"
+#include "limb_kernel.h"
+#include "bignum_workspace.h"
 #include <iostream>
 #include <vector>
+#include <functional>
 #include <iomanip>
 #include <type_traits>
 #include <sstream>
 #include <cassert>
 #include <functional>
 #include <cstdlib>
+#include <cmath>
 
 namespace quicky_utils
 {
@@ -37,6 +41,9 @@ namespace quicky_utils
     template <typename T>
     class ext_uint;
 
+    template <typename T, size_t N>
+    class ext_int_sum;
+
     template <typename T>
     std::ostream &
     operator<<(std::ostream & p_stream
@@ -68,7 +75,7 @@ namespace quicky_utils
         /**
          * Move constructor
          */
-        ext_int(const ext_int && p_value)noexcept;
+        ext_int(ext_int && p_value)noexcept;
 
         /**
          * Copy constructor
@@ -120,6 +127,20 @@ namespace quicky_utils
 #endif // EXT_INT_DISABLE_EXPLICIT
         ext_int(const int64_t & p_value);
 
+        /**
+         * Constructor from double, fractional part is truncated
+         * @param p_value finite value
+         */
+        explicit
+        ext_int(const double & p_value);
+
+        /**
+         * Constructor from float, fractional part is truncated
+         * @param p_value finite value
+         */
+        explicit
+        ext_int(const float & p_value);
+
         /**
          * Constructor from ext_uint
          * @param p_value
@@ -153,6 +174,15 @@ namespace quicky_utils
          */
         ext_int<T> & operator=(const ext_int<T> & p_op);
 
+        /**
+         * Evaluate lazy expression reusing capacity of this object.
+         * Defined in ext_int_expr.h
+         * @param p_expr sum of products to evaluate
+         * @return assigned object
+         */
+        template <size_t N>
+        ext_int<T> & operator=(const ext_int_sum<T, N> & p_expr);
+
 #ifndef EXT_INT_DISABLE_EXPLICIT
         explicit
 #endif // EXT_INT_DISABLE_EXPLICIT
@@ -168,6 +198,25 @@ namespace quicky_utils
 #endif // EXT_INT_DISABLE_EXPLICIT
         operator double() const;
 
+        /**
+         * Split number like frexp after rounding it to nearest floating
+         * value, ties to even. Unlike conversion operators it does not
+         * overflow for numbers out of floating type range
+         * @tparam FLOATING_TYPE float or double
+         * @param p_exponent exponent e such that number ~ mantissa * 2 ^ e
+         * @return mantissa whose absolute value is in [0.5, 1[, 0 for null number
+         */
+        template <typename FLOATING_TYPE = double>
+        FLOATING_TYPE to_mantissa_exp(int64_t & p_exponent) const;
+
+        /**
+         * Three-way comparison shared by relational operators
+         * @param p_op operand to compare with
+         * @return -1, 0 or 1 if this is lower, equal or greater than p_op
+         */
+        int
+        compare(const ext_int & p_op) const;
+
         bool
         operator==(const ext_int & p_op) const;
 
@@ -233,6 +282,26 @@ namespace quicky_utils
          */
         operator std::string() const;
 
+        /**
+         * Representation of number in a given base
+         * @param p_base base in range [2,36]
+         * @return string representation using lowercase digits prefixed by
+         * '-' for negative numbers
+         */
+        [[nodiscard]]
+        std::string to_string(unsigned int p_base = 10) const;
+
+        /**
+         * Build number from its representation in a given base
+         * @param p_string digits, case insensitive, with optional sign
+         * @param p_base base in range [2,36]
+         * @return number represented by string
+         */
+        static
+        ext_int from_string(const std::string & p_string
+                           ,unsigned int p_base = 10
+                           );
+
         /**
          * Root accessor
          * @return root
@@ -290,6 +359,56 @@ namespace quicky_utils
          */
         ext_int<T> & trim();
 
+        /**
+         * Write absolute value of number without building any temporary
+         * @param p_result limbs receiving magnitude, must have
+         * m_ext.size() + 1 limbs
+         * @return number of significant limbs of magnitude
+         */
+        size_t get_magnitude(ubase_type * p_result) const;
+
+        /**
+         * Number of significant limbs of absolute value, computed without
+         * building it
+         * @param p_lowest index of least significant non null limb, used by
+         * get_magnitude_limb
+         * @return number of significant limbs of magnitude
+         */
+        size_t get_magnitude_size(size_t & p_lowest) const;
+
+        /**
+         * Limb of absolute value. Two's complement of a negative number is
+         * null below its lowest non null limb, negated at this limb and
+         * complemented above
+         * @param p_index index of limb
+         * @param p_lowest index of least significant non null limb
+         * @return magnitude limb
+         */
+        ubase_type get_magnitude_limb(size_t p_index
+                                     ,size_t p_lowest
+                                     ) const;
+
+        /**
+         * Common part of floating constructors
+         * @tparam FLOATING_TYPE float or double
+         * @param p_value finite value
+         */
+        template <typename FLOATING_TYPE>
+        void from_floating(FLOATING_TYPE p_value);
+
+        /**
+         * Build number from its magnitude and sign
+         * @param p_limbs magnitude limbs, modified when number is negative
+         * @param p_size number of magnitude limbs
+         * @param p_negative indicate if number is negative
+         * @return number
+         */
+        static
+        ext_int from_magnitude(ubase_type * p_limbs
+                              ,size_t p_size
+                              ,bool p_negative
+                              );
+
         static_assert(std::is_signed<T>::value,"Ckeck base type is signed");
 
         /**
@@ -356,7 +475,7 @@ namespace quicky_utils
 
     //-------------------------------------------------------------------------
     template <typename T>
-    ext_int<T>::ext_int(const ext_int && p_value) noexcept:
+    ext_int<T>::ext_int(ext_int && p_value) noexcept:
     m_root(p_value.m_root),
     m_ext(std::move(p_value.m_ext))
     {
@@ -548,28 +667,37 @@ namespace quicky_utils
 
     //-------------------------------------------------------------------------
     template <typename T>
-    bool
-    ext_int<T>::operator==(const ext_int & p_op) const
+    int
+    ext_int<T>::compare(const ext_int & p_op) const
     {
-        if(m_root != p_op.m_root)
+        // Check signs
+        bool l_root_pos = m_root >= 0;
+        bool l_op_root_pos = p_op.m_root >= 0;
+        if(l_root_pos != l_op_root_pos)
         {
-            return false;
+            return l_root_pos ? 1 : -1;
         }
+
         if(m_ext.size() != p_op.m_ext.size())
         {
-            return false;
+            // For positive numbers absolute value comparison is good but this
+            // is the opposite for negative numbers
+            return (m_ext.size() < p_op.m_ext.size()) == l_root_pos ? -1 : 1;
         }
-        else
+        if(m_root != p_op.m_root)
         {
-            for(unsigned int l_index = 0;
-                l_index < m_ext.size();
-                ++l_index
-                    )
-            {
-                if(m_ext[l_index] != p_op.m_ext[l_index]) return false;
-            }
+            return m_root < p_op.m_root ? -1 : 1;
         }
-        return true;
+        // Two's complement extensions of same sign compare as unsigned
+        return limb_kernel<ubase_type>::compare(m_ext.data(), m_ext.size(), p_op.m_ext.data(), p_op.m_ext.size());
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    ext_int<T>::operator==(const ext_int & p_op) const
+    {
+        return compare(p_op) == 0;
     }
 
     //-------------------------------------------------------------------------
@@ -577,7 +705,7 @@ namespace quicky_utils
     bool
     ext_int<T>::operator!=(const ext_int & p_op) const
     {
-        return !(* this == p_op);
+        return compare(p_op) != 0;
     }
 
     //-------------------------------------------------------------------------
@@ -585,48 +713,7 @@ namespace quicky_utils
     bool
     ext_int<T>::operator<(const ext_int & p_op) const
     {
-        // Basic integer comparison
-        if (!m_ext.size() && !p_op.m_ext.size())
-        {
-            return m_root < p_op.m_root;
-        }
-
-        // Check signs
-        bool l_root_pos = m_root >= 0;
-        bool l_op_root_pos = p_op.m_root >= 0;
-        if(l_root_pos != l_op_root_pos)
-        {
-            return m_root < p_op.m_root;
-        }
-
-        if (m_ext.size() != p_op.m_ext.size())
-        {
-            // For positive numbers absolute value comparison is good but this
-            // is the opposite for negative numbers
-            if(m_root >= 0)
-            {
-                return m_ext.size() < p_op.m_ext.size();
-            }
-            else
-            {
-                return m_ext.size() > p_op.m_ext.size();
-            }
-        }
-        if(m_root != p_op.m_root)
-        {
-            return m_root < p_op.m_root;
-        }
-        size_t l_index = m_ext.size() - 1;
-        while (l_index < m_ext.size())
-        {
-            if (m_ext[l_index] != p_op.m_ext[l_index])
-            {
-                return m_ext[l_index] < p_op.m_ext[l_index];
-            }
-            --l_index;
-        }
-        return false;
-
+        return compare(p_op) < 0;
     }
 
     //-------------------------------------------------------------------------
@@ -634,47 +721,7 @@ namespace quicky_utils
     bool
     ext_int<T>::operator>(const ext_int & p_op) const
     {
-        // Basic integer comparison
-        if (!m_ext.size() && !p_op.m_ext.size())
-        {
-            return m_root > p_op.m_root;
-        }
-
-        // Check signs
-        bool l_root_pos = m_root >= 0;
-        bool l_op_root_pos = p_op.m_root >= 0;
-        if(l_root_pos != l_op_root_pos)
-        {
-            return m_root > p_op.m_root;
-        }
-
-        if (m_ext.size() != p_op.m_ext.size())
-        {
-            // For positive numbers absolute value comparison is good but this
-            // is the opposite for negative numbers
-            if(m_root >= 0)
-            {
-                return m_ext.size() > p_op.m_ext.size();
-            }
-            else
-            {
-                return m_ext.size() < p_op.m_ext.size();
-            }
-        }
-        if(m_root != p_op.m_root)
-        {
-            return m_root > p_op.m_root;
-        }
-        size_t l_index = m_ext.size() - 1;
-        while (l_index < m_ext.size())
-        {
-            if (m_ext[l_index] != p_op.m_ext[l_index])
-            {
-                return m_ext[l_index] > p_op.m_ext[l_index];
-            }
-            --l_index;
-        }
-        return false;
+        return compare(p_op) > 0;
     }
 
     //-------------------------------------------------------------------------
@@ -682,7 +729,7 @@ namespace quicky_utils
     bool
     ext_int<T>::operator<=(const ext_int & p_op) const
     {
-        return ! (*this > p_op);
+        return compare(p_op) <= 0;
     }
 
     //-------------------------------------------------------------------------
@@ -690,7 +737,7 @@ namespace quicky_utils
     bool
     ext_int<T>::operator>=(const ext_int & p_op) const
     {
-        return ! (*this < p_op);
+        return compare(p_op) >= 0;
     }
 
     //-------------------------------------------------------------------------
@@ -980,6 +1027,33 @@ namespace quicky_utils
         return l_stream.str();
     }
 
+    //-------------------------------------------------------------------------
+    template <typename T>
+    std::string
+    ext_int<T>::to_string(unsigned int p_base) const
+    {
+        if(m_root < 0)
+        {
+            return "-" + ext_uint<ubase_type>(-*this).to_string(p_base);
+        }
+        return ext_uint<ubase_type>(*this).to_string(p_base);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_int<T>
+    ext_int<T>::from_string(const std::string & p_string
+                           ,unsigned int p_base
+                           )
+    {
+        if(!p_string.empty() && ('-' == p_string[0] || '+' == p_string[0]))
+        {
+            ext_int<T> l_abs(ext_uint<ubase_type>::from_string(p_string.substr(1), p_base));
+            return '-' == p_string[0] ? -l_abs : l_abs;
+        }
+        return ext_int<T>(ext_uint<ubase_type>::from_string(p_string, p_base));
+    }
+
     //-------------------------------------------------------------------------
     template <typename T>
     template <typename INT_TYPE, typename std::enable_if<!(sizeof(INT_TYPE) <= sizeof(T)), int>::type>
@@ -1035,47 +1109,67 @@ namespace quicky_utils
         return m_ext;
     }
 
+    //-------------------------------------------------------------------------
+    template <typename T>
+    size_t
+    ext_int<T>::get_magnitude(ubase_type * p_result) const
+    {
+        std::copy(m_ext.begin(), m_ext.end(), p_result);
+        p_result[m_ext.size()] = (ubase_type)m_root;
+        if(m_root < 0)
+        {
+            limb_kernel<ubase_type>::negate(p_result, p_result, m_ext.size() + 1);
+        }
+        return limb_kernel<ubase_type>::significant_size(p_result, m_ext.size() + 1);
+    }
+
     //-------------------------------------------------------------------------
     template <typename T>
     ext_int<T>
-    ext_int<T>::operator*(const ext_int & p_op) const
+    ext_int<T>::from_magnitude(ubase_type * p_limbs
+                              ,size_t p_size
+                              ,bool p_negative
+                              )
     {
-        if(*this == ext_int<T>(0,{}) || p_op == ext_int<T>(0,{}))
+        ext_int<T> l_result;
+        if(!p_size)
         {
-            return ext_int<T>(0,{});
+            return l_result;
         }
-        unsigned int l_case = 2 * (this->m_root >= 0) + (p_op.m_root >= 0);
-        switch(l_case)
+        // Negative value is stored as two's complement of magnitude on
+        // p_size limbs completed by a -1 root
+        if(p_negative)
         {
-            case 0:
-            {
-                auto l_this_abs = ext_uint<ubase_type>(-*this);
-                auto l_op_abs = ext_uint<ubase_type>(-p_op);
-                return ext_int<T>(l_this_abs * l_op_abs);
-            }
-            case 1:
-            {
-                auto l_this_abs = ext_uint<ubase_type>(-*this);
-                auto l_op_abs = ext_uint<ubase_type>(p_op);
-                return -ext_int<T>(l_this_abs * l_op_abs);
-            }
-            case 2:
-            {
-                auto l_this_abs = ext_uint<ubase_type>(*this);
-                auto l_op_abs = ext_uint<ubase_type>(-p_op);
-                return -ext_int<T>(l_this_abs * l_op_abs);
-            }
-            case 3:
-            {
-                auto l_this_abs = ext_uint<ubase_type>(*this);
-                auto l_op_abs = ext_uint<ubase_type>(p_op);
-                return ext_int<T>(l_this_abs * l_op_abs);
-            }
-            default:
-                // Should never occur
-                assert(false);
+            limb_kernel<ubase_type>::negate(p_limbs, p_limbs, p_size);
+            l_result.m_root = -1;
+        }
+        l_result.m_ext.assign(p_limbs, p_limbs + p_size);
+        l_result.trim();
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_int<T>
+    ext_int<T>::operator*(const ext_int & p_op) const
+    {
+        if((!m_ext.size() && !m_root) || (!p_op.m_ext.size() && !p_op.m_root))
+        {
+            return ext_int<T>(0,{});
         }
-        return ext_int<T>(0,{});
+        bignum_workspace<ubase_type> & l_workspace = bignum_workspace<ubase_type>::get();
+        typename bignum_workspace<ubase_type>::buffer l_this_abs = l_workspace.acquire(m_ext.size() + 1);
+        typename bignum_workspace<ubase_type>::buffer l_op_abs = l_workspace.acquire(p_op.m_ext.size() + 1);
+        size_t l_this_size = get_magnitude(l_this_abs.data());
+        size_t l_op_size = p_op.get_magnitude(l_op_abs.data());
+        typename bignum_workspace<ubase_type>::buffer l_product = l_workspace.acquire(l_this_size + l_op_size);
+        limb_kernel<ubase_type>::mul(l_product.data()
+                                    ,l_this_abs.data()
+                                    ,l_this_size
+                                    ,l_op_abs.data()
+                                    ,l_op_size
+                                    );
+        return from_magnitude(l_product.data(), l_this_size + l_op_size, (m_root < 0) != (p_op.m_root < 0));
     }
 
     //-------------------------------------------------------------------------
@@ -1109,54 +1203,26 @@ namespace quicky_utils
                 return ext_int<T>({(T)(m_root / p_op.m_root)});
             }
         }
-        unsigned int l_case = 2 * (this->m_root >= 0) + (p_op.m_root >= 0);
-        switch(l_case)
+        bignum_workspace<ubase_type> & l_workspace = bignum_workspace<ubase_type>::get();
+        typename bignum_workspace<ubase_type>::buffer l_this_abs = l_workspace.acquire(m_ext.size() + 1);
+        typename bignum_workspace<ubase_type>::buffer l_op_abs = l_workspace.acquire(p_op.m_ext.size() + 1);
+        size_t l_this_size = get_magnitude(l_this_abs.data());
+        size_t l_op_size = p_op.get_magnitude(l_op_abs.data());
+        if(limb_kernel<ubase_type>::compare(l_this_abs.data(), l_this_size, l_op_abs.data(), l_op_size) < 0)
         {
-            case 0:
-            {
-                auto l_this_abs = ext_uint<ubase_type>(-*this);
-                auto l_op_abs = ext_uint<ubase_type>(-p_op);
-                if(l_this_abs < l_op_abs)
-                {
-                    return ext_int();
-                }
-                return ext_int<T>(l_this_abs / l_op_abs);
-            }
-            case 1:
-            {
-                auto l_this_abs = ext_uint<ubase_type>(-*this);
-                auto l_op_abs = ext_uint<ubase_type>(p_op);
-                if(l_this_abs < l_op_abs)
-                {
-                    return ext_int();
-                }
-                return -ext_int<T>(l_this_abs / l_op_abs);
-            }
-            case 2:
-            {
-                auto l_this_abs = ext_uint<ubase_type>(*this);
-                auto l_op_abs = ext_uint<ubase_type>(-p_op);
-                if(l_this_abs < l_op_abs)
-                {
-                    return ext_int();
-                }
-                return -ext_int<T>(l_this_abs / l_op_abs);
-            }
-            case 3:
-            {
-                auto l_this_abs = ext_uint<ubase_type>(*this);
-                auto l_op_abs = ext_uint<ubase_type>(p_op);
-                if(l_this_abs < l_op_abs)
-                {
-                    return ext_int();
-                }
-                return ext_int<T>(l_this_abs / l_op_abs);
-            }
-            default:
-                // Should never occur
-                assert(false);
+            return ext_int();
         }
-        return ext_int<T>(0,{});
+        typename bignum_workspace<ubase_type>::buffer l_quotient = l_workspace.acquire(l_this_size - l_op_size + 1);
+        typename bignum_workspace<ubase_type>::buffer l_remainder = l_workspace.acquire(l_op_size);
+        limb_kernel<ubase_type>::divrem(l_quotient.data()
+                                       ,l_remainder.data()
+                                       ,l_this_abs.data()
+                                       ,l_this_size
+                                       ,l_op_abs.data()
+                                       ,l_op_size
+                                       );
+        size_t l_quotient_size = limb_kernel<ubase_type>::significant_size(l_quotient.data(), l_quotient.size());
+        return from_magnitude(l_quotient.data(), l_quotient_size, (m_root < 0) != (p_op.m_root < 0));
     }
 
     //-------------------------------------------------------------------------
@@ -1186,59 +1252,27 @@ namespace quicky_utils
                 return ext_int<T>(m_root % p_op.m_root,{});
             }
         }
-        ext_uint<typename std::make_unsigned<T>::type> l_mult;
-        unsigned int l_case = 2 * (this->m_root >= 0) + (p_op.m_root >= 0);
-        switch(l_case)
+        bignum_workspace<ubase_type> & l_workspace = bignum_workspace<ubase_type>::get();
+        typename bignum_workspace<ubase_type>::buffer l_this_abs = l_workspace.acquire(m_ext.size() + 1);
+        typename bignum_workspace<ubase_type>::buffer l_op_abs = l_workspace.acquire(p_op.m_ext.size() + 1);
+        size_t l_this_size = get_magnitude(l_this_abs.data());
+        size_t l_op_size = p_op.get_magnitude(l_op_abs.data());
+        if(limb_kernel<ubase_type>::compare(l_this_abs.data(), l_this_size, l_op_abs.data(), l_op_size) < 0)
         {
-            case 0:
-            {
-                auto l_this_abs = ext_uint<ubase_type>(-*this);
-                auto l_op_abs = ext_uint<ubase_type>(-p_op);
-                if(l_this_abs < l_op_abs)
-                {
-                    return *this;
-                }
-                l_this_abs.div(l_op_abs, true, l_mult);
-                return -ext_int<T>(l_this_abs - l_mult);
-            }
-            case 1:
-            {
-                auto l_this_abs = ext_uint<ubase_type>(-*this);
-                auto l_op_abs = ext_uint<ubase_type>(p_op);
-                if(l_this_abs < l_op_abs)
-                {
-                    return *this;
-                }
-                l_this_abs.div(l_op_abs, true, l_mult);
-                return -ext_int<T>(l_this_abs - l_mult);
-            }
-            case 2:
-            {
-                auto l_this_abs = ext_uint<ubase_type>(*this);
-                auto l_op_abs = ext_uint<ubase_type>(-p_op);
-                if(l_this_abs < l_op_abs)
-                {
-                    return *this;
-                }
-                l_this_abs.div(l_op_abs, true, l_mult);
-                return ext_int<T>(l_this_abs - l_mult);
-            }
-            case 3:
-            {
-                auto l_this_abs = ext_uint<ubase_type>(*this);
-                auto l_op_abs = ext_uint<ubase_type>(p_op);
-                if(l_this_abs < l_op_abs)
-                {
-                    return *this;
-                }
-                l_this_abs.div(l_op_abs, true, l_mult);
-                return ext_int<T>(l_this_abs - l_mult);
-            }
-            default:
-                // Should never occur
-                assert(false);
+            return *this;
         }
-        return ext_int<T>(0,{});
+        typename bignum_workspace<ubase_type>::buffer l_quotient = l_workspace.acquire(l_this_size - l_op_size + 1);
+        typename bignum_workspace<ubase_type>::buffer l_remainder = l_workspace.acquire(l_op_size);
+        limb_kernel<ubase_type>::divrem(l_quotient.data()
+                                       ,l_remainder.data()
+                                       ,l_this_abs.data()
+                                       ,l_this_size
+                                       ,l_op_abs.data()
+                                       ,l_op_size
+                                       );
+        // Remainder has sign of numerator
+        size_t l_remainder_size = limb_kernel<ubase_type>::significant_size(l_remainder.data(), l_op_size);
+        return from_magnitude(l_remainder.data(), l_remainder_size, m_root < 0);
     }
 
     //-------------------------------------------------------------------------
@@ -1408,24 +1442,105 @@ namespace quicky_utils
 
     //-------------------------------------------------------------------------
     template <typename T>
-    ext_int<T>::operator float() const
+    ext_int<T>::ext_int(const double & p_value)
     {
-        if(m_root >= 0)
+        from_floating(p_value);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_int<T>::ext_int(const float & p_value)
+    {
+        from_floating(p_value);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <typename FLOATING_TYPE>
+    void
+    ext_int<T>::from_floating(FLOATING_TYPE p_value)
+    {
+        if(!std::isfinite(p_value))
+        {
+            throw quicky_exception::quicky_logic_exception("Floating value " + std::to_string(p_value) + " cannot be converted to ext_int", __LINE__, __FILE__);
+        }
+        *this = ext_int(ext_uint<ubase_type>(std::fabs(p_value)));
+        if(p_value < 0)
         {
-            return (float)ext_uint<ubase_type>(*this);
+            *this = -*this;
         }
-        return -(float)ext_uint<ubase_type>(-*this);
     }
 
     //-------------------------------------------------------------------------
     template <typename T>
-    ext_int<T>::operator double() const
+    size_t
+    ext_int<T>::get_magnitude_size(size_t & p_lowest) const
+    {
+        p_lowest = 0;
+        if(m_root < 0)
+        {
+            while(p_lowest < m_ext.size() && !m_ext[p_lowest])
+            {
+                ++p_lowest;
+            }
+        }
+        size_t l_size = m_ext.size() + 1;
+        while(l_size && !get_magnitude_limb(l_size - 1, p_lowest))
+        {
+            --l_size;
+        }
+        return l_size;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename ext_int<T>::ubase_type
+    ext_int<T>::get_magnitude_limb(size_t p_index
+                                  ,size_t p_lowest
+                                  ) const
     {
+        ubase_type l_limb = p_index < m_ext.size() ? m_ext[p_index] : (ubase_type)m_root;
         if(m_root >= 0)
         {
-            return (double)ext_uint<ubase_type>(*this);
+            return l_limb;
+        }
+        if(p_index < p_lowest)
+        {
+            return 0;
         }
-        return -(double)ext_uint<ubase_type>(-*this);
+        return p_index == p_lowest ? (ubase_type)-l_limb : (ubase_type)~l_limb;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <typename FLOATING_TYPE>
+    FLOATING_TYPE
+    ext_int<T>::to_mantissa_exp(int64_t & p_exponent) const
+    {
+        size_t l_lowest;
+        size_t l_size = get_magnitude_size(l_lowest);
+        FLOATING_TYPE l_mantissa = limb_kernel<ubase_type>::template to_mantissa_exp<FLOATING_TYPE>([&](size_t p_index){return get_magnitude_limb(p_index, l_lowest);}, l_size, p_exponent);
+        return m_root < 0 ? -l_mantissa : l_mantissa;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_int<T>::operator float() const
+    {
+        size_t l_lowest;
+        size_t l_size = get_magnitude_size(l_lowest);
+        float l_result = limb_kernel<ubase_type>::template to_floating<float>([&](size_t p_index){return get_magnitude_limb(p_index, l_lowest);}, l_size);
+        return m_root < 0 ? -l_result : l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_int<T>::operator double() const
+    {
+        size_t l_lowest;
+        size_t l_size = get_magnitude_size(l_lowest);
+        double l_result = limb_kernel<ubase_type>::template to_floating<double>([&](size_t p_index){return get_magnitude_limb(p_index, l_lowest);}, l_size);
+        return m_root < 0 ? -l_result : l_result;
     }
 
     //-------------------------------------------------------------------------
@@ -1505,6 +1620,17 @@ namespace std
         typedef quicky_utils::ext_uint<typename std::make_unsigned<T>::type> type;
     };
 
+    template <typename T>
+    struct hash<quicky_utils::ext_int<T> >
+    {
+        size_t operator()(const quicky_utils::ext_int<T> & p_value) const noexcept
+        {
+            typedef typename quicky_utils::ext_int<T>::ubase_type t_limb;
+            const std::vector<t_limb> & l_ext = p_value.get_extension();
+            return (size_t)quicky_utils::limb_kernel<t_limb>::get_hash(l_ext.data(), l_ext.size(), (uint64_t)(int64_t)p_value.get_root());
+        }
+    };
+
 }
 
 template <typename T>
@@ -0,0 +1,420 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+#ifndef QUICKY_UTILS_EXT_INT_EXPR_H
+#define QUICKY_UTILS_EXT_INT_EXPR_H
+
+#include "ext_uint.h"
+#include "ext_int.h"
+#include "limb_kernel.h"
+#include "bignum_workspace.h"
+#include <array>
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * Opt-in lazy evaluation of multiply-accumulate expressions on ext_int.
+ * Wrapping one operand with lazy() turns the expression into a sum of
+ * signed products that is only evaluated when assigned to an ext_int:
+ *
+ *   l_result = lazy(l_a) * l_b + lazy(l_c) * l_d - l_e;
+ *
+ * All terms are accumulated in a single workspace buffer with addmul/submul
+ * loops and the destination capacity is reused, so no intermediate ext_int
+ * is created. Expressions keep references on their operands and must be
+ * assigned in the statement that builds them
+ */
+namespace quicky_utils
+{
+    /**
+     * Signed product of at most two ext_int operands
+     * @tparam T ext_int base type
+     */
+    template <typename T>
+    struct ext_int_term_data
+    {
+        /**
+         * First factor
+         */
+        const ext_int<T> * m_op1;
+
+        /**
+         * Second factor, nullptr when term is a single operand
+         */
+        const ext_int<T> * m_op2;
+
+        /**
+         * Indicate if term is substracted
+         */
+        bool m_negative;
+    };
+
+    /**
+     * Lazy term made of one operand or of the product of two operands
+     * @tparam T ext_int base type
+     * @tparam IS_PRODUCT true if term is a product
+     */
+    template <typename T, bool IS_PRODUCT>
+    class ext_int_term
+    {
+      public:
+        explicit
+        ext_int_term(const ext_int_term_data<T> & p_data);
+
+        /**
+         * Term content
+         * @return term content
+         */
+        const ext_int_term_data<T> & get_data() const;
+
+      private:
+        ext_int_term_data<T> m_data;
+    };
+
+    /**
+     * Lazy sum of signed terms evaluated when assigned to an ext_int
+     * @tparam T ext_int base type
+     * @tparam N number of terms
+     */
+    template <typename T, size_t N>
+    class ext_int_sum
+    {
+      public:
+        explicit
+        ext_int_sum(const std::array<ext_int_term_data<T>, N> & p_terms);
+
+        /**
+         * Terms of sum
+         * @return terms of sum
+         */
+        const std::array<ext_int_term_data<T>, N> & get_terms() const;
+
+      private:
+        std::array<ext_int_term_data<T>, N> m_terms;
+    };
+
+    /**
+     * Information used to combine operands of lazy expressions
+     * @tparam X operand type
+     */
+    template <typename X>
+    struct ext_int_expr_info
+    {
+        static constexpr bool m_lazy = false;
+    };
+
+    template <typename T>
+    struct ext_int_expr_info<ext_int<T>>
+    {
+        typedef T base_type;
+        static constexpr bool m_lazy = false;
+        static constexpr size_t m_size = 1;
+
+        static
+        std::array<ext_int_term_data<T>, 1> get_terms(const ext_int<T> & p_op)
+        {
+            return {{{&p_op, nullptr, false}}};
+        }
+    };
+
+    template <typename T, bool IS_PRODUCT>
+    struct ext_int_expr_info<ext_int_term<T, IS_PRODUCT>>
+    {
+        typedef T base_type;
+        static constexpr bool m_lazy = true;
+        static constexpr size_t m_size = 1;
+
+        static
+        std::array<ext_int_term_data<T>, 1> get_terms(const ext_int_term<T, IS_PRODUCT> & p_op)
+        {
+            return {{p_op.get_data()}};
+        }
+    };
+
+    template <typename T, size_t N>
+    struct ext_int_expr_info<ext_int_sum<T, N>>
+    {
+        typedef T base_type;
+        static constexpr bool m_lazy = true;
+        static constexpr size_t m_size = N;
+
+        static
+        const std::array<ext_int_term_data<T>, N> & get_terms(const ext_int_sum<T, N> & p_op)
+        {
+            return p_op.get_terms();
+        }
+    };
+
+    /**
+     * Start a lazy expression
+     * @param p_op operand
+     * @return lazy term referencing operand
+     */
+    template <typename T>
+    ext_int_term<T, false> lazy(const ext_int<T> & p_op);
+
+    /**
+     * Lazy product of two operands
+     */
+    template <typename T>
+    ext_int_term<T, true> operator*(const ext_int_term<T, false> & p_op1
+                                   ,const ext_int<T> & p_op2
+                                   );
+
+    template <typename T>
+    ext_int_term<T, true> operator*(const ext_int<T> & p_op1
+                                   ,const ext_int_term<T, false> & p_op2
+                                   );
+
+    template <typename T>
+    ext_int_term<T, true> operator*(const ext_int_term<T, false> & p_op1
+                                   ,const ext_int_term<T, false> & p_op2
+                                   );
+
+    /**
+     * Lazy opposite of a term
+     */
+    template <typename T, bool IS_PRODUCT>
+    ext_int_term<T, IS_PRODUCT> operator-(const ext_int_term<T, IS_PRODUCT> & p_op);
+
+    /**
+     * Lazy sum of two operands, at least one of them being lazy
+     */
+    template <typename L, typename R, typename std::enable_if<ext_int_expr_info<L>::m_lazy || ext_int_expr_info<R>::m_lazy, int>::type = 0>
+    ext_int_sum<typename ext_int_expr_info<L>::base_type, ext_int_expr_info<L>::m_size + ext_int_expr_info<R>::m_size>
+    operator+(const L & p_op1
+             ,const R & p_op2
+             );
+
+    /**
+     * Lazy difference of two operands, at least one of them being lazy
+     */
+    template <typename L, typename R, typename std::enable_if<ext_int_expr_info<L>::m_lazy || ext_int_expr_info<R>::m_lazy, int>::type = 0>
+    ext_int_sum<typename ext_int_expr_info<L>::base_type, ext_int_expr_info<L>::m_size + ext_int_expr_info<R>::m_size>
+    operator-(const L & p_op1
+             ,const R & p_op2
+             );
+
+    //-------------------------------------------------------------------------
+    template <typename T, bool IS_PRODUCT>
+    ext_int_term<T, IS_PRODUCT>::ext_int_term(const ext_int_term_data<T> & p_data):
+    m_data(p_data)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T, bool IS_PRODUCT>
+    const ext_int_term_data<T> &
+    ext_int_term<T, IS_PRODUCT>::get_data() const
+    {
+        return m_data;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T, size_t N>
+    ext_int_sum<T, N>::ext_int_sum(const std::array<ext_int_term_data<T>, N> & p_terms):
+    m_terms(p_terms)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T, size_t N>
+    const std::array<ext_int_term_data<T>, N> &
+    ext_int_sum<T, N>::get_terms() const
+    {
+        return m_terms;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_int_term<T, false>
+    lazy(const ext_int<T> & p_op)
+    {
+        return ext_int_term<T, false>({&p_op, nullptr, false});
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_int_term<T, true>
+    operator*(const ext_int_term<T, false> & p_op1
+             ,const ext_int<T> & p_op2
+             )
+    {
+        return ext_int_term<T, true>({p_op1.get_data().m_op1, &p_op2, p_op1.get_data().m_negative});
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_int_term<T, true>
+    operator*(const ext_int<T> & p_op1
+             ,const ext_int_term<T, false> & p_op2
+             )
+    {
+        return ext_int_term<T, true>({&p_op1, p_op2.get_data().m_op1, p_op2.get_data().m_negative});
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_int_term<T, true>
+    operator*(const ext_int_term<T, false> & p_op1
+             ,const ext_int_term<T, false> & p_op2
+             )
+    {
+        return ext_int_term<T, true>({p_op1.get_data().m_op1, p_op2.get_data().m_op1, p_op1.get_data().m_negative != p_op2.get_data().m_negative});
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T, bool IS_PRODUCT>
+    ext_int_term<T, IS_PRODUCT>
+    operator-(const ext_int_term<T, IS_PRODUCT> & p_op)
+    {
+        ext_int_term_data<T> l_data = p_op.get_data();
+        l_data.m_negative = !l_data.m_negative;
+        return ext_int_term<T, IS_PRODUCT>(l_data);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename L, typename R, typename std::enable_if<ext_int_expr_info<L>::m_lazy || ext_int_expr_info<R>::m_lazy, int>::type>
+    ext_int_sum<typename ext_int_expr_info<L>::base_type, ext_int_expr_info<L>::m_size + ext_int_expr_info<R>::m_size>
+    operator+(const L & p_op1
+             ,const R & p_op2
+             )
+    {
+        typedef typename ext_int_expr_info<L>::base_type t_base;
+        static_assert(std::is_same<t_base, typename ext_int_expr_info<R>::base_type>::value, "Operands must have same base type");
+        constexpr size_t l_size1 = ext_int_expr_info<L>::m_size;
+        constexpr size_t l_size2 = ext_int_expr_info<R>::m_size;
+        std::array<ext_int_term_data<t_base>, l_size1 + l_size2> l_terms;
+        std::copy_n(ext_int_expr_info<L>::get_terms(p_op1).begin(), l_size1, l_terms.begin());
+        std::copy_n(ext_int_expr_info<R>::get_terms(p_op2).begin(), l_size2, l_terms.begin() + l_size1);
+        return ext_int_sum<t_base, l_size1 + l_size2>(l_terms);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename L, typename R, typename std::enable_if<ext_int_expr_info<L>::m_lazy || ext_int_expr_info<R>::m_lazy, int>::type>
+    ext_int_sum<typename ext_int_expr_info<L>::base_type, ext_int_expr_info<L>::m_size + ext_int_expr_info<R>::m_size>
+    operator-(const L & p_op1
+             ,const R & p_op2
+             )
+    {
+        typedef typename ext_int_expr_info<L>::base_type t_base;
+        static_assert(std::is_same<t_base, typename ext_int_expr_info<R>::base_type>::value, "Operands must have same base type");
+        constexpr size_t l_size1 = ext_int_expr_info<L>::m_size;
+        constexpr size_t l_size2 = ext_int_expr_info<R>::m_size;
+        std::array<ext_int_term_data<t_base>, l_size1 + l_size2> l_terms;
+        std::copy_n(ext_int_expr_info<L>::get_terms(p_op1).begin(), l_size1, l_terms.begin());
+        std::copy_n(ext_int_expr_info<R>::get_terms(p_op2).begin(), l_size2, l_terms.begin() + l_size1);
+        for(size_t l_index = l_size1; l_index < l_size1 + l_size2; ++l_index)
+        {
+            l_terms[l_index].m_negative = !l_terms[l_index].m_negative;
+        }
+        return ext_int_sum<t_base, l_size1 + l_size2>(l_terms);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <size_t N>
+    ext_int<T> &
+    ext_int<T>::operator=(const ext_int_sum<T, N> & p_expr)
+    {
+        // Accumulator must hold the biggest term, a carry limb per group of
+        // terms and the sign bit
+        size_t l_size = 0;
+        size_t l_max_operand_size = 0;
+        for(const auto & l_term: p_expr.get_terms())
+        {
+            size_t l_term_size = l_term.m_op1->m_ext.size() + 1 + (l_term.m_op2 ? l_term.m_op2->m_ext.size() + 1 : 0);
+            l_size = std::max(l_size, l_term_size);
+            l_max_operand_size = std::max(l_max_operand_size, l_term.m_op1->m_ext.size() + 1);
+            if(l_term.m_op2)
+            {
+                l_max_operand_size = std::max(l_max_operand_size, l_term.m_op2->m_ext.size() + 1);
+            }
+        }
+        size_t l_extra = 1;
+        while(((size_t)1 << (l_extra * limb_kernel<ubase_type>::m_nb_bits - 1)) < N)
+        {
+            ++l_extra;
+        }
+        l_size += l_extra;
+
+        bignum_workspace<ubase_type> & l_workspace = bignum_workspace<ubase_type>::get();
+        typename bignum_workspace<ubase_type>::buffer l_accumulator = l_workspace.acquire(l_size);
+        typename bignum_workspace<ubase_type>::buffer l_op1_abs = l_workspace.acquire(l_max_operand_size);
+        typename bignum_workspace<ubase_type>::buffer l_op2_abs = l_workspace.acquire(l_max_operand_size);
+        ubase_type * l_acc = l_accumulator.data();
+        std::fill(l_acc, l_acc + l_size, 0);
+
+        // Accumulate terms modulo 2^(l_size * m_nb_bits) so that final
+        // result is its two's complement representation
+        for(const auto & l_term: p_expr.get_terms())
+        {
+            size_t l_op1_size = l_term.m_op1->get_magnitude(l_op1_abs.data());
+            bool l_negative = l_term.m_negative != (l_term.m_op1->m_root < 0);
+            if(!l_term.m_op2)
+            {
+                if(l_negative)
+                {
+                    limb_kernel<ubase_type>::sub(l_acc, l_acc, l_size, l_op1_abs.data(), l_op1_size);
+                }
+                else
+                {
+                    limb_kernel<ubase_type>::add(l_acc, l_acc, l_size, l_op1_abs.data(), l_op1_size);
+                }
+                continue;
+            }
+            size_t l_op2_size = l_term.m_op2->get_magnitude(l_op2_abs.data());
+            l_negative = l_negative != (l_term.m_op2->m_root < 0);
+            if(!l_op1_size)
+            {
+                continue;
+            }
+            for(size_t l_index = 0; l_index < l_op2_size; ++l_index)
+            {
+                ubase_type * l_dest = l_acc + l_index;
+                ubase_type * l_upper = l_dest + l_op1_size;
+                size_t l_upper_size = l_size - l_index - l_op1_size;
+                if(l_negative)
+                {
+                    ubase_type l_borrow = limb_kernel<ubase_type>::submul_1(l_dest, l_op1_abs.data(), l_op1_size, l_op2_abs.data()[l_index]);
+                    limb_kernel<ubase_type>::sub(l_upper, l_upper, l_upper_size, &l_borrow, 1);
+                }
+                else
+                {
+                    ubase_type l_carry = limb_kernel<ubase_type>::addmul_1(l_dest, l_op1_abs.data(), l_op1_size, l_op2_abs.data()[l_index]);
+                    limb_kernel<ubase_type>::add(l_upper, l_upper, l_upper_size, &l_carry, 1);
+                }
+            }
+        }
+
+        // Operands are no longer used so destination can be one of them
+        m_ext.assign(l_acc, l_acc + l_size);
+        m_root = (l_acc[l_size - 1] & m_upper_bit_mask) ? -1 : 0;
+        trim();
+        return *this;
+    }
+
+#ifdef QUICKY_UTILS_SELF_TEST
+    /**
+     * Method regrouping tests of lazy ext_int expressions
+     */
+    bool
+    test_ext_int_expr();
+#endif // QUICKY_UTILS_SELF_TEST
+}
+#endif //QUICKY_UTILS_EXT_INT_EXPR_H
+// EOF
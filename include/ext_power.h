@@ -0,0 +1,691 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+#ifndef QUICKY_UTILS_EXT_POWER_H
+#define QUICKY_UTILS_EXT_POWER_H
+
+#include "ext_uint.h"
+#include "ext_int.h"
+#include "limb_kernel.h"
+#include "ntt_multiplier.h"
+#include "quicky_exception.h"
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace quicky_utils
+{
+    /**
+     * Powers and roots of extensible integers.
+     * Powers use left to right square and multiply, squares being computed
+     * by limb_kernel::sqr or by NTT for big operands. Roots use Newton
+     * iteration x' = ((k - 1) * x + n / x ^ (k - 1)) / k that decreases to
+     * floor of root when started above it. Starting point is derived from
+     * root of upper half of bits, computed recursively, so that only last
+     * iterations work at full precision. Roots of less than 32 bits are
+     * estimated with floating point and then corrected
+     * @tparam T limb type
+     */
+    template <typename T>
+    class power_kernel
+    {
+      public:
+        /**
+         * Square of a number
+         * @param p_op number to square
+         * @return p_op * p_op
+         */
+        static
+        ext_uint<T> square(const ext_uint<T> & p_op);
+
+        /**
+         * Product of two numbers
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @return p_op1 * p_op2
+         */
+        static
+        ext_uint<T> multiply(const ext_uint<T> & p_op1
+                            ,const ext_uint<T> & p_op2
+                            );
+
+        /**
+         * Power of a number, 0 ^ 0 being 1
+         * @param p_base base
+         * @param p_exponent exponent
+         * @return p_base ^ p_exponent
+         */
+        static
+        ext_uint<T> pow(const ext_uint<T> & p_base
+                       ,uint64_t p_exponent
+                       );
+
+        /**
+         * Floor of k-th root
+         * @param p_op number
+         * @param p_degree k, non null
+         * @return greatest r such that r ^ k <= p_op
+         */
+        static
+        ext_uint<T> iroot(const ext_uint<T> & p_op
+                         ,unsigned int p_degree
+                         );
+
+        /**
+         * Indicate if a number is a square. Residues modulo 256, 63, 65
+         * and 11 reject most non squares before square root is computed
+         * @param p_op number
+         * @return true if p_op is a square
+         */
+        static
+        bool is_perfect_square(const ext_uint<T> & p_op);
+
+        /**
+         * Indicate if a number is r ^ k with k >= 2. Each prime degree is
+         * first tested with residues modulo small primes so that roots are
+         * only computed for plausible degrees
+         * @param p_op number
+         * @param p_root smallest r such that p_op = r ^ k
+         * @param p_exponent greatest k such that p_op = r ^ k, 0 and 1 being
+         * powers of any degree 2 is reported for them
+         * @return true if p_op is a perfect power
+         */
+        static
+        bool is_perfect_power(const ext_uint<T> & p_op
+                             ,ext_uint<T> & p_root
+                             ,unsigned int & p_exponent
+                             );
+
+      private:
+        /**
+         * Floating point estimation of k-th root
+         * @param p_op number
+         * @param p_degree k
+         * @return estimation of root, accurate to some units in last place
+         * of a double
+         */
+        static
+        double estimate_root(const ext_uint<T> & p_op
+                            ,unsigned int p_degree
+                            );
+
+        /**
+         * Floor of k-th root lower than 2 ^ m_max_estimate_bits
+         * @param p_op number
+         * @param p_degree k
+         * @return greatest r such that r ^ k <= p_op
+         */
+        static
+        ext_uint<T> small_root(const ext_uint<T> & p_op
+                              ,unsigned int p_degree
+                              );
+
+        /**
+         * Remainder of division by a small modulus
+         * @param p_op number
+         * @param p_modulus non null modulus
+         * @return p_op mod p_modulus
+         */
+        static
+        uint64_t get_residue(const ext_uint<T> & p_op
+                            ,uint64_t p_modulus
+                            );
+
+        /**
+         * Modular exponentiation with modulus lower than 2 ^ 32
+         */
+        static
+        uint64_t pow_mod(uint64_t p_base
+                        ,uint64_t p_exponent
+                        ,uint64_t p_modulus
+                        );
+
+        /**
+         * Trial division primality test for numbers lower than 2 ^ 32
+         */
+        static
+        bool is_small_prime(uint64_t p_value);
+
+        /**
+         * Check that p_op is a k-th power residue modulo some primes q such
+         * that q = 1 mod k, which is necessary for p_op to be a k-th power
+         * @param p_op number
+         * @param p_degree prime k
+         * @return false if p_op is not a k-th power
+         */
+        static
+        bool is_power_residue(const ext_uint<T> & p_op
+                             ,unsigned int p_degree
+                             );
+
+        /**
+         * Roots below this number of bits are computed from floating point
+         * estimation
+         */
+        static constexpr unsigned int m_max_estimate_bits = 32;
+
+        /**
+         * Number of primes used by power residue test
+         */
+        static constexpr unsigned int m_nb_residue_tests = 6;
+    };
+
+    /**
+     * Power of a number, 0 ^ 0 being 1
+     * @param p_base base
+     * @param p_exponent exponent
+     * @return p_base ^ p_exponent
+     */
+    template <typename T>
+    ext_uint<T> pow(const ext_uint<T> & p_base
+                   ,uint64_t p_exponent
+                   );
+
+    /**
+     * Power of a signed number, 0 ^ 0 being 1
+     * @param p_base base
+     * @param p_exponent exponent
+     * @return p_base ^ p_exponent
+     */
+    template <typename T>
+    ext_int<T> pow(const ext_int<T> & p_base
+                  ,uint64_t p_exponent
+                  );
+
+    /**
+     * Floor of square root
+     * @param p_op number
+     * @return greatest r such that r * r <= p_op
+     */
+    template <typename T>
+    ext_uint<T> isqrt(const ext_uint<T> & p_op);
+
+    /**
+     * Floor of k-th root
+     * @param p_op number
+     * @param p_degree k, non null
+     * @return greatest r such that r ^ k <= p_op
+     */
+    template <typename T>
+    ext_uint<T> iroot(const ext_uint<T> & p_op
+                     ,unsigned int p_degree
+                     );
+
+    /**
+     * Indicate if a number is a square
+     * @param p_op number
+     * @return true if p_op is a square
+     */
+    template <typename T>
+    bool is_perfect_square(const ext_uint<T> & p_op);
+
+    /**
+     * Indicate if a number is r ^ k with k >= 2
+     * @param p_op number
+     * @param p_root smallest r such that p_op = r ^ k
+     * @param p_exponent greatest k such that p_op = r ^ k
+     * @return true if p_op is a perfect power
+     */
+    template <typename T>
+    bool is_perfect_power(const ext_uint<T> & p_op
+                         ,ext_uint<T> & p_root
+                         ,unsigned int & p_exponent
+                         );
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    power_kernel<T>::square(const ext_uint<T> & p_op)
+    {
+        const std::vector<T> & l_ext = p_op.get_extension();
+        size_t l_size = l_ext.size();
+        if(1 == l_size && !l_ext[0])
+        {
+            return ext_uint<T>();
+        }
+        std::vector<T> l_result(2 * l_size);
+        if(ntt_multiplier<T>::is_applicable(l_size, l_size))
+        {
+            ntt_multiplier<T>::mul(l_result.data(), l_ext.data(), l_size, l_ext.data(), l_size);
+        }
+        else
+        {
+            limb_kernel<T>::sqr(l_result.data(), l_ext.data(), l_size);
+        }
+        return ext_uint<T>::from_limbs(l_result.data(), limb_kernel<T>::significant_size(l_result.data(), l_result.size()));
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    power_kernel<T>::multiply(const ext_uint<T> & p_op1
+                             ,const ext_uint<T> & p_op2
+                             )
+    {
+        const std::vector<T> & l_ext1 = p_op1.get_extension();
+        const std::vector<T> & l_ext2 = p_op2.get_extension();
+        if((1 == l_ext1.size() && !l_ext1[0]) || (1 == l_ext2.size() && !l_ext2[0]))
+        {
+            return ext_uint<T>();
+        }
+        std::vector<T> l_result(l_ext1.size() + l_ext2.size());
+        if(ntt_multiplier<T>::is_applicable(l_ext1.size(), l_ext2.size()))
+        {
+            ntt_multiplier<T>::mul(l_result.data(), l_ext1.data(), l_ext1.size(), l_ext2.data(), l_ext2.size());
+        }
+        else
+        {
+            limb_kernel<T>::mul(l_result.data(), l_ext1.data(), l_ext1.size(), l_ext2.data(), l_ext2.size());
+        }
+        return ext_uint<T>::from_limbs(l_result.data(), limb_kernel<T>::significant_size(l_result.data(), l_result.size()));
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    power_kernel<T>::pow(const ext_uint<T> & p_base
+                        ,uint64_t p_exponent
+                        )
+    {
+        if(!p_exponent)
+        {
+            return ext_uint<T>({1});
+        }
+        if(!p_base)
+        {
+            return ext_uint<T>();
+        }
+        // Factor of two of base becomes a shift
+        size_t l_base_shift = p_base.ctz();
+        if(l_base_shift && p_exponent > std::numeric_limits<size_t>::max() / l_base_shift)
+        {
+            throw quicky_exception::quicky_logic_exception("ext_uint power is too big", __LINE__, __FILE__);
+        }
+        ext_uint<T> l_odd_base(p_base);
+        l_odd_base.shr(l_base_shift);
+        ext_uint<T> l_result({1});
+        if(ext_uint<T>({1}) != l_odd_base)
+        {
+            unsigned int l_bit = 63 - (unsigned int)limb_kernel<uint64_t>::count_leading_zeros(p_exponent);
+            l_result = l_odd_base;
+            while(l_bit)
+            {
+                --l_bit;
+                l_result = square(l_result);
+                if((p_exponent >> l_bit) & 1)
+                {
+                    l_result = multiply(l_result, l_odd_base);
+                }
+            }
+        }
+        return l_result.shl(l_base_shift * p_exponent);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    power_kernel<T>::iroot(const ext_uint<T> & p_op
+                          ,unsigned int p_degree
+                          )
+    {
+        if(!p_degree)
+        {
+            throw quicky_exception::quicky_logic_exception("ext_uint root of degree 0", __LINE__, __FILE__);
+        }
+        size_t l_bit_length = p_op.bit_length();
+        if(1 == p_degree || l_bit_length < 2)
+        {
+            return p_op;
+        }
+        // p_op < 2 ^ degree so root is 1
+        if(l_bit_length <= p_degree)
+        {
+            return ext_uint<T>({1});
+        }
+        if((l_bit_length + p_degree - 1) / p_degree <= m_max_estimate_bits)
+        {
+            return small_root(p_op, p_degree);
+        }
+        // Root of upper part gives an overestimate accurate to half of bits:
+        // (s + 1) ^ k > p_op >> (k * h) implies ((s + 1) << h) ^ k > p_op
+        size_t l_shift = l_bit_length / p_degree / 2;
+        ext_uint<T> l_upper(p_op);
+        l_upper.shr(l_shift * p_degree);
+        ext_uint<T> l_root = iroot(l_upper, p_degree) + ext_uint<T>({1});
+        l_root.shl(l_shift);
+        ext_uint<T> l_degree((uint32_t)p_degree);
+        ext_uint<T> l_degree_minus_1((uint32_t)(p_degree - 1));
+        while(true)
+        {
+            ext_uint<T> l_next = p_op / pow(l_root, p_degree - 1);
+            l_next = (l_next + multiply(l_root, l_degree_minus_1)) / l_degree;
+            if(l_next >= l_root)
+            {
+                return l_root;
+            }
+            l_root = std::move(l_next);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    power_kernel<T>::is_perfect_square(const ext_uint<T> & p_op)
+    {
+        if(!p_op)
+        {
+            return true;
+        }
+        // Squares modulo 256, 63, 65 and 11
+        struct square_residues
+        {
+            square_residues()
+            {
+                for(unsigned int l_index = 0; l_index < 256; ++l_index)
+                {
+                    m_mod_256[(l_index * l_index) % 256] = true;
+                    m_mod_63[(l_index * l_index) % 63] = true;
+                    m_mod_65[(l_index * l_index) % 65] = true;
+                    m_mod_11[(l_index * l_index) % 11] = true;
+                }
+            }
+            bool m_mod_256[256] = {};
+            bool m_mod_63[63] = {};
+            bool m_mod_65[65] = {};
+            bool m_mod_11[11] = {};
+        };
+        static const square_residues l_residues;
+        if(!l_residues.m_mod_256[p_op.get_extension()[0] & 0xFF])
+        {
+            return false;
+        }
+        uint64_t l_residue = get_residue(p_op, 63 * 65 * 11);
+        if(!l_residues.m_mod_63[l_residue % 63] || !l_residues.m_mod_65[l_residue % 65] || !l_residues.m_mod_11[l_residue % 11])
+        {
+            return false;
+        }
+        return square(iroot(p_op, 2)) == p_op;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    power_kernel<T>::is_perfect_power(const ext_uint<T> & p_op
+                                     ,ext_uint<T> & p_root
+                                     ,unsigned int & p_exponent
+                                     )
+    {
+        if(p_op.bit_length() < 2)
+        {
+            p_root = p_op;
+            p_exponent = 2;
+            return true;
+        }
+        // Primes lower than bit length are candidate degrees
+        size_t l_bit_length = p_op.bit_length();
+        std::vector<bool> l_composite(l_bit_length + 1, false);
+        ext_uint<T> l_current(p_op);
+        p_exponent = 1;
+        // Residues modulo two fixed primes check small roots candidates
+        const uint64_t l_moduli[2] = {4294967291u, 4294967279u};
+        uint64_t l_residue = get_residue(l_current, l_moduli[0] * l_moduli[1]);
+        for(unsigned int l_degree = 2; l_degree < l_current.bit_length(); ++l_degree)
+        {
+            if(l_composite[l_degree])
+            {
+                continue;
+            }
+            for(size_t l_multiple = 2 * (size_t)l_degree; l_multiple <= l_bit_length; l_multiple += l_degree)
+            {
+                l_composite[l_multiple] = true;
+            }
+            // Same degree is tried again on root
+            while(l_degree < l_current.bit_length())
+            {
+                ext_uint<T> l_root;
+                if((l_current.bit_length() + l_degree - 1) / l_degree <= m_max_estimate_bits)
+                {
+                    // Exact roots are integers so rounding estimation is enough
+                    uint64_t l_estimate = (uint64_t)std::llround(estimate_root(l_current, l_degree));
+                    if(pow_mod(l_estimate, l_degree, l_moduli[0]) != l_residue % l_moduli[0] || pow_mod(l_estimate, l_degree, l_moduli[1]) != l_residue % l_moduli[1])
+                    {
+                        break;
+                    }
+                    l_root = ext_uint<T>(l_estimate);
+                }
+                else
+                {
+                    if(!is_power_residue(l_current, l_degree))
+                    {
+                        break;
+                    }
+                    l_root = iroot(l_current, l_degree);
+                }
+                if(pow(l_root, l_degree) != l_current)
+                {
+                    break;
+                }
+                l_current = std::move(l_root);
+                l_residue = get_residue(l_current, l_moduli[0] * l_moduli[1]);
+                p_exponent *= l_degree;
+            }
+        }
+        p_root = l_current;
+        return p_exponent > 1;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    double
+    power_kernel<T>::estimate_root(const ext_uint<T> & p_op
+                                  ,unsigned int p_degree
+                                  )
+    {
+        int64_t l_exponent;
+        double l_mantissa = p_op.to_mantissa_exp(l_exponent);
+        // Integer part of exponent division is applied exactly
+        int64_t l_quotient = l_exponent / p_degree;
+        int64_t l_remainder = l_exponent % p_degree;
+        return std::ldexp(std::exp2((l_remainder + std::log2(l_mantissa)) / p_degree), (int)l_quotient);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    power_kernel<T>::small_root(const ext_uint<T> & p_op
+                               ,unsigned int p_degree
+                               )
+    {
+        ext_uint<T> l_root((uint64_t)estimate_root(p_op, p_degree));
+        ext_uint<T> l_one({1});
+        while(l_root && pow(l_root, p_degree) > p_op)
+        {
+            l_root = l_root - l_one;
+        }
+        while(pow(l_root + l_one, p_degree) <= p_op)
+        {
+            l_root = l_root + l_one;
+        }
+        return l_root;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    uint64_t
+    power_kernel<T>::get_residue(const ext_uint<T> & p_op
+                                ,uint64_t p_modulus
+                                )
+    {
+        const std::vector<T> & l_ext = p_op.get_extension();
+        uint64_t l_residue = 0;
+        for(size_t l_index = l_ext.size(); l_index > 0;)
+        {
+            --l_index;
+            l_residue = (uint64_t)(((((unsigned __int128)l_residue) << limb_kernel<T>::m_nb_bits) | l_ext[l_index]) % p_modulus);
+        }
+        return l_residue;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    uint64_t
+    power_kernel<T>::pow_mod(uint64_t p_base
+                            ,uint64_t p_exponent
+                            ,uint64_t p_modulus
+                            )
+    {
+        uint64_t l_result = 1 % p_modulus;
+        p_base %= p_modulus;
+        while(p_exponent)
+        {
+            if(p_exponent & 1)
+            {
+                l_result = l_result * p_base % p_modulus;
+            }
+            p_base = p_base * p_base % p_modulus;
+            p_exponent >>= 1;
+        }
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    power_kernel<T>::is_small_prime(uint64_t p_value)
+    {
+        if(p_value < 2)
+        {
+            return false;
+        }
+        for(uint64_t l_divisor = 2; l_divisor * l_divisor <= p_value; ++l_divisor)
+        {
+            if(!(p_value % l_divisor))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    power_kernel<T>::is_power_residue(const ext_uint<T> & p_op
+                                     ,unsigned int p_degree
+                                     )
+    {
+        // p_op ^ ((q - 1) / k) mod q is 0 or 1 for a k-th power. Residues
+        // are computed modulo product of two primes to halve passes on limbs
+        uint64_t l_moduli[2];
+        unsigned int l_nb_moduli = 0;
+        unsigned int l_nb_tests = 0;
+        for(uint64_t l_modulus = 2 * (uint64_t)p_degree + 1; l_nb_tests < m_nb_residue_tests && l_modulus < (((uint64_t)1) << 32); l_modulus += 2 * (uint64_t)p_degree)
+        {
+            if(!is_small_prime(l_modulus))
+            {
+                continue;
+            }
+            ++l_nb_tests;
+            l_moduli[l_nb_moduli++] = l_modulus;
+            if(2 == l_nb_moduli || m_nb_residue_tests == l_nb_tests)
+            {
+                uint64_t l_residue = get_residue(p_op, 2 == l_nb_moduli ? l_moduli[0] * l_moduli[1] : l_moduli[0]);
+                for(unsigned int l_index = 0; l_index < l_nb_moduli; ++l_index)
+                {
+                    uint64_t l_prime_residue = l_residue % l_moduli[l_index];
+                    if(l_prime_residue && 1 != pow_mod(l_prime_residue, (l_moduli[l_index] - 1) / p_degree, l_moduli[l_index]))
+                    {
+                        return false;
+                    }
+                }
+                l_nb_moduli = 0;
+            }
+        }
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    pow(const ext_uint<T> & p_base
+       ,uint64_t p_exponent
+       )
+    {
+        return power_kernel<T>::pow(p_base, p_exponent);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_int<T>
+    pow(const ext_int<T> & p_base
+       ,uint64_t p_exponent
+       )
+    {
+        typedef typename std::make_unsigned<T>::type t_limb;
+        bool l_negative = p_base.get_root() < 0;
+        ext_int<T> l_result(power_kernel<t_limb>::pow(ext_uint<t_limb>(l_negative ? -p_base : p_base), p_exponent));
+        return l_negative && (p_exponent & 1) ? -l_result : l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    isqrt(const ext_uint<T> & p_op)
+    {
+        return power_kernel<T>::iroot(p_op, 2);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    iroot(const ext_uint<T> & p_op
+         ,unsigned int p_degree
+         )
+    {
+        return power_kernel<T>::iroot(p_op, p_degree);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    is_perfect_square(const ext_uint<T> & p_op)
+    {
+        return power_kernel<T>::is_perfect_square(p_op);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    is_perfect_power(const ext_uint<T> & p_op
+                    ,ext_uint<T> & p_root
+                    ,unsigned int & p_exponent
+                    )
+    {
+        return power_kernel<T>::is_perfect_power(p_op, p_root, p_exponent);
+    }
+
+#ifdef QUICKY_UTILS_SELF_TEST
+    /**
+     * Method regrouping tests of powers and roots
+     */
+    bool
+    test_ext_power();
+#endif // QUICKY_UTILS_SELF_TEST
+}
+#endif //QUICKY_UTILS_EXT_POWER_H
+// EOF
@@ -21,9 +21,20 @@
 #include "quicky_exception.h"
 #include "ext_int.h"
 #include "type_string.h"
+#include "limb_kernel.h"
+#include "ntt_multiplier.h"
+#include "bignum_thread_pool.h"
 #include <vector>
+#include <deque>
+#include <functional>
+#include <array>
+#include <mutex>
+#include <string>
 #include <cstdio>
+#include <cstring>
 #include <cassert>
+#include <cmath>
+#include <limits>
 #include <iomanip>
 #include <sstream>
 #include <type_traits>
@@ -58,9 +69,9 @@ namespace quicky_utils
         ext_uint();
 
         /**
-         * Move constructor
+         * Move constructor, moved object becomes null
          */
-        ext_uint(const ext_uint && p_value)noexcept;
+        ext_uint(ext_uint && p_value)noexcept;
 
         /**
          * Copy constructor
@@ -91,6 +102,20 @@ namespace quicky_utils
 #endif // EXT_INT_DISABLE_EXPLICIT
         ext_uint(const uint64_t & p_value);
 
+        /**
+         * Constructor from double, fractional part is truncated
+         * @param p_value finite value greater than -1
+         */
+        explicit
+        ext_uint(const double & p_value);
+
+        /**
+         * Constructor from float, fractional part is truncated
+         * @param p_value finite value greater than -1
+         */
+        explicit
+        ext_uint(const float & p_value);
+
         /**
          * Constructor from ext_uint
          * @param T
@@ -115,6 +140,17 @@ namespace quicky_utils
 #endif // EXT_INT_DISABLE_EXPLICIT
         operator double() const;
 
+        /**
+         * Split number like frexp after rounding it to nearest floating
+         * value, ties to even. Unlike conversion operators it does not
+         * overflow for numbers out of floating type range
+         * @tparam FLOATING_TYPE float or double
+         * @param p_exponent exponent e such that number ~ mantissa * 2 ^ e
+         * @return mantissa in [0.5, 1[, 0 for null number
+         */
+        template <typename FLOATING_TYPE = double>
+        FLOATING_TYPE to_mantissa_exp(int64_t & p_exponent) const;
+
         /**
          * Accessor returning number of words composing type
          * @return number of word composing type
@@ -148,7 +184,7 @@ namespace quicky_utils
                   );
 
         /**
-         * Move assignment operator
+         * Move assignment operator, moved object becomes null
          * @param p_op value to move
          * @return assigned object
          */
@@ -161,6 +197,14 @@ namespace quicky_utils
          */
         ext_uint<T> & operator=(const ext_uint<T> & p_op);
 
+        /**
+         * Three-way comparison shared by relational operators
+         * @param p_op operand to compare with
+         * @return -1, 0 or 1 if this is lower, equal or greater than p_op
+         */
+        int
+        compare(const ext_uint & p_op) const;
+
         bool
         operator==(const ext_uint & p_op) const;
 
@@ -234,7 +278,100 @@ namespace quicky_utils
         operator std::string() const;
 
         /**
-         * Helper method used in / and % operator
+         * Representation of number in a given base. Big numbers are split
+         * recursively using cached powers of the base
+         * @param p_base base in range [2,36]
+         * @return string representation using lowercase digits
+         */
+        [[nodiscard]]
+        std::string to_string(unsigned int p_base = 10) const;
+
+        /**
+         * Build number from its representation in a given base. Big strings
+         * are split recursively using cached powers of the base
+         * @param p_string digits, case insensitive
+         * @param p_base base in range [2,36]
+         * @return number represented by string
+         */
+        static
+        ext_uint from_string(const std::string & p_string
+                            ,unsigned int p_base = 10
+                            );
+
+        /**
+         * Build number from little endian limbs
+         * @param p_limbs limbs, least significant first
+         * @param p_size number of limbs
+         * @return number represented by limbs
+         */
+        static
+        ext_uint from_limbs(const T * p_limbs
+                           ,size_t p_size
+                           );
+
+        /**
+         * Compute quotient and remainder using limb level long division
+         * @param p_num numerator
+         * @param p_den non null denominator
+         * @param p_quotient quotient
+         * @param p_remainder remainder
+         */
+        static
+        void divrem(const ext_uint & p_num
+                   ,const ext_uint & p_den
+                   ,ext_uint & p_quotient
+                   ,ext_uint & p_remainder
+                   );
+
+        /**
+         * Shift number to the left in place
+         * @param p_shift number of bits to shift
+         * @return shifted object
+         */
+        ext_uint & shl(size_t p_shift);
+
+        /**
+         * Shift number to the right in place
+         * @param p_shift number of bits to shift
+         * @return shifted object
+         */
+        ext_uint & shr(size_t p_shift);
+
+        /**
+         * Number of bits necessary to represent number
+         * @return index of most significant set bit + 1, 0 if number is null
+         */
+        [[nodiscard]]
+        size_t bit_length() const;
+
+        /**
+         * Check bit located at p_index
+         * @param p_index index of bit, 0 being the least significant one
+         * @return true if bit is set
+         */
+        [[nodiscard]]
+        bool test_bit(size_t p_index) const;
+
+        /**
+         * Set or clear bit located at p_index, extending number if needed
+         * @param p_index index of bit, 0 being the least significant one
+         * @param p_value new value of bit
+         * @return modified object
+         */
+        ext_uint & set_bit(size_t p_index
+                          ,bool p_value = true
+                          );
+
+        /**
+         * Count trailing zero bits of a non null number
+         * @return index of least significant set bit
+         */
+        [[nodiscard]]
+        size_t ctz() const;
+
+        /**
+         * Division by dichotomy. Operators / and % rely on limb level
+         * long division instead
          * @param p_op operand for division
          * @param p_compute_mult indicate if mult should be computed
          * @param p_mult value or returned result * p_op
@@ -259,6 +396,17 @@ namespace quicky_utils
          */
         ext_uint<T> & trim();
 
+        /**
+         * Convert shift operand to a bit count
+         * @param p_op shift operand
+         * @param p_shift bit count
+         * @return false if operand does not fit in size_t
+         */
+        static
+        bool get_shift(const ext_uint & p_op
+                      ,size_t & p_shift
+                      );
+
 
         /**
          * Constuctor form a vector
@@ -296,29 +444,82 @@ namespace quicky_utils
                      std::vector<T> & p_vector
                     );
 
+        /**
+         * Check that base is supported by string conversions
+         * @param p_base base to check
+         */
+        static
+        void check_base(unsigned int p_base);
+
+        /**
+         * Number of digits of p_base that can be stored in a limb
+         * @param p_base base of representation
+         * @return number of digits
+         */
+        static
+        unsigned int get_chunk_digits(unsigned int p_base);
+
+        /**
+         * Return p_base ^ (get_chunk_digits(p_base) * 2 ^ p_level). Values
+         * are computed once and kept for all further conversions
+         * @param p_base base of representation
+         * @param p_level level in power table
+         * @return power of base
+         */
+        static
+        const ext_uint & get_power(unsigned int p_base
+                                  ,unsigned int p_level
+                                  );
+
+        /**
+         * Recursive part of from_string
+         * @param p_digits pointer on first digit
+         * @param p_size number of digits
+         * @param p_base base of representation
+         * @return number represented by digits
+         */
+        static
+        ext_uint from_digits(const char * p_digits
+                            ,size_t p_size
+                            ,unsigned int p_base
+                            );
+
+        /**
+         * Recursive part of to_string
+         * @param p_result string where digits are appended
+         * @param p_width minimum number of digits to generate, 0 means no padding
+         * @param p_base base of representation
+         */
+        void to_digits(std::string & p_result
+                      ,size_t p_width
+                      ,unsigned int p_base
+                      ) const;
+
+        /**
+         * Number of limbs under which string conversions use quadratic
+         * algorithm instead of splitting number
+         */
+        static constexpr size_t m_conversion_threshold = 32;
+
         static void partial_mult(const T & p_op1,
                                  const T & p_op2,
                                  T & p_result_low,
                                  T & p_result_high
                                 );
 
-        template <typename FLOATING_TYPE, typename MANTISSA_TYPE, typename std::enable_if< sizeof(FLOATING_TYPE) <= sizeof(T), int>::type = 0>
-        FLOATING_TYPE
-        extract_mantissa() const;
-        template <typename FLOATING_TYPE, typename MANTISSA_TYPE, typename std::enable_if< sizeof(T) < sizeof(FLOATING_TYPE), int>::type = 0>
-        FLOATING_TYPE
-        extract_mantissa() const;
-
-       template <typename FLOATING_TYPE, typename MANTISSA_TYPE>
-        FLOATING_TYPE complete_mantissa(MANTISSA_TYPE p_mantissa
-                                        ,size_t p_index
-                                       ) const;
+        /**
+         * Common part of floating constructors
+         * @tparam FLOATING_TYPE float or double
+         * @param p_value finite value greater than -1
+         */
+        template <typename FLOATING_TYPE>
+        void from_floating(FLOATING_TYPE p_value);
 
-        template <typename FLOATING_TYPE, typename MANTISSA_TYPE>
-        static
-        FLOATING_TYPE add_exponent(FLOATING_TYPE & p_floating
-                                  ,int p_add
-                                  );
+        /**
+         * Number of significant limbs, 0 for null number
+         */
+        [[nodiscard]]
+        size_t get_significant_size() const;
 
         static_assert(std::is_unsigned<T>::value,"Ckeck base type is unsigned");
 
@@ -338,10 +539,12 @@ namespace quicky_utils
 
     //-----------------------------------------------------------------------------
     template <typename T>
-    ext_uint<T>::ext_uint(const ext_uint<T> && p_value) noexcept:
+    ext_uint<T>::ext_uint(ext_uint<T> && p_value) noexcept:
             m_ext(std::move(p_value.m_ext))
     {
-
+        // Moved object stays a valid null number as members rely on at
+        // least one limb
+        p_value.m_ext.assign(1, 0);
     }
 
     //-----------------------------------------------------------------------------
@@ -415,18 +618,77 @@ namespace quicky_utils
         return m_ext.back();
     }
 
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>::ext_uint(const double & p_value)
+    {
+        from_floating(p_value);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>::ext_uint(const float & p_value)
+    {
+        from_floating(p_value);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <typename FLOATING_TYPE>
+    void
+    ext_uint<T>::from_floating(FLOATING_TYPE p_value)
+    {
+        if(!std::isfinite(p_value) || p_value <= -1)
+        {
+            throw quicky_exception::quicky_logic_exception("Floating value " + std::to_string(p_value) + " cannot be converted to ext_uint", __LINE__, __FILE__);
+        }
+        m_ext.assign(1, 0);
+        if(p_value < 1)
+        {
+            return;
+        }
+        // Integer part fits in digits bits once scaled, remaining scale is a shift
+        constexpr int l_digits = std::numeric_limits<FLOATING_TYPE>::digits;
+        int l_exponent;
+        FLOATING_TYPE l_mantissa = std::frexp(p_value, &l_exponent);
+        uint64_t l_integer = (uint64_t)std::ldexp(l_mantissa, std::min(l_exponent, l_digits));
+        m_ext.clear();
+        extract<uint64_t>(l_integer, m_ext);
+        if(l_exponent > l_digits)
+        {
+            shl(l_exponent - l_digits);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    size_t
+    ext_uint<T>::get_significant_size() const
+    {
+        return m_ext.back() ? m_ext.size() : 0;
+    }
+
     //-------------------------------------------------------------------------
     template <typename T>
     ext_uint<T>::operator float() const
     {
-        return extract_mantissa<float, uint32_t>();
+        return limb_kernel<T>::template to_floating<float>([this](size_t p_index){return m_ext[p_index];}, get_significant_size());
     }
 
     //-------------------------------------------------------------------------
     template <typename T>
     ext_uint<T>::operator double() const
     {
-        return extract_mantissa<double,uint64_t>();
+        return limb_kernel<T>::template to_floating<double>([this](size_t p_index){return m_ext[p_index];}, get_significant_size());
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <typename FLOATING_TYPE>
+    FLOATING_TYPE
+    ext_uint<T>::to_mantissa_exp(int64_t & p_exponent) const
+    {
+        return limb_kernel<T>::template to_mantissa_exp<FLOATING_TYPE>([this](size_t p_index){return m_ext[p_index];}, get_significant_size(), p_exponent);
     }
 
 
@@ -488,7 +750,10 @@ namespace quicky_utils
     ext_uint<T> &
     ext_uint<T>::operator=(ext_uint<T> && p_op) noexcept
     {
-        m_ext = std::move(p_op.m_ext);
+        // Moved object reuses storage of assigned one to stay a valid null
+        // number
+        m_ext.swap(p_op.m_ext);
+        p_op.m_ext.assign(1, 0);
         return *this;
     }
 
@@ -501,26 +766,20 @@ namespace quicky_utils
         return *this;
     }
 
+    //-----------------------------------------------------------------------------
+    template <typename T>
+    int
+    ext_uint<T>::compare(const ext_uint & p_op) const
+    {
+        return limb_kernel<T>::compare(m_ext.data(), m_ext.size(), p_op.m_ext.data(), p_op.m_ext.size());
+    }
+
     //-----------------------------------------------------------------------------
     template <typename T>
     bool
     ext_uint<T>::operator==(const ext_uint & p_op) const
     {
-        if(m_ext.size() != p_op.m_ext.size())
-        {
-            return false;
-        }
-        else
-        {
-            for(unsigned int l_index = 0;
-                l_index < m_ext.size();
-                ++l_index
-               )
-            {
-                if(m_ext[l_index] != p_op.m_ext[l_index]) return false;
-            }
-        }
-        return true;
+        return compare(p_op) == 0;
     }
 
     //-----------------------------------------------------------------------------
@@ -528,21 +787,7 @@ namespace quicky_utils
     bool
     ext_uint<T>::operator!=(const ext_uint & p_op) const
     {
-        if(m_ext.size() != p_op.m_ext.size())
-        {
-            return true;
-        }
-        else
-        {
-            for(unsigned int l_index = 0;
-                l_index < m_ext.size();
-                ++l_index
-                    )
-            {
-                if(m_ext[l_index] != p_op.m_ext[l_index]) return true;
-            }
-        }
-        return false;
+        return compare(p_op) != 0;
     }
 
     //-----------------------------------------------------------------------------
@@ -550,21 +795,7 @@ namespace quicky_utils
     bool
     ext_uint<T>::operator<(const ext_uint & p_op) const
     {
-        if (m_ext.size() != p_op.m_ext.size())
-        {
-            return m_ext.size() < p_op.m_ext.size();
-        }
-        assert(m_ext.size());
-        size_t l_index = m_ext.size() - 1;
-        while (l_index < m_ext.size())
-        {
-            if (m_ext[l_index] != p_op.m_ext[l_index])
-            {
-                return m_ext[l_index] < p_op.m_ext[l_index];
-            }
-            --l_index;
-        }
-        return false;
+        return compare(p_op) < 0;
     }
 
     //-----------------------------------------------------------------------------
@@ -572,43 +803,15 @@ namespace quicky_utils
     bool
     ext_uint<T>::operator>(const ext_uint & p_op) const
     {
-        if (m_ext.size() != p_op.m_ext.size())
-        {
-            return m_ext.size() > p_op.m_ext.size();
-        }
-        assert(m_ext.size());
-        size_t l_index = m_ext.size() - 1;
-        while (l_index < m_ext.size())
-        {
-            if (m_ext[l_index] != p_op.m_ext[l_index])
-            {
-                return m_ext[l_index] > p_op.m_ext[l_index];
-            }
-            --l_index;
-        }
-        return false;
-     }
+        return compare(p_op) > 0;
+    }
 
     //-----------------------------------------------------------------------------
     template <typename T>
     bool
     ext_uint<T>::operator<=(const ext_uint & p_op) const
     {
-        if (m_ext.size() != p_op.m_ext.size())
-        {
-            return m_ext.size() < p_op.m_ext.size();
-        }
-        assert(m_ext.size());
-        size_t l_index = m_ext.size() - 1;
-        while (l_index < m_ext.size())
-        {
-            if (m_ext[l_index] != p_op.m_ext[l_index])
-            {
-                return m_ext[l_index] <= p_op.m_ext[l_index];
-            }
-            --l_index;
-        }
-        return true;
+        return compare(p_op) <= 0;
     }
 
     //-----------------------------------------------------------------------------
@@ -616,21 +819,7 @@ namespace quicky_utils
     bool
     ext_uint<T>::operator>=(const ext_uint & p_op) const
     {
-        if (m_ext.size() != p_op.m_ext.size())
-        {
-            return m_ext.size() > p_op.m_ext.size();
-        }
-        assert(m_ext.size());
-        size_t l_index = m_ext.size() - 1;
-        while (l_index < m_ext.size())
-        {
-            if (m_ext[l_index] != p_op.m_ext[l_index])
-            {
-                return m_ext[l_index] >= p_op.m_ext[l_index];
-            }
-            --l_index;
-        }
-        return true;
+        return compare(p_op) >= 0;
     }
 
     //-----------------------------------------------------------------------------
@@ -765,6 +954,12 @@ namespace quicky_utils
         size_t l_new_size = m_ext.size() + p_op.m_ext.size();
         std::vector<T> l_new_ext(l_new_size,0);
 
+        if(ntt_multiplier<T>::is_applicable(m_ext.size(), p_op.m_ext.size()))
+        {
+            ntt_multiplier<T>::mul(l_new_ext.data(), m_ext.data(), m_ext.size(), p_op.m_ext.data(), p_op.m_ext.size());
+            return ext_uint(l_new_ext, false).trim();
+        }
+
         // 12345
         // ABCDE
         // E1 E2 E3 E5
@@ -899,11 +1094,17 @@ namespace quicky_utils
         {
             return ext_uint();
         }
-        ext_uint<T> l_mult;
-        return div(p_op,
-                   false,
-                   l_mult
-                  );
+        bignum_workspace<T> & l_workspace = bignum_workspace<T>::get();
+        typename bignum_workspace<T>::buffer l_quotient = l_workspace.acquire(m_ext.size() - p_op.m_ext.size() + 1);
+        typename bignum_workspace<T>::buffer l_remainder = l_workspace.acquire(p_op.m_ext.size());
+        limb_kernel<T>::divrem(l_quotient.data()
+                              ,l_remainder.data()
+                              ,m_ext.data()
+                              ,m_ext.size()
+                              ,p_op.m_ext.data()
+                              ,p_op.m_ext.size()
+                              );
+        return from_limbs(l_quotient.data(), l_quotient.size());
     }
 
     //-------------------------------------------------------------------------
@@ -937,12 +1138,17 @@ namespace quicky_utils
         {
             return *this;
         }
-        ext_uint<T> l_mult;
-        div(p_op,
-            true,
-            l_mult
-           );
-        return (*this - l_mult).trim();
+        bignum_workspace<T> & l_workspace = bignum_workspace<T>::get();
+        typename bignum_workspace<T>::buffer l_quotient = l_workspace.acquire(m_ext.size() - p_op.m_ext.size() + 1);
+        typename bignum_workspace<T>::buffer l_remainder = l_workspace.acquire(p_op.m_ext.size());
+        limb_kernel<T>::divrem(l_quotient.data()
+                              ,l_remainder.data()
+                              ,m_ext.data()
+                              ,m_ext.size()
+                              ,p_op.m_ext.data()
+                              ,p_op.m_ext.size()
+                              );
+        return from_limbs(l_remainder.data(), l_remainder.size());
     }
 
     //-------------------------------------------------------------------------
@@ -950,43 +1156,13 @@ namespace quicky_utils
     ext_uint<T>
     ext_uint<T>::operator<<(const ext_uint & p_op) const
     {
-        if(p_op.m_ext.size() == 1)
+        size_t l_shift;
+        if(!get_shift(p_op, l_shift))
         {
-            size_t l_additional_ext = p_op.m_ext[0] / (8 * sizeof(T));
-            size_t l_real_shift = p_op.m_ext[0] % (8 * sizeof(T));
-            size_t l_new_size = m_ext.size() + l_additional_ext;
-            std::vector<T> l_new_ext(l_new_size);
-            if(l_real_shift)
-            {
-                T l_apply_shift = 8 * sizeof(T) - l_real_shift;
-                T l_select_mask = (((T)1) << l_real_shift) - 1;
-                T l_reminder = 0;
-                for (size_t l_index = 0;
-                     l_index < m_ext.size();
-                     ++l_index
-                    )
-                {
-                    l_new_ext[l_index + l_additional_ext] = (m_ext[l_index] << l_real_shift) | l_reminder;
-                    l_reminder = (m_ext[l_index] >> l_apply_shift) & l_select_mask;
-                }
-                if(l_reminder)
-                {
-                    l_new_ext.push_back(l_reminder);
-                }
-            }
-            else
-            {
-                for (size_t l_index = 0;
-                     l_index < m_ext.size();
-                     ++l_index
-                    )
-                {
-                    l_new_ext[l_index + l_additional_ext] = m_ext[l_index];
-                }
-            }
-        return ext_uint<T>(l_new_ext, false).trim();
+            throw quicky_exception::quicky_logic_exception("ext_uint shift operand is too large", __LINE__, __FILE__);
         }
-        throw quicky_exception::quicky_logic_exception("ext_uint shift operator works only for single extesion", __LINE__, __FILE__);
+        ext_uint<T> l_result(*this);
+        return l_result.shl(l_shift);
     }
 
     //-------------------------------------------------------------------------
@@ -994,44 +1170,161 @@ namespace quicky_utils
     ext_uint<T>
     ext_uint<T>::operator>>(const ext_uint & p_op) const
     {
-        if(p_op.m_ext.size() == 1)
+        size_t l_shift;
+        if(!get_shift(p_op, l_shift))
         {
-            size_t l_remove_ext = p_op.m_ext[0] / (8 * sizeof(T));
-            size_t l_real_shift = p_op.m_ext[0] % (8 * sizeof(T));
-            if(l_remove_ext >= m_ext.size())
+            return ext_uint<T>();
+        }
+        ext_uint<T> l_result(*this);
+        return l_result.shr(l_shift);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    ext_uint<T>::get_shift(const ext_uint & p_op
+                          ,size_t & p_shift
+                          )
+    {
+        if(p_op.bit_length() > 8 * sizeof(size_t))
+        {
+            return false;
+        }
+        p_shift = 0;
+        for(size_t l_index = p_op.m_ext.size(); l_index > 0; --l_index)
+        {
+            if constexpr(sizeof(T) < sizeof(size_t))
             {
-                return ext_uint();
+                p_shift <<= limb_kernel<T>::m_nb_bits;
             }
-            size_t l_new_size = m_ext.size() - l_remove_ext;
-            std::vector<T> l_new_ext(l_new_size);
-            if(l_real_shift)
-            {
-                T l_apply_shift = 8 * sizeof(T) - l_real_shift;
-                T l_select_mask = (((T)1) << l_real_shift) - 1;
-                T l_reminder = 0;
-                for (size_t l_index = l_new_size - 1;
-                     l_index < l_new_size;
-                     --l_index
+            p_shift |= p_op.m_ext[l_index - 1];
+        }
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    ext_uint<T>::from_limbs(const T * p_limbs
+                           ,size_t p_size
+                           )
+    {
+        if(!p_size)
+        {
+            return ext_uint<T>();
+        }
+        return ext_uint<T>(std::vector<T>(p_limbs, p_limbs + p_size), false).trim();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T> &
+    ext_uint<T>::shl(size_t p_shift)
+    {
+        if(!p_shift || (1 == m_ext.size() && !m_ext[0]))
+        {
+            return *this;
+        }
+        size_t l_limb_shift = p_shift / limb_kernel<T>::m_nb_bits;
+        unsigned int l_bit_shift = p_shift % limb_kernel<T>::m_nb_bits;
+        size_t l_size = m_ext.size();
+        m_ext.resize(l_size + l_limb_shift + (l_bit_shift ? 1 : 0));
+        if(l_limb_shift)
+        {
+            std::memmove(&m_ext[l_limb_shift], &m_ext[0], l_size * sizeof(T));
+            std::fill(m_ext.begin(), m_ext.begin() + l_limb_shift, (T)0);
+        }
+        if(l_bit_shift)
+        {
+            m_ext[l_limb_shift + l_size] = limb_kernel<T>::lshift(&m_ext[l_limb_shift], &m_ext[l_limb_shift], l_size, l_bit_shift);
+        }
+        return trim();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T> &
+    ext_uint<T>::shr(size_t p_shift)
+    {
+        size_t l_limb_shift = p_shift / limb_kernel<T>::m_nb_bits;
+        unsigned int l_bit_shift = p_shift % limb_kernel<T>::m_nb_bits;
+        if(l_limb_shift >= m_ext.size())
+        {
+            m_ext.assign(1, 0);
+            return *this;
+        }
+        size_t l_size = m_ext.size() - l_limb_shift;
+        if(l_limb_shift)
+        {
+            std::memmove(&m_ext[0], &m_ext[l_limb_shift], l_size * sizeof(T));
+        }
+        if(l_bit_shift)
+        {
+            limb_kernel<T>::rshift(&m_ext[0], &m_ext[0], l_size, l_bit_shift);
+        }
+        m_ext.resize(l_size);
+        return trim();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    size_t
+    ext_uint<T>::bit_length() const
+    {
+        if(!m_ext.back())
+        {
+            return 0;
+        }
+        return m_ext.size() * limb_kernel<T>::m_nb_bits - limb_kernel<T>::count_leading_zeros(m_ext.back());
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    ext_uint<T>::test_bit(size_t p_index) const
+    {
+        size_t l_limb = p_index / limb_kernel<T>::m_nb_bits;
+        return l_limb < m_ext.size() && ((m_ext[l_limb] >> (p_index % limb_kernel<T>::m_nb_bits)) & 1u);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T> &
+    ext_uint<T>::set_bit(size_t p_index
+                        ,bool p_value
                         )
-                {
-                    l_new_ext[l_index] =
-                            (m_ext[l_index + l_remove_ext] >> l_real_shift) | (l_reminder << l_apply_shift);
-                    l_reminder = m_ext[l_index + l_remove_ext] & l_select_mask;
-                }
+    {
+        size_t l_limb = p_index / limb_kernel<T>::m_nb_bits;
+        T l_mask = (T)(((T)1) << (p_index % limb_kernel<T>::m_nb_bits));
+        if(p_value)
+        {
+            if(l_limb >= m_ext.size())
+            {
+                m_ext.resize(l_limb + 1, 0);
             }
-            else
+            m_ext[l_limb] |= l_mask;
+        }
+        else if(l_limb < m_ext.size())
+        {
+            m_ext[l_limb] &= (T)~l_mask;
+            trim();
+        }
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    size_t
+    ext_uint<T>::ctz() const
+    {
+        for(size_t l_index = 0; l_index < m_ext.size(); ++l_index)
+        {
+            if(m_ext[l_index])
             {
-                for (size_t l_index = 0;
-                     l_index < l_new_size;
-                     ++l_index
-                        )
-                {
-                    l_new_ext[l_index] = m_ext[l_index + l_remove_ext];
-                }
+                return l_index * limb_kernel<T>::m_nb_bits + limb_kernel<T>::count_trailing_zeros(m_ext[l_index]);
             }
-            return ext_uint<T>(l_new_ext, false).trim();
         }
-        throw quicky_exception::quicky_logic_exception("ext_uint shift operator works only for single extesion", __LINE__, __FILE__);
+        throw quicky_exception::quicky_logic_exception("ext_uint ctz of null number", __LINE__, __FILE__);
     }
 
     //-------------------------------------------------------------------------
@@ -1046,7 +1339,8 @@ namespace quicky_utils
         ext_uint<T> l_max(m_ext);
         do
         {
-            ext_uint<T> l_result = (l_min + l_max) >> ext_uint<T>({1});
+            ext_uint<T> l_result = l_min + l_max;
+            l_result.shr(1);
             p_mult = p_op * l_result;
             if(p_mult > *this)
             {
@@ -1173,143 +1467,292 @@ namespace quicky_utils
 
     //-------------------------------------------------------------------------
     template <typename T>
-    bool
-    ext_uint<T>::is_trimmable() const
+    std::string
+    ext_uint<T>::to_string(unsigned int p_base) const
     {
-        return m_ext.size() > 1 && !m_ext.back();
+        check_base(p_base);
+        std::string l_result;
+        to_digits(l_result, 0, p_base);
+        return l_result;
     }
 
     //-------------------------------------------------------------------------
     template <typename T>
-    ext_uint<T> &
-    ext_uint<T>::trim()
+    ext_uint<T>
+    ext_uint<T>::from_string(const std::string & p_string
+                            ,unsigned int p_base
+                            )
     {
-        while(is_trimmable())
+        check_base(p_base);
+        if(p_string.empty())
         {
-            m_ext.pop_back();
+            throw quicky_exception::quicky_logic_exception("Empty string cannot be converted to ext_uint", __LINE__, __FILE__);
         }
-        return *this;
+        return from_digits(p_string.c_str(), p_string.size(), p_base);
     }
 
     //-------------------------------------------------------------------------
     template <typename T>
-    template <typename FLOATING_TYPE, typename MANTISSA_TYPE, typename std::enable_if< sizeof(FLOATING_TYPE) <= sizeof(T), int>::type>
-    FLOATING_TYPE
-    ext_uint<T>::extract_mantissa() const
+    void
+    ext_uint<T>::divrem(const ext_uint & p_num
+                       ,const ext_uint & p_den
+                       ,ext_uint & p_quotient
+                       ,ext_uint & p_remainder
+                       )
     {
-        static_assert(sizeof(MANTISSA_TYPE) >= sizeof(FLOATING_TYPE), "Sizeof MANTISSA_TYPE is unsifficiant to represent FLOATING_TYPE mantissa");
-        assert(m_ext.size());
-        if(1 == m_ext.size())
+        assert(p_den);
+        if(p_num < p_den)
         {
-            return (FLOATING_TYPE)m_ext.back();
+            p_quotient = ext_uint();
+            p_remainder = p_num;
+            return;
         }
-        // Rebuild mantissa with MSB bits
-        if(m_ext.back() > std::numeric_limits<MANTISSA_TYPE>::max())
-          {
-            FLOATING_TYPE l_result = m_ext.back();
-            return add_exponent<FLOATING_TYPE,MANTISSA_TYPE>(l_result, 8 * sizeof(T) * (m_ext.size() - 1));
-          }
-        MANTISSA_TYPE l_mantissa = m_ext.back();
-        unsigned int l_index = m_ext.size() - 2;
-        return complete_mantissa<FLOATING_TYPE,MANTISSA_TYPE>(l_mantissa, l_index);
+        std::vector<T> l_quotient(p_num.m_ext.size() - p_den.m_ext.size() + 1);
+        std::vector<T> l_remainder(p_den.m_ext.size());
+        limb_kernel<T>::divrem(l_quotient.data()
+                              ,l_remainder.data()
+                              ,p_num.m_ext.data()
+                              ,p_num.m_ext.size()
+                              ,p_den.m_ext.data()
+                              ,p_den.m_ext.size()
+                              );
+        p_quotient = ext_uint(l_quotient, false).trim();
+        p_remainder = ext_uint(l_remainder, false).trim();
     }
 
     //-------------------------------------------------------------------------
     template <typename T>
-    template <typename FLOATING_TYPE, typename MANTISSA_TYPE, typename std::enable_if< sizeof(T) < sizeof(FLOATING_TYPE), int>::type>
-    FLOATING_TYPE
-    ext_uint<T>::extract_mantissa() const
+    void
+    ext_uint<T>::check_base(unsigned int p_base)
     {
-        static_assert(sizeof(MANTISSA_TYPE) >= sizeof(FLOATING_TYPE), "Sizeof MANTISSA_TYPE is unsifficiant to represent FLOATING_TYPE mantissa");
-        assert(m_ext.size());
-        MANTISSA_TYPE l_mantissa = m_ext.back();
-        size_t l_index = m_ext.size() - 2;
-        constexpr const MANTISSA_TYPE l_limit = ((MANTISSA_TYPE)1) << (8 * sizeof(MANTISSA_TYPE) - 8 * sizeof(T));
-        // Rebuild mantissa using complete extension words
-        while(l_index < m_ext.size() && l_mantissa < l_limit)
+        if(p_base < 2 || p_base > 36)
         {
-            l_mantissa = l_mantissa << 8 * sizeof(T);
-            l_mantissa |= m_ext[l_index];
-            --l_index;
+            throw quicky_exception::quicky_logic_exception("ext_uint string conversion base should be in range [2,36] : " + std::to_string(p_base), __LINE__, __FILE__);
         }
-        FLOATING_TYPE l_result = l_mantissa;
-        if(l_index < m_ext.size())
-          {
-            l_result = complete_mantissa<FLOATING_TYPE,MANTISSA_TYPE>(l_mantissa, l_index);
-          }
-        return l_result;
     }
 
     //-------------------------------------------------------------------------
     template <typename T>
-    template <typename FLOATING_TYPE, typename MANTISSA_TYPE>
-    FLOATING_TYPE ext_uint<T>::complete_mantissa(MANTISSA_TYPE p_mantissa
-                                                ,size_t p_index
-                                                ) const
-    {
-      constexpr const MANTISSA_TYPE l_limit = ((MANTISSA_TYPE)1) << (8 * sizeof(MANTISSA_TYPE) - 1);
-      unsigned int l_exp = 0;
-      size_t l_shift = 0;
-      while(!(p_mantissa & l_limit))
-      {
-          ++l_shift;
-          p_mantissa = p_mantissa << 1;
-      }
-
-      FLOATING_TYPE l_result = p_mantissa;
-      if(l_shift)
-      {
-          size_t l_ignored = (8 * sizeof(T) - l_shift);
-          T l_shifted_part = ((T) m_ext[p_index]) >> l_ignored;
-          p_mantissa |= l_shifted_part;
-          l_exp += l_ignored;
-          l_result = (FLOATING_TYPE)p_mantissa;
-          if(p_index - 1 < m_ext.size())
-          {
-              l_exp += 8 * sizeof(T) * p_index;
-          }
-      }
-      else
-      {
-          l_exp += 8 * sizeof(T) * (p_index + 1);
-      }
-      if(l_exp)
-      {
-          l_result = add_exponent<FLOATING_TYPE, MANTISSA_TYPE>(l_result, l_exp);
-      }
-      return l_result;
+    unsigned int
+    ext_uint<T>::get_chunk_digits(unsigned int p_base)
+    {
+        unsigned int l_nb_digits = 1;
+        T l_power = (T)p_base;
+        while(l_power <= std::numeric_limits<T>::max() / p_base)
+        {
+            l_power = (T)(l_power * p_base);
+            ++l_nb_digits;
+        }
+        return l_nb_digits;
     }
 
     //-------------------------------------------------------------------------
     template <typename T>
-    template <typename FLOATING_TYPE, typename MANTISSA_TYPE>
-    FLOATING_TYPE ext_uint<T>::add_exponent(FLOATING_TYPE & p_floating
-                                           ,int p_add
-                                           )
+    const ext_uint<T> &
+    ext_uint<T>::get_power(unsigned int p_base
+                          ,unsigned int p_level
+                          )
     {
-      constexpr const size_t l_mantissa_size = std::numeric_limits<FLOATING_TYPE>::digits - 1;
-      constexpr const MANTISSA_TYPE l_mantissa_mask = (((MANTISSA_TYPE)1) << l_mantissa_size) - 1;
-      constexpr const size_t l_exp_size = (8 * sizeof(FLOATING_TYPE) - l_mantissa_size - 1);
-      constexpr const MANTISSA_TYPE l_exponent_mask = (((MANTISSA_TYPE)1) << l_exp_size) - 1;
-      // Extract mantissa un exponent
-      MANTISSA_TYPE & l_floating_ref = *((MANTISSA_TYPE*) (&p_floating));
-      MANTISSA_TYPE l_mantissa = l_floating_ref & l_mantissa_mask;
-      unsigned int l_exponent = (l_floating_ref >> l_mantissa_size) & l_exponent_mask;
+        // deque keeps references valid when table grows so published values
+        // can be read without holding the mutex
+        static std::mutex l_mutex;
+        static std::array<std::deque<ext_uint<T>>, 37> l_tables;
+        std::deque<ext_uint<T>> & l_table = l_tables[p_base];
+        std::unique_lock<std::mutex> l_lock(l_mutex);
+        if(l_table.empty())
+        {
+            T l_power = 1;
+            for(unsigned int l_index = 0; l_index < get_chunk_digits(p_base); ++l_index)
+            {
+                l_power = (T)(l_power * p_base);
+            }
+            l_table.push_back(ext_uint<T>({l_power}));
+        }
+        while(l_table.size() <= p_level)
+        {
+            size_t l_level = l_table.size();
+            const ext_uint<T> & l_previous = l_table.back();
+            // Squaring is done outside of critical section so that other
+            // threads can use already published levels meanwhile
+            l_lock.unlock();
+            ext_uint<T> l_square = l_previous * l_previous;
+            l_lock.lock();
+            // Another thread may have published this level in the meantime
+            if(l_table.size() == l_level)
+            {
+                l_table.push_back(std::move(l_square));
+            }
+        }
+        return l_table[p_level];
+    }
 
-      l_exponent += p_add;
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    ext_uint<T>::from_digits(const char * p_digits
+                            ,size_t p_size
+                            ,unsigned int p_base
+                            )
+    {
+        unsigned int l_chunk_digits = get_chunk_digits(p_base);
+        if(p_size <= l_chunk_digits * m_conversion_threshold)
+        {
+            std::vector<T> l_ext(1, 0);
+            size_t l_index = 0;
+            // First chunk is shorter if number of digits is not a multiple of chunk size
+            size_t l_chunk_size = p_size % l_chunk_digits ? p_size % l_chunk_digits : l_chunk_digits;
+            while(l_index < p_size)
+            {
+                T l_chunk = 0;
+                T l_mult = 1;
+                for(size_t l_digit_index = 0; l_digit_index < l_chunk_size; ++l_digit_index)
+                {
+                    char l_char = p_digits[l_index + l_digit_index];
+                    unsigned int l_digit = 36;
+                    if('0' <= l_char && l_char <= '9')
+                    {
+                        l_digit = l_char - '0';
+                    }
+                    else if('a' <= l_char && l_char <= 'z')
+                    {
+                        l_digit = 10 + l_char - 'a';
+                    }
+                    else if('A' <= l_char && l_char <= 'Z')
+                    {
+                        l_digit = 10 + l_char - 'A';
+                    }
+                    if(l_digit >= p_base)
+                    {
+                        throw quicky_exception::quicky_logic_exception("Invalid digit '" + std::string(1, l_char) + "' for base " + std::to_string(p_base), __LINE__, __FILE__);
+                    }
+                    l_chunk = (T)(l_chunk * p_base + l_digit);
+                    l_mult = (T)(l_mult * p_base);
+                }
+                T l_carry = limb_kernel<T>::mul_1(l_ext.data(), l_ext.data(), l_ext.size(), l_mult, l_chunk);
+                if(l_carry)
+                {
+                    l_ext.push_back(l_carry);
+                }
+                l_index += l_chunk_size;
+                l_chunk_size = l_chunk_digits;
+            }
+            return ext_uint(l_ext, false).trim();
+        }
+        // Split digits so that low part length is the greatest cached power lower than size
+        unsigned int l_level = 0;
+        size_t l_low_size = l_chunk_digits;
+        while(2 * l_low_size < p_size)
+        {
+            l_low_size *= 2;
+            ++l_level;
+        }
+        ext_uint l_high;
+        ext_uint l_low;
+        auto l_convert_high = [&]{l_high = from_digits(p_digits, p_size - l_low_size, p_base);};
+        auto l_convert_low = [&]{l_low = from_digits(p_digits + p_size - l_low_size, l_low_size, p_base);};
+        if(p_size / l_chunk_digits >= 2 * bignum_thread_pool::get_grain())
+        {
+            bignum_thread_pool::parallel_invoke(l_convert_high, l_convert_low);
+        }
+        else
+        {
+            l_convert_high();
+            l_convert_low();
+        }
+        return l_high * get_power(p_base, l_level) + l_low;
+    }
 
-      constexpr const int l_max_exp = (1u << l_exp_size) - 1;
-      if(l_max_exp <= l_exponent)
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    ext_uint<T>::to_digits(std::string & p_result
+                          ,size_t p_width
+                          ,unsigned int p_base
+                          ) const
+    {
+        static const char l_digit_chars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+        unsigned int l_chunk_digits = get_chunk_digits(p_base);
+        if(m_ext.size() <= m_conversion_threshold)
+        {
+            T l_divisor = get_power(p_base, 0).m_ext[0];
+            std::vector<T> l_ext(m_ext);
+            size_t l_size = l_ext.size();
+            std::string l_reversed;
+            // Extract chunks from least significant ones
+            do
+            {
+                T l_chunk = limb_kernel<T>::divrem_1(l_ext.data(), l_ext.data(), l_size, l_divisor);
+                l_size = limb_kernel<T>::significant_size(l_ext.data(), l_size);
+                for(unsigned int l_index = 0;
+                    l_index < l_chunk_digits && (l_size || l_chunk);
+                    ++l_index
+                   )
+                {
+                    l_reversed.push_back(l_digit_chars[l_chunk % p_base]);
+                    l_chunk = (T)(l_chunk / p_base);
+                }
+            } while(l_size);
+            if(l_reversed.empty())
+            {
+                l_reversed.push_back('0');
+            }
+            if(l_reversed.size() < p_width)
+            {
+                l_reversed.append(p_width - l_reversed.size(), '0');
+            }
+            p_result.append(l_reversed.rbegin(), l_reversed.rend());
+            return;
+        }
+        // Search greatest cached power having at most half of number limbs
+        unsigned int l_level = 0;
+        size_t l_low_width = l_chunk_digits;
+        while(get_power(p_base, l_level + 1).m_ext.size() <= (m_ext.size() + 1) / 2)
+        {
+            ++l_level;
+            l_low_width *= 2;
+        }
+        ext_uint l_high;
+        ext_uint l_low;
+        divrem(*this, get_power(p_base, l_level), l_high, l_low);
+        if((l_high || p_width) && m_ext.size() >= 2 * bignum_thread_pool::get_grain())
+        {
+            // Low digits are generated in their own string to be converted
+            // concurrently with high ones
+            std::string l_low_digits;
+            bignum_thread_pool::parallel_invoke([&]{l_high.to_digits(p_result, p_width > l_low_width ? p_width - l_low_width : 0, p_base);}
+                                               ,[&]{l_low.to_digits(l_low_digits, l_low_width, p_base);}
+                                               );
+            p_result += l_low_digits;
+        }
+        else if(l_high || p_width)
+        {
+            l_high.to_digits(p_result, p_width > l_low_width ? p_width - l_low_width : 0, p_base);
+            l_low.to_digits(p_result, l_low_width, p_base);
+        }
+        else
         {
-          l_mantissa = 0;
+            l_low.to_digits(p_result, 0, p_base);
         }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    ext_uint<T>::is_trimmable() const
+    {
+        return m_ext.size() > 1 && !m_ext.back();
+    }
 
-      // Rebuild new result
-      FLOATING_TYPE l_result = 0.0;
-      MANTISSA_TYPE & l_result_ref = *((MANTISSA_TYPE*) (&l_result));
-      l_result_ref = l_mantissa;
-      l_result_ref |= ((MANTISSA_TYPE)l_exponent) << l_mantissa_size;
-      return l_result;
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T> &
+    ext_uint<T>::trim()
+    {
+        while(is_trimmable())
+        {
+            m_ext.pop_back();
+        }
+        return *this;
     }
 
     declare_template_specialise_type_string(typename T,ext_uint<T>,"ext_uint<" + type_string<T>::name() + ">");
@@ -1321,6 +1764,13 @@ namespace quicky_utils
     */
     bool
     test_ext_uint();
+
+    /**
+     * Method regrouping tests of conversions between extensible integers
+     * and floating types
+     */
+    bool
+    test_ext_floating();
 #endif // QUICKY_UTILS_SELF_TEST
 }
 
@@ -1367,6 +1817,16 @@ namespace std
       public:
         typedef quicky_utils::ext_uint<typename std::make_unsigned<T>::type> type;
     };
+
+    template <typename T>
+    struct hash<quicky_utils::ext_uint<T> >
+    {
+        size_t operator()(const quicky_utils::ext_uint<T> & p_value) const noexcept
+        {
+            const std::vector<T> & l_ext = p_value.get_extension();
+            return (size_t)quicky_utils::limb_kernel<T>::get_hash(l_ext.data(), l_ext.size());
+        }
+    };
 }
 #endif //QUICKY_UTILS_EXT_UINT_H
 // EOF
@@ -0,0 +1,230 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+#ifndef QUICKY_UTILS_EXT_UINT_SORT_H
+#define QUICKY_UTILS_EXT_UINT_SORT_H
+
+#include "ext_uint.h"
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+namespace quicky_utils
+{
+    /**
+     * Sorting of extensible unsigned integers.
+     * As numbers have no leading null limb they are first ordered by number
+     * of limbs with a counting sort. Numbers having same number of limbs are
+     * then ordered by a least significant digit radix sort working on a
+     * contiguous copy of their limbs so that limbs storage is read only
+     * once. Digits whose value is the same for all numbers are skipped.
+     * Numbers are finally moved to their place without copying limbs
+     * @tparam T limb type
+     */
+    template <typename T>
+    class ext_uint_sort
+    {
+      public:
+        /**
+         * Sort numbers in ascending order
+         * @param p_values numbers to sort
+         */
+        static
+        void radix_sort(std::vector<ext_uint<T>> & p_values);
+
+      private:
+        /**
+         * Sort indexes of numbers having same number of limbs
+         * @param p_values numbers to sort
+         * @param p_indexes indexes of numbers to sort, replaced by sorted ones
+         * @param p_nb_indexes number of indexes
+         * @param p_nb_limbs number of limbs of numbers
+         */
+        static
+        void sort_group(const std::vector<ext_uint<T>> & p_values
+                       ,size_t * p_indexes
+                       ,size_t p_nb_indexes
+                       ,size_t p_nb_limbs
+                       );
+
+        /**
+         * Groups of numbers whose keys exceed this number of bytes are sorted
+         * by comparison as most radix passes would be useless
+         */
+        static constexpr size_t m_max_radix_bytes = 32;
+
+        /**
+         * Groups smaller than this are sorted by comparison
+         */
+        static constexpr size_t m_min_radix_size = 256;
+
+        /**
+         * Groups of at least this size are sorted with 16 bits digits
+         * instead of bytes
+         */
+        static constexpr size_t m_min_wide_digit_size = 1 << 18;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    ext_uint_sort<T>::radix_sort(std::vector<ext_uint<T>> & p_values)
+    {
+        size_t l_nb_values = p_values.size();
+        if(l_nb_values < 2)
+        {
+            return;
+        }
+        size_t l_max_nb_limbs = 0;
+        for(const auto & l_iter: p_values)
+        {
+            l_max_nb_limbs = std::max(l_max_nb_limbs, l_iter.get_nb_words());
+        }
+
+        // Counting sort on number of limbs
+        std::vector<size_t> l_starts(l_max_nb_limbs + 2, 0);
+        for(const auto & l_iter: p_values)
+        {
+            ++l_starts[l_iter.get_nb_words() + 1];
+        }
+        for(size_t l_index = 1; l_index < l_starts.size(); ++l_index)
+        {
+            l_starts[l_index] += l_starts[l_index - 1];
+        }
+        std::vector<size_t> l_indexes(l_nb_values);
+        {
+            std::vector<size_t> l_next(l_starts);
+            for(size_t l_index = 0; l_index < l_nb_values; ++l_index)
+            {
+                l_indexes[l_next[p_values[l_index].get_nb_words()]++] = l_index;
+            }
+        }
+
+        for(size_t l_nb_limbs = 1; l_nb_limbs <= l_max_nb_limbs; ++l_nb_limbs)
+        {
+            size_t l_begin = l_starts[l_nb_limbs];
+            size_t l_size = l_starts[l_nb_limbs + 1] - l_begin;
+            if(l_size > 1)
+            {
+                sort_group(p_values, l_indexes.data() + l_begin, l_size, l_nb_limbs);
+            }
+        }
+
+        std::vector<ext_uint<T>> l_result;
+        l_result.reserve(l_nb_values);
+        for(size_t l_index: l_indexes)
+        {
+            l_result.push_back(std::move(p_values[l_index]));
+        }
+        p_values.swap(l_result);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    ext_uint_sort<T>::sort_group(const std::vector<ext_uint<T>> & p_values
+                                ,size_t * p_indexes
+                                ,size_t p_nb_indexes
+                                ,size_t p_nb_limbs
+                                )
+    {
+        size_t l_nb_bytes = p_nb_limbs * sizeof(T);
+        if(l_nb_bytes > m_max_radix_bytes || p_nb_indexes < m_min_radix_size)
+        {
+            std::sort(p_indexes, p_indexes + p_nb_indexes, [&](size_t p_index1, size_t p_index2)
+            {
+                return p_values[p_index1] < p_values[p_index2];
+            });
+            return;
+        }
+
+        // Wide digits halve number of passes once group is big enough to
+        // amortize bigger histograms
+        unsigned int l_digit_bits = sizeof(T) > 1 && p_nb_indexes >= m_min_wide_digit_size ? 16 : 8;
+        size_t l_nb_buckets = ((size_t)1) << l_digit_bits;
+        T l_digit_mask = (T)(l_nb_buckets - 1);
+        size_t l_digits_per_limb = 8 * sizeof(T) / l_digit_bits;
+        size_t l_nb_digits = p_nb_limbs * l_digits_per_limb;
+
+        // Contiguous copy of limbs and histograms of all digits in one pass
+        std::vector<T> l_keys(p_nb_indexes * p_nb_limbs);
+        std::vector<size_t> l_histograms(l_nb_digits * l_nb_buckets, 0);
+        for(size_t l_index = 0; l_index < p_nb_indexes; ++l_index)
+        {
+            const std::vector<T> & l_ext = p_values[p_indexes[l_index]].get_extension();
+            T * l_key = &l_keys[l_index * p_nb_limbs];
+            for(size_t l_limb = 0; l_limb < p_nb_limbs; ++l_limb)
+            {
+                l_key[l_limb] = l_ext[l_limb];
+                for(size_t l_digit = 0; l_digit < l_digits_per_limb; ++l_digit)
+                {
+                    ++l_histograms[(l_limb * l_digits_per_limb + l_digit) * l_nb_buckets + ((l_ext[l_limb] >> (l_digit_bits * l_digit)) & l_digit_mask)];
+                }
+            }
+        }
+
+        std::vector<T> l_keys_buffer(l_keys.size());
+        std::vector<size_t> l_indexes_buffer(p_nb_indexes);
+        size_t * l_indexes = p_indexes;
+        size_t * l_indexes_dest = l_indexes_buffer.data();
+        for(size_t l_digit = 0; l_digit < l_nb_digits; ++l_digit)
+        {
+            size_t * l_histogram = &l_histograms[l_digit * l_nb_buckets];
+            // Digit having same value for all numbers does not change order
+            if(std::find(l_histogram, l_histogram + l_nb_buckets, p_nb_indexes) != l_histogram + l_nb_buckets)
+            {
+                continue;
+            }
+            size_t l_offset = 0;
+            for(size_t l_bucket = 0; l_bucket < l_nb_buckets; ++l_bucket)
+            {
+                size_t l_count = l_histogram[l_bucket];
+                l_histogram[l_bucket] = l_offset;
+                l_offset += l_count;
+            }
+            size_t l_limb = l_digit / l_digits_per_limb;
+            unsigned int l_shift = l_digit_bits * (unsigned int)(l_digit % l_digits_per_limb);
+            for(size_t l_index = 0; l_index < p_nb_indexes; ++l_index)
+            {
+                const T * l_key = &l_keys[l_index * p_nb_limbs];
+                size_t l_dest = l_histogram[(l_key[l_limb] >> l_shift) & l_digit_mask]++;
+                T * l_key_dest = &l_keys_buffer[l_dest * p_nb_limbs];
+                for(size_t l_limb_index = 0; l_limb_index < p_nb_limbs; ++l_limb_index)
+                {
+                    l_key_dest[l_limb_index] = l_key[l_limb_index];
+                }
+                l_indexes_dest[l_dest] = l_indexes[l_index];
+            }
+            l_keys.swap(l_keys_buffer);
+            std::swap(l_indexes, l_indexes_dest);
+        }
+        if(l_indexes != p_indexes)
+        {
+            std::copy(l_indexes, l_indexes + p_nb_indexes, p_indexes);
+        }
+    }
+
+#ifdef QUICKY_UTILS_SELF_TEST
+    /**
+     * Method regrouping tests of comparison, hash and sort of extensible
+     * integers
+     */
+    bool
+    test_ext_uint_sort();
+#endif // QUICKY_UTILS_SELF_TEST
+}
+#endif //QUICKY_UTILS_EXT_UINT_SORT_H
+// EOF
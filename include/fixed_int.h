@@ -0,0 +1,704 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+#ifndef QUICKY_UTILS_FIXED_INT_H
+#define QUICKY_UTILS_FIXED_INT_H
+
+#include "fixed_uint.h"
+#include "ext_int.h"
+#include "ext_uint.h"
+#include "type_string.h"
+#include "quicky_exception.h"
+#include <array>
+#include <string>
+#include <iostream>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+namespace quicky_utils
+{
+    /**
+     * Signed integer of BITS bits stored in two's complement on stack.
+     * Operators wrap like fixed_uint ones, division truncates toward zero
+     * and right shift is arithmetic. check_* methods detect overflow and
+     * promote_* methods return exact result as an ext_int
+     * @tparam BITS number of bits, multiple of limb size
+     * @tparam T unsigned limb type
+     */
+    template <size_t BITS, typename T = uint64_t>
+    class fixed_int
+    {
+      public:
+        typedef fixed_uint<BITS, T> unsigned_type;
+        typedef ext_int<typename std::make_signed<T>::type> ext_type;
+
+        /**
+         * Empty constructor building a null number
+         */
+        constexpr fixed_int();
+
+        /**
+         * Constructor from int64_t, value is truncated if BITS < 64
+         * @param p_value value to convert
+         */
+        constexpr fixed_int(int64_t p_value);
+
+        /**
+         * Constructor reinterpreting bits of an unsigned number
+         * @param p_bits two's complement representation
+         */
+        constexpr explicit fixed_int(const unsigned_type & p_bits);
+
+        /**
+         * Constructor from ext_int
+         * exception is thrown if value does not fit in BITS bits
+         * @param p_value value to convert
+         */
+        explicit fixed_int(const ext_type & p_value);
+
+        /**
+         * Conversion to extensible integer
+         * @return ext_int having the same value
+         */
+        [[nodiscard]]
+        ext_type to_ext_int() const;
+
+        constexpr explicit operator bool() const;
+
+        explicit operator float() const;
+
+        explicit operator double() const;
+
+        /**
+         * Two's complement representation accessor
+         * @return bits of number
+         */
+        constexpr const unsigned_type & get_bits() const;
+
+        /**
+         * Indicate if number is strictly negative
+         * @return true if number is negative
+         */
+        [[nodiscard]]
+        constexpr bool is_negative() const;
+
+        /**
+         * Absolute value
+         * @return absolute value, exact even for lowest value
+         */
+        [[nodiscard]]
+        constexpr unsigned_type get_magnitude() const;
+
+        constexpr bool operator==(const fixed_int & p_op) const;
+        constexpr bool operator!=(const fixed_int & p_op) const;
+        constexpr bool operator<(const fixed_int & p_op) const;
+        constexpr bool operator>(const fixed_int & p_op) const;
+        constexpr bool operator<=(const fixed_int & p_op) const;
+        constexpr bool operator>=(const fixed_int & p_op) const;
+
+        constexpr fixed_int operator+(const fixed_int & p_op) const;
+        constexpr fixed_int operator-(const fixed_int & p_op) const;
+        constexpr fixed_int operator*(const fixed_int & p_op) const;
+        fixed_int operator/(const fixed_int & p_op) const;
+        fixed_int operator%(const fixed_int & p_op) const;
+        constexpr fixed_int operator<<(unsigned int p_shift) const;
+        constexpr fixed_int operator>>(unsigned int p_shift) const;
+        constexpr fixed_int operator-() const;
+        constexpr fixed_int operator+() const;
+
+        constexpr fixed_int & operator+=(const fixed_int & p_op);
+        constexpr fixed_int & operator-=(const fixed_int & p_op);
+        constexpr fixed_int & operator*=(const fixed_int & p_op);
+        fixed_int & operator/=(const fixed_int & p_op);
+        fixed_int & operator%=(const fixed_int & p_op);
+        constexpr fixed_int & operator<<=(unsigned int p_shift);
+        constexpr fixed_int & operator>>=(unsigned int p_shift);
+
+        /**
+         * Representation of number in a given base
+         * @param p_base base in range [2,36]
+         * @return string representation using lowercase digits prefixed by
+         * '-' for negative numbers
+         */
+        [[nodiscard]]
+        std::string to_string(unsigned int p_base = 10) const;
+
+        /**
+         * Build number from its representation in a given base
+         * exception is thrown if value does not fit in BITS bits
+         * @param p_string digits, case insensitive, with optional sign
+         * @param p_base base in range [2,36]
+         * @return number represented by string
+         */
+        static
+        fixed_int from_string(const std::string & p_string
+                             ,unsigned int p_base = 10
+                             );
+
+        /**
+         * Method performing addition, returning the result and setting a
+         * boolean to true in case of overflow
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @param p_overflow true in case of overflow
+         * @return wrapped result
+         */
+        static constexpr
+        fixed_int check_add(const fixed_int & p_op1
+                           ,const fixed_int & p_op2
+                           ,bool & p_overflow
+                           );
+
+        /**
+         * Method performing substraction, returning the result and setting a
+         * boolean to true in case of overflow
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @param p_overflow true in case of overflow
+         * @return wrapped result
+         */
+        static constexpr
+        fixed_int check_sub(const fixed_int & p_op1
+                           ,const fixed_int & p_op2
+                           ,bool & p_overflow
+                           );
+
+        /**
+         * Method performing multiplication, returning the result and setting
+         * a boolean to true in case of overflow
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @param p_overflow true in case of overflow
+         * @return wrapped result
+         */
+        static constexpr
+        fixed_int check_mul(const fixed_int & p_op1
+                           ,const fixed_int & p_op2
+                           ,bool & p_overflow
+                           );
+
+        /**
+         * Exact addition, switching to ext_int when result outgrows BITS
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @return exact sum
+         */
+        static
+        ext_type promote_add(const fixed_int & p_op1
+                            ,const fixed_int & p_op2
+                            );
+
+        /**
+         * Exact multiplication, switching to ext_int when result outgrows
+         * BITS
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @return exact product
+         */
+        static
+        ext_type promote_mul(const fixed_int & p_op1
+                            ,const fixed_int & p_op2
+                            );
+
+      private:
+        /**
+         * Two's complement representation
+         */
+        unsigned_type m_bits;
+    };
+
+    /**
+     * Display two's complement representation of fixed_int in hexadecimal
+     * @param p_stream output stream
+     * @param p_value number to display
+     * @return output stream
+     */
+    template <size_t BITS, typename T>
+    std::ostream &
+    operator<<(std::ostream & p_stream
+              ,const fixed_int<BITS, T> & p_value
+              );
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T>::fixed_int():
+    m_bits()
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T>::fixed_int(int64_t p_value):
+    m_bits((uint64_t)p_value)
+    {
+        if(p_value < 0 && BITS > 64)
+        {
+            // Sign extension of bits located after the 64 first ones
+            m_bits -= unsigned_type(1) << 64;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T>::fixed_int(const unsigned_type & p_bits):
+    m_bits(p_bits)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    fixed_int<BITS, T>::fixed_int(const ext_type & p_value):
+    m_bits()
+    {
+        bool l_negative = p_value.get_root() < 0;
+        unsigned_type l_magnitude(ext_uint<T>(l_negative ? -p_value : p_value));
+        unsigned_type l_limit = unsigned_type(1) << (BITS - 1);
+        if(l_magnitude > l_limit || (!l_negative && l_magnitude == l_limit))
+        {
+            throw quicky_exception::quicky_logic_exception("Value does not fit in " + std::to_string(BITS) + " signed bits", __LINE__, __FILE__);
+        }
+        m_bits = l_negative ? -l_magnitude : l_magnitude;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    typename fixed_int<BITS, T>::ext_type
+    fixed_int<BITS, T>::to_ext_int() const
+    {
+        ext_type l_magnitude(get_magnitude().to_ext_uint());
+        return is_negative() ? -l_magnitude : l_magnitude;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T>::operator bool() const
+    {
+        return (bool)m_bits;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    fixed_int<BITS, T>::operator float() const
+    {
+        return is_negative() ? -(float)get_magnitude() : (float)m_bits;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    fixed_int<BITS, T>::operator double() const
+    {
+        return is_negative() ? -(double)get_magnitude() : (double)m_bits;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    const typename fixed_int<BITS, T>::unsigned_type &
+    fixed_int<BITS, T>::get_bits() const
+    {
+        return m_bits;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    bool
+    fixed_int<BITS, T>::is_negative() const
+    {
+        return m_bits.test_bit(BITS - 1);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    typename fixed_int<BITS, T>::unsigned_type
+    fixed_int<BITS, T>::get_magnitude() const
+    {
+        return is_negative() ? -m_bits : m_bits;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    bool
+    fixed_int<BITS, T>::operator==(const fixed_int & p_op) const
+    {
+        return m_bits == p_op.m_bits;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    bool
+    fixed_int<BITS, T>::operator!=(const fixed_int & p_op) const
+    {
+        return m_bits != p_op.m_bits;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    bool
+    fixed_int<BITS, T>::operator<(const fixed_int & p_op) const
+    {
+        if(is_negative() != p_op.is_negative())
+        {
+            return is_negative();
+        }
+        // Same sign: two's complement order is unsigned order
+        return m_bits < p_op.m_bits;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    bool
+    fixed_int<BITS, T>::operator>(const fixed_int & p_op) const
+    {
+        return p_op < *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    bool
+    fixed_int<BITS, T>::operator<=(const fixed_int & p_op) const
+    {
+        return !(p_op < *this);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    bool
+    fixed_int<BITS, T>::operator>=(const fixed_int & p_op) const
+    {
+        return !(*this < p_op);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T>
+    fixed_int<BITS, T>::check_add(const fixed_int & p_op1
+                                 ,const fixed_int & p_op2
+                                 ,bool & p_overflow
+                                 )
+    {
+        fixed_int l_result(p_op1.m_bits + p_op2.m_bits);
+        p_overflow = p_op1.is_negative() == p_op2.is_negative() && l_result.is_negative() != p_op1.is_negative();
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T>
+    fixed_int<BITS, T>::check_sub(const fixed_int & p_op1
+                                 ,const fixed_int & p_op2
+                                 ,bool & p_overflow
+                                 )
+    {
+        fixed_int l_result(p_op1.m_bits - p_op2.m_bits);
+        p_overflow = p_op1.is_negative() != p_op2.is_negative() && l_result.is_negative() != p_op1.is_negative();
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T>
+    fixed_int<BITS, T>::check_mul(const fixed_int & p_op1
+                                 ,const fixed_int & p_op2
+                                 ,bool & p_overflow
+                                 )
+    {
+        bool l_negative = p_op1.is_negative() != p_op2.is_negative();
+        bool l_overflow = false;
+        unsigned_type l_magnitude = unsigned_type::check_mul(p_op1.get_magnitude(), p_op2.get_magnitude(), l_overflow);
+        unsigned_type l_limit = unsigned_type(1) << (BITS - 1);
+        p_overflow = l_overflow || l_magnitude > l_limit || (!l_negative && l_magnitude == l_limit);
+        return fixed_int(l_negative ? -l_magnitude : l_magnitude);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T>
+    fixed_int<BITS, T>::operator+(const fixed_int & p_op) const
+    {
+        return fixed_int(m_bits + p_op.m_bits);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T>
+    fixed_int<BITS, T>::operator-(const fixed_int & p_op) const
+    {
+        return fixed_int(m_bits - p_op.m_bits);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T>
+    fixed_int<BITS, T>::operator*(const fixed_int & p_op) const
+    {
+        // Lower half of product does not depend on signedness
+        return fixed_int(m_bits * p_op.m_bits);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    fixed_int<BITS, T>
+    fixed_int<BITS, T>::operator/(const fixed_int & p_op) const
+    {
+        if(!p_op)
+        {
+            throw quicky_exception::quicky_logic_exception("Illegal division by 0 fixed_int", __LINE__, __FILE__);
+        }
+        unsigned_type l_quotient = get_magnitude() / p_op.get_magnitude();
+        return fixed_int(is_negative() != p_op.is_negative() ? -l_quotient : l_quotient);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    fixed_int<BITS, T>
+    fixed_int<BITS, T>::operator%(const fixed_int & p_op) const
+    {
+        if(!p_op)
+        {
+            throw quicky_exception::quicky_logic_exception("Illegal division by 0 fixed_int", __LINE__, __FILE__);
+        }
+        // Remainder has sign of numerator
+        unsigned_type l_remainder = get_magnitude() % p_op.get_magnitude();
+        return fixed_int(is_negative() ? -l_remainder : l_remainder);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T>
+    fixed_int<BITS, T>::operator<<(unsigned int p_shift) const
+    {
+        return fixed_int(m_bits << p_shift);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T>
+    fixed_int<BITS, T>::operator>>(unsigned int p_shift) const
+    {
+        if(!is_negative())
+        {
+            return fixed_int(m_bits >> p_shift);
+        }
+        // Shift complement so that incoming bits are set: ~x = -x - 1
+        unsigned_type l_complement = -m_bits - unsigned_type(1);
+        return fixed_int(-(l_complement >> p_shift) - unsigned_type(1));
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T>
+    fixed_int<BITS, T>::operator-() const
+    {
+        return fixed_int(-m_bits);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T>
+    fixed_int<BITS, T>::operator+() const
+    {
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T> &
+    fixed_int<BITS, T>::operator+=(const fixed_int & p_op)
+    {
+        m_bits += p_op.m_bits;
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T> &
+    fixed_int<BITS, T>::operator-=(const fixed_int & p_op)
+    {
+        m_bits -= p_op.m_bits;
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T> &
+    fixed_int<BITS, T>::operator*=(const fixed_int & p_op)
+    {
+        m_bits *= p_op.m_bits;
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    fixed_int<BITS, T> &
+    fixed_int<BITS, T>::operator/=(const fixed_int & p_op)
+    {
+        *this = *this / p_op;
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    fixed_int<BITS, T> &
+    fixed_int<BITS, T>::operator%=(const fixed_int & p_op)
+    {
+        *this = *this % p_op;
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T> &
+    fixed_int<BITS, T>::operator<<=(unsigned int p_shift)
+    {
+        *this = *this << p_shift;
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_int<BITS, T> &
+    fixed_int<BITS, T>::operator>>=(unsigned int p_shift)
+    {
+        *this = *this >> p_shift;
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    std::string
+    fixed_int<BITS, T>::to_string(unsigned int p_base) const
+    {
+        std::string l_magnitude = get_magnitude().to_string(p_base);
+        return is_negative() ? "-" + l_magnitude : l_magnitude;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    fixed_int<BITS, T>
+    fixed_int<BITS, T>::from_string(const std::string & p_string
+                                   ,unsigned int p_base
+                                   )
+    {
+        return fixed_int(ext_type::from_string(p_string, p_base));
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    typename fixed_int<BITS, T>::ext_type
+    fixed_int<BITS, T>::promote_add(const fixed_int & p_op1
+                                   ,const fixed_int & p_op2
+                                   )
+    {
+        bool l_overflow = false;
+        fixed_int l_result = check_add(p_op1, p_op2, l_overflow);
+        if(!l_overflow)
+        {
+            return l_result.to_ext_int();
+        }
+        return p_op1.to_ext_int() + p_op2.to_ext_int();
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    typename fixed_int<BITS, T>::ext_type
+    fixed_int<BITS, T>::promote_mul(const fixed_int & p_op1
+                                   ,const fixed_int & p_op2
+                                   )
+    {
+        ext_type l_magnitude(unsigned_type::promote_mul(p_op1.get_magnitude(), p_op2.get_magnitude()));
+        return p_op1.is_negative() != p_op2.is_negative() ? -l_magnitude : l_magnitude;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    std::ostream &
+    operator<<(std::ostream & p_stream
+              ,const fixed_int<BITS, T> & p_value
+              )
+    {
+        return p_stream << p_value.get_bits();
+    }
+
+    typedef fixed_int<128> int128_fixed_t;
+    typedef fixed_int<256> int256_fixed_t;
+    typedef fixed_int<512> int512_fixed_t;
+
+    // declare_template_specialise_type_string cannot be used as template
+    // arguments list contains a comma
+    template <size_t BITS, typename T>
+    class type_string<fixed_int<BITS, T>>
+    {
+      public:
+        type_string() = delete;
+        type_string(const type_string & ) = delete;
+        type_string(const type_string && ) = delete;
+
+        inline static const std::string & name();
+      private:
+        static std::unique_ptr<std::string> m_name;
+    };
+
+    template <size_t BITS, typename T>
+    const std::string & type_string<fixed_int<BITS, T>>::name()
+    {
+        if(!m_name)
+        {
+            m_name = std::unique_ptr<std::string>(new std::string("fixed_int<" + std::to_string(BITS) + "," + type_string<T>::name() + ">"));
+        }
+        return *m_name;
+    }
+
+    template <size_t BITS, typename T>
+    std::unique_ptr<std::string> type_string<fixed_int<BITS, T>>::m_name = nullptr;
+
+#ifdef QUICKY_UTILS_SELF_TEST
+    /**
+     * Method regrouping tests of fixed_int class
+     */
+    bool
+    test_fixed_int();
+#endif // QUICKY_UTILS_SELF_TEST
+}
+#endif //QUICKY_UTILS_FIXED_INT_H
+// EOF
@@ -0,0 +1,867 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+#ifndef QUICKY_UTILS_FIXED_UINT_H
+#define QUICKY_UTILS_FIXED_UINT_H
+
+#include "ext_uint.h"
+#include "limb_kernel.h"
+#include "type_string.h"
+#include "quicky_exception.h"
+#include <array>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+namespace quicky_utils
+{
+    /**
+     * Unsigned integer of BITS bits stored on stack. Operators wrap modulo
+     * 2 ^ BITS like built-in unsigned types, loops have compile time bounds
+     * and are constexpr so that compiler fully unrolls carry chains.
+     * check_* methods detect overflow in the spirit of safe_uint and
+     * promote_* methods return exact result as an ext_uint
+     * @tparam BITS number of bits, multiple of limb size
+     * @tparam T limb type
+     */
+    template <size_t BITS, typename T = uint64_t>
+    class fixed_uint
+    {
+      public:
+        typedef T limb_type;
+
+        /**
+         * Number of limbs
+         */
+        static constexpr size_t m_nb_limbs = BITS / (8 * sizeof(T));
+
+        /**
+         * Empty constructor building a null number
+         */
+        constexpr fixed_uint();
+
+        /**
+         * Constructor from uint64_t, value is truncated if BITS < 64
+         * @param p_value value to convert
+         */
+        constexpr fixed_uint(uint64_t p_value);
+
+        /**
+         * Constructor from limbs
+         * @param p_limbs limbs, least significant first
+         */
+        constexpr explicit fixed_uint(const std::array<T, m_nb_limbs> & p_limbs);
+
+        /**
+         * Constructor from ext_uint
+         * exception is thrown if value does not fit in BITS bits
+         * @param p_value value to convert
+         */
+        explicit fixed_uint(const ext_uint<T> & p_value);
+
+        /**
+         * Conversion to extensible integer
+         * @return ext_uint having the same value
+         */
+        [[nodiscard]]
+        ext_uint<T> to_ext_uint() const;
+
+        constexpr explicit operator bool() const;
+
+        explicit operator float() const;
+
+        explicit operator double() const;
+
+        /**
+         * Limbs accessor
+         * @return limbs, least significant first
+         */
+        constexpr const std::array<T, m_nb_limbs> & get_limbs() const;
+
+        constexpr bool operator==(const fixed_uint & p_op) const;
+        constexpr bool operator!=(const fixed_uint & p_op) const;
+        constexpr bool operator<(const fixed_uint & p_op) const;
+        constexpr bool operator>(const fixed_uint & p_op) const;
+        constexpr bool operator<=(const fixed_uint & p_op) const;
+        constexpr bool operator>=(const fixed_uint & p_op) const;
+
+        constexpr fixed_uint operator+(const fixed_uint & p_op) const;
+        constexpr fixed_uint operator-(const fixed_uint & p_op) const;
+        constexpr fixed_uint operator*(const fixed_uint & p_op) const;
+        fixed_uint operator/(const fixed_uint & p_op) const;
+        fixed_uint operator%(const fixed_uint & p_op) const;
+        constexpr fixed_uint operator<<(unsigned int p_shift) const;
+        constexpr fixed_uint operator>>(unsigned int p_shift) const;
+        constexpr fixed_uint operator-() const;
+        constexpr fixed_uint operator+() const;
+
+        constexpr fixed_uint & operator+=(const fixed_uint & p_op);
+        constexpr fixed_uint & operator-=(const fixed_uint & p_op);
+        constexpr fixed_uint & operator*=(const fixed_uint & p_op);
+        fixed_uint & operator/=(const fixed_uint & p_op);
+        fixed_uint & operator%=(const fixed_uint & p_op);
+        constexpr fixed_uint & operator<<=(unsigned int p_shift);
+        constexpr fixed_uint & operator>>=(unsigned int p_shift);
+
+        /**
+         * Number of bits necessary to represent number
+         * @return index of most significant set bit + 1, 0 if number is null
+         */
+        [[nodiscard]]
+        constexpr size_t bit_length() const;
+
+        /**
+         * Check bit located at p_index
+         * @param p_index index of bit, 0 being the least significant one
+         * @return true if bit is set
+         */
+        [[nodiscard]]
+        constexpr bool test_bit(size_t p_index) const;
+
+        /**
+         * Representation of number in a given base
+         * @param p_base base in range [2,36]
+         * @return string representation using lowercase digits
+         */
+        [[nodiscard]]
+        std::string to_string(unsigned int p_base = 10) const;
+
+        /**
+         * Build number from its representation in a given base
+         * exception is thrown if value does not fit in BITS bits
+         * @param p_string digits, case insensitive
+         * @param p_base base in range [2,36]
+         * @return number represented by string
+         */
+        static
+        fixed_uint from_string(const std::string & p_string
+                              ,unsigned int p_base = 10
+                              );
+
+        /**
+         * Method performing addition, returning the result and setting a
+         * boolean to true in case of overflow
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @param p_overflow true in case of overflow
+         * @return result modulo 2 ^ BITS
+         */
+        static constexpr
+        fixed_uint check_add(const fixed_uint & p_op1
+                            ,const fixed_uint & p_op2
+                            ,bool & p_overflow
+                            );
+
+        /**
+         * Method performing substraction, returning the result and setting a
+         * boolean to true in case of underflow
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @param p_underflow true in case of underflow
+         * @return result modulo 2 ^ BITS
+         */
+        static constexpr
+        fixed_uint check_sub(const fixed_uint & p_op1
+                            ,const fixed_uint & p_op2
+                            ,bool & p_underflow
+                            );
+
+        /**
+         * Method performing multiplication, returning the result and setting
+         * a boolean to true in case of overflow
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @param p_overflow true in case of overflow
+         * @return result modulo 2 ^ BITS
+         */
+        static constexpr
+        fixed_uint check_mul(const fixed_uint & p_op1
+                            ,const fixed_uint & p_op2
+                            ,bool & p_overflow
+                            );
+
+        /**
+         * Exact addition, switching to ext_uint when result outgrows BITS
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @return exact sum
+         */
+        static
+        ext_uint<T> promote_add(const fixed_uint & p_op1
+                               ,const fixed_uint & p_op2
+                               );
+
+        /**
+         * Exact multiplication, switching to ext_uint when result outgrows
+         * BITS
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @return exact product
+         */
+        static
+        ext_uint<T> promote_mul(const fixed_uint & p_op1
+                               ,const fixed_uint & p_op2
+                               );
+
+      private:
+        typedef typename limb_kernel<T>::double_type double_type;
+
+        /**
+         * Number of bits of a limb
+         */
+        static constexpr unsigned int m_limb_bits = 8 * sizeof(T);
+
+        /**
+         * Full product on 2 * m_nb_limbs limbs
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @param p_result product
+         */
+        static constexpr
+        void full_mul(const fixed_uint & p_op1
+                     ,const fixed_uint & p_op2
+                     ,std::array<T, 2 * m_nb_limbs> & p_result
+                     );
+
+        /**
+         * Limbs, least significant first
+         */
+        std::array<T, m_nb_limbs> m_limbs;
+
+        static_assert(std::is_unsigned<T>::value, "Limb type must be unsigned");
+        static_assert(BITS && !(BITS % (8 * sizeof(T))), "Number of bits must be a non null multiple of limb size");
+    };
+
+    /**
+     * Display content of fixed_uint in hexadecimal like ext_uint does
+     * @param p_stream output stream
+     * @param p_value number to display
+     * @return output stream
+     */
+    template <size_t BITS, typename T>
+    std::ostream &
+    operator<<(std::ostream & p_stream
+              ,const fixed_uint<BITS, T> & p_value
+              );
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T>::fixed_uint():
+    m_limbs{}
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T>::fixed_uint(uint64_t p_value):
+    m_limbs{}
+    {
+        for(size_t l_index = 0; l_index < m_nb_limbs && l_index * m_limb_bits < 64; ++l_index)
+        {
+            m_limbs[l_index] = (T)(p_value >> (l_index * m_limb_bits));
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T>::fixed_uint(const std::array<T, m_nb_limbs> & p_limbs):
+    m_limbs(p_limbs)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    fixed_uint<BITS, T>::fixed_uint(const ext_uint<T> & p_value):
+    m_limbs{}
+    {
+        const std::vector<T> & l_ext = p_value.get_extension();
+        size_t l_size = limb_kernel<T>::significant_size(l_ext.data(), l_ext.size());
+        if(l_size > m_nb_limbs)
+        {
+            throw quicky_exception::quicky_logic_exception("Value does not fit in " + std::to_string(BITS) + " bits", __LINE__, __FILE__);
+        }
+        std::copy(l_ext.begin(), l_ext.begin() + l_size, m_limbs.begin());
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    ext_uint<T>
+    fixed_uint<BITS, T>::to_ext_uint() const
+    {
+        return ext_uint<T>::from_limbs(m_limbs.data(), limb_kernel<T>::significant_size(m_limbs.data(), m_nb_limbs));
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T>::operator bool() const
+    {
+        for(size_t l_index = 0; l_index < m_nb_limbs; ++l_index)
+        {
+            if(m_limbs[l_index])
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    fixed_uint<BITS, T>::operator float() const
+    {
+        return (float)to_ext_uint();
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    fixed_uint<BITS, T>::operator double() const
+    {
+        return (double)to_ext_uint();
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    const std::array<T, fixed_uint<BITS, T>::m_nb_limbs> &
+    fixed_uint<BITS, T>::get_limbs() const
+    {
+        return m_limbs;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    bool
+    fixed_uint<BITS, T>::operator==(const fixed_uint & p_op) const
+    {
+        T l_diff = 0;
+        for(size_t l_index = 0; l_index < m_nb_limbs; ++l_index)
+        {
+            l_diff |= (T)(m_limbs[l_index] ^ p_op.m_limbs[l_index]);
+        }
+        return !l_diff;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    bool
+    fixed_uint<BITS, T>::operator!=(const fixed_uint & p_op) const
+    {
+        return !(*this == p_op);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    bool
+    fixed_uint<BITS, T>::operator<(const fixed_uint & p_op) const
+    {
+        bool l_underflow = false;
+        check_sub(*this, p_op, l_underflow);
+        return l_underflow;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    bool
+    fixed_uint<BITS, T>::operator>(const fixed_uint & p_op) const
+    {
+        return p_op < *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    bool
+    fixed_uint<BITS, T>::operator<=(const fixed_uint & p_op) const
+    {
+        return !(p_op < *this);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    bool
+    fixed_uint<BITS, T>::operator>=(const fixed_uint & p_op) const
+    {
+        return !(*this < p_op);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T>
+    fixed_uint<BITS, T>::check_add(const fixed_uint & p_op1
+                                  ,const fixed_uint & p_op2
+                                  ,bool & p_overflow
+                                  )
+    {
+        fixed_uint l_result;
+        T l_carry = 0;
+        for(size_t l_index = 0; l_index < m_nb_limbs; ++l_index)
+        {
+            T l_sum = (T)(p_op1.m_limbs[l_index] + l_carry);
+            l_carry = l_sum < l_carry;
+            T l_value = (T)(l_sum + p_op2.m_limbs[l_index]);
+            l_carry = (T)(l_carry + (l_value < l_sum));
+            l_result.m_limbs[l_index] = l_value;
+        }
+        p_overflow = l_carry;
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T>
+    fixed_uint<BITS, T>::check_sub(const fixed_uint & p_op1
+                                  ,const fixed_uint & p_op2
+                                  ,bool & p_underflow
+                                  )
+    {
+        fixed_uint l_result;
+        T l_borrow = 0;
+        for(size_t l_index = 0; l_index < m_nb_limbs; ++l_index)
+        {
+            T l_diff = (T)(p_op1.m_limbs[l_index] - p_op2.m_limbs[l_index]);
+            T l_new_borrow = l_diff > p_op1.m_limbs[l_index];
+            T l_value = (T)(l_diff - l_borrow);
+            l_borrow = (T)(l_new_borrow + (l_value > l_diff));
+            l_result.m_limbs[l_index] = l_value;
+        }
+        p_underflow = l_borrow;
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    void
+    fixed_uint<BITS, T>::full_mul(const fixed_uint & p_op1
+                                 ,const fixed_uint & p_op2
+                                 ,std::array<T, 2 * m_nb_limbs> & p_result
+                                 )
+    {
+        for(size_t l_index = 0; l_index < 2 * m_nb_limbs; ++l_index)
+        {
+            p_result[l_index] = 0;
+        }
+        for(size_t l_index1 = 0; l_index1 < m_nb_limbs; ++l_index1)
+        {
+            T l_carry = 0;
+            for(size_t l_index2 = 0; l_index2 < m_nb_limbs; ++l_index2)
+            {
+                double_type l_product = (double_type)p_op1.m_limbs[l_index1] * p_op2.m_limbs[l_index2] + p_result[l_index1 + l_index2] + l_carry;
+                p_result[l_index1 + l_index2] = (T)l_product;
+                l_carry = (T)(l_product >> m_limb_bits);
+            }
+            p_result[l_index1 + m_nb_limbs] = l_carry;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T>
+    fixed_uint<BITS, T>::check_mul(const fixed_uint & p_op1
+                                  ,const fixed_uint & p_op2
+                                  ,bool & p_overflow
+                                  )
+    {
+        std::array<T, 2 * m_nb_limbs> l_product{};
+        full_mul(p_op1, p_op2, l_product);
+        fixed_uint l_result;
+        T l_upper = 0;
+        for(size_t l_index = 0; l_index < m_nb_limbs; ++l_index)
+        {
+            l_result.m_limbs[l_index] = l_product[l_index];
+            l_upper |= l_product[l_index + m_nb_limbs];
+        }
+        p_overflow = l_upper;
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T>
+    fixed_uint<BITS, T>::operator+(const fixed_uint & p_op) const
+    {
+        bool l_overflow = false;
+        return check_add(*this, p_op, l_overflow);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T>
+    fixed_uint<BITS, T>::operator-(const fixed_uint & p_op) const
+    {
+        bool l_underflow = false;
+        return check_sub(*this, p_op, l_underflow);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T>
+    fixed_uint<BITS, T>::operator*(const fixed_uint & p_op) const
+    {
+        // Only lower half of product is computed
+        fixed_uint l_result;
+        for(size_t l_index1 = 0; l_index1 < m_nb_limbs; ++l_index1)
+        {
+            T l_carry = 0;
+            for(size_t l_index2 = 0; l_index1 + l_index2 < m_nb_limbs; ++l_index2)
+            {
+                double_type l_product = (double_type)m_limbs[l_index1] * p_op.m_limbs[l_index2] + l_result.m_limbs[l_index1 + l_index2] + l_carry;
+                l_result.m_limbs[l_index1 + l_index2] = (T)l_product;
+                l_carry = (T)(l_product >> m_limb_bits);
+            }
+        }
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    fixed_uint<BITS, T>
+    fixed_uint<BITS, T>::operator/(const fixed_uint & p_op) const
+    {
+        size_t l_den_size = limb_kernel<T>::significant_size(p_op.m_limbs.data(), m_nb_limbs);
+        if(!l_den_size)
+        {
+            throw quicky_exception::quicky_logic_exception("Illegal division by 0 fixed_uint", __LINE__, __FILE__);
+        }
+        size_t l_num_size = limb_kernel<T>::significant_size(m_limbs.data(), m_nb_limbs);
+        fixed_uint l_quotient;
+        if(l_num_size < l_den_size)
+        {
+            return l_quotient;
+        }
+        std::array<T, m_nb_limbs> l_remainder{};
+        limb_kernel<T>::divrem(l_quotient.m_limbs.data(), l_remainder.data(), m_limbs.data(), l_num_size, p_op.m_limbs.data(), l_den_size);
+        return l_quotient;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    fixed_uint<BITS, T>
+    fixed_uint<BITS, T>::operator%(const fixed_uint & p_op) const
+    {
+        size_t l_den_size = limb_kernel<T>::significant_size(p_op.m_limbs.data(), m_nb_limbs);
+        if(!l_den_size)
+        {
+            throw quicky_exception::quicky_logic_exception("Illegal division by 0 fixed_uint", __LINE__, __FILE__);
+        }
+        size_t l_num_size = limb_kernel<T>::significant_size(m_limbs.data(), m_nb_limbs);
+        if(l_num_size < l_den_size)
+        {
+            return *this;
+        }
+        std::array<T, m_nb_limbs> l_quotient{};
+        fixed_uint l_remainder;
+        limb_kernel<T>::divrem(l_quotient.data(), l_remainder.m_limbs.data(), m_limbs.data(), l_num_size, p_op.m_limbs.data(), l_den_size);
+        return l_remainder;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T>
+    fixed_uint<BITS, T>::operator<<(unsigned int p_shift) const
+    {
+        fixed_uint l_result;
+        if(p_shift >= BITS)
+        {
+            return l_result;
+        }
+        size_t l_limb_shift = p_shift / m_limb_bits;
+        unsigned int l_bit_shift = p_shift % m_limb_bits;
+        for(size_t l_index = m_nb_limbs; l_index-- > l_limb_shift;)
+        {
+            T l_value = (T)(m_limbs[l_index - l_limb_shift] << l_bit_shift);
+            if(l_bit_shift && l_index > l_limb_shift)
+            {
+                l_value |= (T)(m_limbs[l_index - l_limb_shift - 1] >> (m_limb_bits - l_bit_shift));
+            }
+            l_result.m_limbs[l_index] = l_value;
+        }
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T>
+    fixed_uint<BITS, T>::operator>>(unsigned int p_shift) const
+    {
+        fixed_uint l_result;
+        if(p_shift >= BITS)
+        {
+            return l_result;
+        }
+        size_t l_limb_shift = p_shift / m_limb_bits;
+        unsigned int l_bit_shift = p_shift % m_limb_bits;
+        for(size_t l_index = 0; l_index + l_limb_shift < m_nb_limbs; ++l_index)
+        {
+            T l_value = (T)(m_limbs[l_index + l_limb_shift] >> l_bit_shift);
+            if(l_bit_shift && l_index + l_limb_shift + 1 < m_nb_limbs)
+            {
+                l_value |= (T)(m_limbs[l_index + l_limb_shift + 1] << (m_limb_bits - l_bit_shift));
+            }
+            l_result.m_limbs[l_index] = l_value;
+        }
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T>
+    fixed_uint<BITS, T>::operator-() const
+    {
+        return fixed_uint() - *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T>
+    fixed_uint<BITS, T>::operator+() const
+    {
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T> &
+    fixed_uint<BITS, T>::operator+=(const fixed_uint & p_op)
+    {
+        *this = *this + p_op;
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T> &
+    fixed_uint<BITS, T>::operator-=(const fixed_uint & p_op)
+    {
+        *this = *this - p_op;
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T> &
+    fixed_uint<BITS, T>::operator*=(const fixed_uint & p_op)
+    {
+        *this = *this * p_op;
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    fixed_uint<BITS, T> &
+    fixed_uint<BITS, T>::operator/=(const fixed_uint & p_op)
+    {
+        *this = *this / p_op;
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    fixed_uint<BITS, T> &
+    fixed_uint<BITS, T>::operator%=(const fixed_uint & p_op)
+    {
+        *this = *this % p_op;
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T> &
+    fixed_uint<BITS, T>::operator<<=(unsigned int p_shift)
+    {
+        *this = *this << p_shift;
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    fixed_uint<BITS, T> &
+    fixed_uint<BITS, T>::operator>>=(unsigned int p_shift)
+    {
+        *this = *this >> p_shift;
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    size_t
+    fixed_uint<BITS, T>::bit_length() const
+    {
+        for(size_t l_index = m_nb_limbs; l_index--;)
+        {
+            if(m_limbs[l_index])
+            {
+                size_t l_length = l_index * m_limb_bits;
+                for(T l_limb = m_limbs[l_index]; l_limb; l_limb = (T)(l_limb >> 1))
+                {
+                    ++l_length;
+                }
+                return l_length;
+            }
+        }
+        return 0;
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    constexpr
+    bool
+    fixed_uint<BITS, T>::test_bit(size_t p_index) const
+    {
+        return p_index < BITS && ((m_limbs[p_index / m_limb_bits] >> (p_index % m_limb_bits)) & 1);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    std::string
+    fixed_uint<BITS, T>::to_string(unsigned int p_base) const
+    {
+        return to_ext_uint().to_string(p_base);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    fixed_uint<BITS, T>
+    fixed_uint<BITS, T>::from_string(const std::string & p_string
+                                    ,unsigned int p_base
+                                    )
+    {
+        return fixed_uint(ext_uint<T>::from_string(p_string, p_base));
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    ext_uint<T>
+    fixed_uint<BITS, T>::promote_add(const fixed_uint & p_op1
+                                    ,const fixed_uint & p_op2
+                                    )
+    {
+        bool l_overflow = false;
+        fixed_uint l_result = check_add(p_op1, p_op2, l_overflow);
+        if(!l_overflow)
+        {
+            return l_result.to_ext_uint();
+        }
+        std::array<T, m_nb_limbs + 1> l_limbs{};
+        std::copy(l_result.m_limbs.begin(), l_result.m_limbs.end(), l_limbs.begin());
+        l_limbs[m_nb_limbs] = 1;
+        return ext_uint<T>::from_limbs(l_limbs.data(), m_nb_limbs + 1);
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    ext_uint<T>
+    fixed_uint<BITS, T>::promote_mul(const fixed_uint & p_op1
+                                    ,const fixed_uint & p_op2
+                                    )
+    {
+        std::array<T, 2 * m_nb_limbs> l_product{};
+        full_mul(p_op1, p_op2, l_product);
+        return ext_uint<T>::from_limbs(l_product.data(), limb_kernel<T>::significant_size(l_product.data(), 2 * m_nb_limbs));
+    }
+
+    //-------------------------------------------------------------------------
+    template <size_t BITS, typename T>
+    std::ostream &
+    operator<<(std::ostream & p_stream
+              ,const fixed_uint<BITS, T> & p_value
+              )
+    {
+        // Format of caller is restored, width being consumed as by any
+        // formatted output instead of padding prefix only
+        char l_fill = p_stream.fill();
+        std::ios::fmtflags l_flags = p_stream.flags();
+        p_stream.width(0);
+        p_stream << "0x";
+        for(size_t l_index = fixed_uint<BITS, T>::m_nb_limbs; l_index--;)
+        {
+            p_stream << std::hex << std::setw(2 * sizeof(T)) << std::setfill('0') << (uint64_t)p_value.get_limbs()[l_index];
+        }
+        p_stream.fill(l_fill);
+        p_stream.flags(l_flags);
+        return p_stream;
+    }
+
+    typedef fixed_uint<128> uint128_fixed_t;
+    typedef fixed_uint<256> uint256_fixed_t;
+    typedef fixed_uint<512> uint512_fixed_t;
+
+    // declare_template_specialise_type_string cannot be used as template
+    // arguments list contains a comma
+    template <size_t BITS, typename T>
+    class type_string<fixed_uint<BITS, T>>
+    {
+      public:
+        type_string() = delete;
+        type_string(const type_string & ) = delete;
+        type_string(const type_string && ) = delete;
+
+        inline static const std::string & name();
+      private:
+        static std::unique_ptr<std::string> m_name;
+    };
+
+    template <size_t BITS, typename T>
+    const std::string & type_string<fixed_uint<BITS, T>>::name()
+    {
+        if(!m_name)
+        {
+            m_name = std::unique_ptr<std::string>(new std::string("fixed_uint<" + std::to_string(BITS) + "," + type_string<T>::name() + ">"));
+        }
+        return *m_name;
+    }
+
+    template <size_t BITS, typename T>
+    std::unique_ptr<std::string> type_string<fixed_uint<BITS, T>>::m_name = nullptr;
+
+#ifdef QUICKY_UTILS_SELF_TEST
+    /**
+     * Method regrouping tests of fixed_uint class
+     */
+    bool
+    test_fixed_uint();
+#endif // QUICKY_UTILS_SELF_TEST
+}
+#endif //QUICKY_UTILS_FIXED_UINT_H
+// EOF
@@ -24,6 +24,13 @@
 #include <type_traits>
 #include <cassert>
 #include <limits>
+#include <cmath>
+#include <algorithm>
+#include <string>
+#include "quicky_exception.h"
+#ifdef FRACT_SAMPLED_CHECK
+#include "fract_verifier.h"
+#endif // FRACT_SAMPLED_CHECK
 
 namespace quicky_utils
 {
@@ -36,111 +43,305 @@ namespace quicky_utils
                              );
 
     template <typename T>
-    fract<T> operator+(const int & p_op1,
+    constexpr fract<T> operator+(const int & p_op1,
 			   const fract<T> & p_op2
 			   );
 
     template <typename T>
-    fract<T> operator-(const int & p_op1,
+    constexpr fract<T> operator-(const int & p_op1,
                        const fract<T> & p_op2
                       );
 
     template <typename T>
-    fract<T> operator*(const int & p_op1,
+    constexpr fract<T> operator*(const int & p_op1,
 			           const fract<T> & p_op2
 			          );
 
     template <typename T>
-    fract<T> operator/(const int & p_op1,
+    constexpr fract<T> operator/(const int & p_op1,
                        const fract<T> & p_op2
                       );
 
     template <typename T>
-    bool operator==(const int & p_op1,
+    constexpr bool operator==(const int & p_op1,
                     const fract<T> & p_op2
                    );
 
     template <typename T>
-    bool operator==(const fract<T> & p_op1,
+    constexpr bool operator==(const fract<T> & p_op1,
                     const int & p_op2
                    );
 
     template <typename T>
-    bool operator!=(const int & p_op1,
+    constexpr bool operator!=(const int & p_op1,
                     const fract<T> & p_op2
                    );
 
     template <typename T>
-    bool operator!=(const fract<T> & p_op1,
+    constexpr bool operator!=(const fract<T> & p_op1,
                     const int & p_op2
                    );
 
     template <typename T>
-    bool operator<(const fract<T> & p_op1,
+    constexpr bool operator<(const fract<T> & p_op1,
                    const int & p_op2
                   );
 
     template <typename T>
-    bool operator<=(const fract<T> & p_op1,
+    constexpr bool operator<=(const fract<T> & p_op1,
                     const int & p_op2
                    );
 
     template <typename T>
-    bool operator>(const fract<T> & p_op1,
+    constexpr bool operator>(const fract<T> & p_op1,
                    const int & p_op2
                   );
 
     template <typename T>
-    bool operator>=(const fract<T> & p_op1,
+    constexpr bool operator>=(const fract<T> & p_op1,
                     const int & p_op2
                    );
 
+    /**
+     * Indicate if a coefficient type is a built-in unsigned integer so that
+     * PGCD can rely on count trailing zeros builtins
+     */
+    template <typename T>
+    struct fract_builtin_coef: std::false_type
+    {
+    };
+
+    template <>
+    struct fract_builtin_coef<unsigned char>: std::true_type
+    {
+    };
+
+    template <>
+    struct fract_builtin_coef<unsigned short>: std::true_type
+    {
+    };
+
+    template <>
+    struct fract_builtin_coef<unsigned int>: std::true_type
+    {
+    };
+
+    template <>
+    struct fract_builtin_coef<unsigned long>: std::true_type
+    {
+    };
+
+    template <>
+    struct fract_builtin_coef<unsigned long long>: std::true_type
+    {
+    };
+
+    /**
+     * Numerator and denominator types of a fract coefficient type and
+     * absolute value of numerators. Coefficient types providing their own
+     * PGCD define has_gcd and gcd as done below for extensible integers
+     */
+    template <typename T>
+    struct fract_coef_traits
+    {
+        typedef typename std::make_signed<T>::type t_num;
+        typedef typename std::make_unsigned<T>::type t_den;
+
+        static constexpr bool has_gcd = false;
+
+        /**
+         * Absolute value of a numerator as a denominator
+         * @param p_value numerator
+         * @return absolute value
+         */
+        inline static constexpr
+        t_den abs(const t_num & p_value)
+        {
+            if constexpr (fract_builtin_coef<t_den>::value)
+            {
+                // Minimum value is negated as unsigned to avoid overflow
+                return p_value < 0 ? (t_den)((t_den)0 - (t_den)p_value) : (t_den)p_value;
+            }
+            else
+            {
+                return (t_den)std::abs(p_value);
+            }
+        }
+    };
+
+    /**
+     * Signed type wide enough to store the product of a numerator and a
+     * denominator of a built-in coefficient so that fractions can be
+     * compared by cross multiplication. void when there is no such type
+     */
+    template <typename T>
+    struct fract_wide_coef
+    {
+        typedef void type;
+    };
+
+    template <>
+    struct fract_wide_coef<signed char>
+    {
+        typedef int32_t type;
+    };
+
+    template <>
+    struct fract_wide_coef<short>
+    {
+        typedef int32_t type;
+    };
+
+    template <>
+    struct fract_wide_coef<int>
+    {
+        typedef int64_t type;
+    };
+
+    template <>
+    struct fract_wide_coef<long>
+    {
+        typedef typename std::conditional<sizeof(long) <= sizeof(int), int64_t, __int128>::type type;
+    };
+
+    template <>
+    struct fract_wide_coef<long long>
+    {
+        typedef __int128 type;
+    };
+
+    template <typename T>
+    class ext_uint;
+
+    template <typename T>
+    class ext_int;
+
+    template <typename T>
+    ext_uint<T> gcd(const ext_uint<T> & p_op1
+                   ,const ext_uint<T> & p_op2
+                   );
+
+    /**
+     * Coefficient traits of fractions of extensible integers so that fract
+     * is an exact arbitrary precision rational. PGCD relies on binary and
+     * Lehmer algorithms of ext_gcd instead of Euclide algorithm. They are
+     * defined here, with forward declarations, so that they are seen by
+     * every instantiation whatever the include order, ext_fract.h provides
+     * definitions of extensible integers and of their PGCD
+     */
+    template <typename T>
+    struct fract_ext_coef_traits
+    {
+        typedef ext_int<typename std::make_signed<T>::type> t_num;
+        typedef ext_uint<typename std::make_unsigned<T>::type> t_den;
+
+        static constexpr bool has_gcd = true;
+
+        /**
+         * Absolute value of a numerator as a denominator
+         * @param p_value numerator
+         * @return absolute value
+         */
+        inline static
+        t_den abs(const t_num & p_value)
+        {
+            return p_value.get_root() < 0 ? t_den(-p_value) : t_den(p_value);
+        }
+
+        /**
+         * Greatest common divisor of denominators
+         * @param p_a first denominator
+         * @param p_b second denominator
+         * @return greatest common divisor
+         */
+        inline static
+        t_den gcd(const t_den & p_a
+                 ,const t_den & p_b
+                 )
+        {
+            return quicky_utils::gcd(p_a, p_b);
+        }
+    };
+
+    template <typename T>
+    struct fract_coef_traits<ext_int<T>>: public fract_ext_coef_traits<T>
+    {
+    };
+
+    template <typename T>
+    struct fract_coef_traits<ext_uint<T>>: public fract_ext_coef_traits<T>
+    {
+    };
+
+    /**
+     * Products of extensible integers never overflow so their fractions are
+     * compared by cross multiplication
+     */
+    template <typename T>
+    struct fract_wide_coef<ext_int<T>>
+    {
+        typedef ext_int<T> type;
+    };
+
+  template <typename T>
+  class fract_accumulator;
+
+  template <typename T>
+  class fract_array;
+
+  template <typename T>
+  class hybrid_fract;
+
   template <typename T>
   class fract
   {
+    friend class fract_accumulator<T>;
+    friend class fract_array<T>;
+    template <typename> friend class hybrid_fract;
     friend std::ostream & operator<< <>(std::ostream & p_stream,
 				     const fract<T> & p_fract
 				     );
-    friend fract<T> operator+<>(const int & p_op1,
+    friend constexpr fract<T> operator+<>(const int & p_op1,
 			   const fract<T> & p_op2
 			   );
-    friend fract<T> operator-<>(const int & p_op1,
+    friend constexpr fract<T> operator-<>(const int & p_op1,
 			   const fract<T> & p_op2
 			   );
-    friend fract<T> operator*<>(const int & p_op1,
+    friend constexpr fract<T> operator*<>(const int & p_op1,
 			   const fract<T> & p_op2
 			   );
-    friend fract<T> operator/<>(const int & p_op1,
+    friend constexpr fract<T> operator/<>(const int & p_op1,
 			   const fract<T> & p_op2
 			   );
-    friend bool operator==<>(const int & p_op1,
+    friend constexpr bool operator==<>(const int & p_op1,
 			   const fract<T> & p_op2
 			   );
-    friend bool operator==<>(const fract<T> & p_op1,
+    friend constexpr bool operator==<>(const fract<T> & p_op1,
 			   const int & p_op2
 			   );
-    friend bool operator!=<>(const int & p_op1,
+    friend constexpr bool operator!=<>(const int & p_op1,
 			   const fract<T> & p_op2
 			   );
-    friend bool operator!=<>(const fract<T> & p_op1,
+    friend constexpr bool operator!=<>(const fract<T> & p_op1,
 			   const int & p_op2
 			   );
-    friend bool operator< <>(const fract<T> & p_op1,
+    friend constexpr bool operator< <>(const fract<T> & p_op1,
 			  const int & p_op2
 			  );
-    friend bool operator<= <>(const fract<T> & p_op1,
+    friend constexpr bool operator<= <>(const fract<T> & p_op1,
 			   const int & p_op2
 			   );
-    friend bool operator> <>(const fract<T> & p_op1,
+    friend constexpr bool operator> <>(const fract<T> & p_op1,
 			  const int & p_op2
 			  );
-    friend bool operator>= <>(const fract<T> & p_op1,
+    friend constexpr bool operator>= <>(const fract<T> & p_op1,
 			   const int & p_op2
 			   );
     public:
     typedef T t_coef;
-    typedef typename std::make_signed<t_coef>::type t_coef_num;
-    typedef typename std::make_unsigned<t_coef>::type t_coef_den;
+    typedef fract_coef_traits<t_coef> t_coef_traits;
+    typedef typename t_coef_traits::t_num t_coef_num;
+    typedef typename t_coef_traits::t_den t_coef_den;
 
     inline constexpr fract() noexcept;
 
@@ -153,19 +354,19 @@ namespace quicky_utils
 	                      ,std::nullptr_t
 		                  );
 
-    inline fract(const t_coef_num & p_num
+    inline constexpr fract(const t_coef_num & p_num
                 ,const t_coef_num & p_den
                 );
 
-    inline fract(const t_coef_num & p_num
+    inline constexpr fract(const t_coef_num & p_num
                 ,const t_coef_den & p_den
                 );
 
-    inline fract(const t_coef_den & p_num
+    inline constexpr fract(const t_coef_den & p_num
                 ,const t_coef_den & p_den
                 );
 
-    inline fract(const t_coef_den & p_num
+    inline constexpr fract(const t_coef_den & p_num
                 ,const t_coef_num & p_den
                 );
 
@@ -190,73 +391,104 @@ namespace quicky_utils
                           ,std::nullptr_t
                           );
 
-      inline fract operator+(const fract & p_op1
+      inline constexpr fract operator+(const fract & p_op1
 			   ) const;
 
-    inline fract operator-(const fract & p_op1
+    inline constexpr fract operator-(const fract & p_op1
 			   ) const;
 
-    inline fract operator*(const fract & p_op1
+    inline constexpr fract operator*(const fract & p_op1
 			   ) const;
 
-    inline fract operator/(const fract & p_op1
+    inline constexpr fract operator/(const fract & p_op1
 			   ) const;
 
-    inline bool operator==(const fract & p_op)const;
+    inline constexpr bool operator==(const fract & p_op)const;
 
-    inline bool operator!=(const fract & p_op)const;
+    inline constexpr bool operator!=(const fract & p_op)const;
 
-    inline fract operator-()const;
-    inline fract operator+()const;
+    inline constexpr fract operator-()const;
+    inline constexpr fract operator+()const;
 
    /**
        Pre increment
     */
-    inline fract & operator++();
+    inline constexpr fract & operator++();
 
     /**
        Post increment
      */
-    inline fract operator++(int);
+    inline constexpr fract operator++(int);
 
     /**
        Pre decrement
     */
-    inline fract & operator--();
+    inline constexpr fract & operator--();
 
     /**
        Post decrement
      */
-    inline fract operator--(int);
+    inline constexpr fract operator--(int);
 
     /**
        Conversion operator
     */
-    inline operator bool()const;
+    inline constexpr operator bool()const;
+
+    inline constexpr fract & operator+=(const fract & p_op1);
+    inline constexpr fract & operator-=(const fract & p_op1);
+    inline constexpr fract & operator*=(const fract & p_op1);
+    inline constexpr fract & operator/=(const fract & p_op1);
 
-    inline fract & operator+=(const fract & p_op1);
-    inline fract & operator-=(const fract & p_op1);
-    inline fract & operator*=(const fract & p_op1);
-    inline fract & operator/=(const fract & p_op1);
+    /**
+       Three way comparison
+       @param fraction to compare with
+       @return -1, 0 or 1 if fraction is lower, equal or greater than
+       parameter
+    */
+    [[nodiscard]]
+    inline constexpr
+    int compare(const fract & p_op)const;
 
-    inline bool operator<(const fract & p_op)const;
-    inline bool operator<=(const fract & p_op)const;
-    inline bool operator>(const fract & p_op)const;
-    inline bool operator>=(const fract & p_op)const;
+    inline constexpr bool operator<(const fract & p_op)const;
+    inline constexpr bool operator<=(const fract & p_op)const;
+    inline constexpr bool operator>(const fract & p_op)const;
+    inline constexpr bool operator>=(const fract & p_op)const;
 
-    inline fract& operator=(fract&& p_other) noexcept;
-    inline fract& operator=(const fract& p_other);
-    inline fract(const fract & p_op);
+    inline constexpr fract& operator=(fract&& p_other) noexcept;
+    inline constexpr fract& operator=(const fract& p_other);
+    inline constexpr fract(const fract & p_op);
+    inline constexpr fract(fract && p_op) noexcept;
 
+    /**
+       Conversion correctly rounded to nearest float
+    */
     [[nodiscard]]
-    inline
+    inline constexpr
     float to_float()const;
 
+    /**
+       Conversion correctly rounded to nearest double
+    */
     [[nodiscard]]
-    inline
+    inline constexpr
     double to_double()const;
 
-    fract abs() const;
+    /**
+       Best rational approximation of a double: closest fraction whose
+       denominator does not exceed a bound, computed from continued fraction
+       expansion of exact value of double. When last convergent and largest
+       semiconvergent are equally close the convergent is chosen
+       @param value to approximate
+       @param maximum denominator
+       @return closest fraction
+    */
+    inline static
+    fract from_double(double p_value
+                     ,t_coef_den p_max_den = std::numeric_limits<t_coef_den>::max()
+                     );
+
+    constexpr fract abs() const;
 
     /**
        Return PGCD computed yusing Euclide algorithm
@@ -315,45 +547,53 @@ namespace quicky_utils
                    );
 
     /**
-       Return PGCD computed yusing Euclide algorithm
+       Return PGCD computed using binary algorithm for built-in
+       coefficients, gcd of coefficient traits when they provide one and
+       Euclide algorithm otherwise
        @param first number
        @param second number
        @return PGCD of first and second number
     */
-    inline static
+    inline static constexpr
     t_coef_den PGCD(const t_coef_num & p_a
                    ,const t_coef_num & p_b
 	               );
 
     /**
-       Return PGCD computed yusing Euclide algorithm
+       Return PGCD computed using binary algorithm for built-in
+       coefficients, gcd of coefficient traits when they provide one and
+       Euclide algorithm otherwise
        @param first number
        @param second number
        @return PGCD of first and second number
     */
-    inline static
+    inline static constexpr
     t_coef_den PGCD(const t_coef_den & p_a
                    ,const t_coef_den & p_b
                    );
 
     /**
-       Return PGCD computed yusing Euclide algorithm
+       Return PGCD computed using binary algorithm for built-in
+       coefficients, gcd of coefficient traits when they provide one and
+       Euclide algorithm otherwise
        @param first number
        @param second number
        @return PGCD of first and second number
     */
-    inline static
+    inline static constexpr
     t_coef_den PGCD(const t_coef_num & p_a
                    ,const t_coef_den & p_b
                    );
 
     /**
-       Return PGCD computed yusing Euclide algorithm
+       Return PGCD computed using binary algorithm for built-in
+       coefficients, gcd of coefficient traits when they provide one and
+       Euclide algorithm otherwise
        @param first number
        @param second number
        @return PGCD of first and second number
     */
-    inline static
+    inline static constexpr
     t_coef_den PGCD(const t_coef_den & p_a
                    ,const t_coef_num & p_b
                    );
@@ -364,7 +604,7 @@ namespace quicky_utils
        @param second number
        @return PPCM of first and second number
     */
-    inline static
+    inline static constexpr
     t_coef_den PPCM(const t_coef_num & p_a
                    ,const t_coef_num & p_b
                    );
@@ -375,7 +615,7 @@ namespace quicky_utils
        @param second number
        @return PPCM of first and second number
     */
-    inline static
+    inline static constexpr
     t_coef_den PPCM(const t_coef_den & p_a
                    ,const t_coef_den & p_b
                    );
@@ -386,7 +626,7 @@ namespace quicky_utils
        @param second number
        @return PPCM of first and second number
     */
-    inline static
+    inline static constexpr
     t_coef_den PPCM(const t_coef_num & p_a
                    ,const t_coef_den & p_b
                    );
@@ -397,7 +637,7 @@ namespace quicky_utils
        @param second number
        @return PPCM of first and second number
     */
-    inline static
+    inline static constexpr
     t_coef_den PPCM(const t_coef_den & p_a
                    ,const t_coef_num & p_b
                    );
@@ -459,12 +699,143 @@ namespace quicky_utils
                    );
 
     private:
-#ifdef FRACT_DOUBLE_CHECK
-    inline static bool double_equal(const double & p_op1,
-				    const double & p_op2
-				    );
-    double m_double;
-#endif // FRACT_DOUBLE_CHECK
+    /**
+       Build fraction from numerator and denominator divided by their PGCD
+       @param numerator
+       @param positive denominator
+       @return reduced fraction
+    */
+    inline static constexpr
+    fract reduce(const t_coef_num & p_num
+                ,const t_coef_den & p_den
+                );
+
+    /**
+       Build fraction from absolute values of numerator and denominator
+       divided by their PGCD
+       @param absolute value of numerator
+       @param absolute value of denominator
+       @param true if fraction is negative
+       @return reduced fraction
+    */
+    inline static constexpr
+    fract reduce(const t_coef_den & p_num
+                ,const t_coef_den & p_den
+                ,bool p_negative
+                );
+
+    /**
+       Build fraction from coprime numerator and denominator without
+       computing their PGCD
+       @param numerator
+       @param positive denominator
+       @return fraction
+    */
+    inline static constexpr
+    fract make_reduced(t_coef_num p_num
+                      ,t_coef_den p_den
+                      );
+
+    /**
+       Return PGCD computed using binary algorithm: common factors of two are
+       extracted with count trailing zeros and odd numbers are reduced by
+       substraction so that no division is performed
+       @param first number
+       @param second number
+       @return PGCD of first and second number
+    */
+    inline static constexpr
+    t_coef_den binary_PGCD(t_coef_den p_a
+                          ,t_coef_den p_b
+                          );
+
+    /**
+       Compare positive fractions by expanding them in continued fractions
+       so that no product is computed
+       @tparam unsigned integer type of numbers
+       @param first numerator
+       @param first denominator
+       @param second numerator
+       @param second denominator
+       @return -1, 0 or 1 if first fraction is lower, equal or greater than
+       second one
+    */
+    template <typename T_UINT>
+    inline static constexpr
+    int continued_fraction_compare(T_UINT p_num1
+                                  ,T_UINT p_den1
+                                  ,T_UINT p_num2
+                                  ,T_UINT p_den2
+                                  );
+
+    /**
+       Return number of trailing zeros of a non null built-in coefficient
+    */
+    inline static constexpr
+    unsigned int count_trailing_zeros(const t_coef_den & p_value);
+
+    /**
+       Return number of significant bits of a built-in coefficient
+    */
+    inline static constexpr
+    unsigned int bit_length(const t_coef_den & p_value);
+
+    /**
+       Conversion correctly rounded to nearest floating point number
+       @tparam floating point type
+    */
+    template <typename T_FLOAT>
+    inline constexpr
+    T_FLOAT to_floating()const;
+
+    /**
+       Quotient of built-in coefficients correctly rounded to nearest
+       floating point number
+       @tparam floating point type
+       @param numerator
+       @param non null denominator
+       @return rounded quotient
+    */
+    template <typename T_FLOAT>
+    inline static constexpr
+    T_FLOAT rounded_quotient(t_coef_den p_num
+                            ,t_coef_den p_den
+                            );
+
+    /**
+       Multiplication of a floating point number by a power of 2, exact as
+       std::ldexp when result is normal, but usable at compile time
+       @tparam floating point type
+       @param value
+       @param exponent of power of 2
+       @return scaled value
+    */
+    template <typename T_FLOAT>
+    inline static constexpr
+    T_FLOAT scale_by_power_of_2(T_FLOAT p_value
+                               ,int p_exponent
+                               );
+
+    /**
+       Best rational approximation of a positive fraction given by its
+       numerator and denominator, whose coefficients fit in fract
+       coefficients and whose denominator does not exceed a bound
+       @tparam unsigned integer type wide enough for numerator and
+       denominator
+       @param numerator
+       @param denominator
+       @param true if result must be negated
+       @param maximum denominator
+       @return closest fraction
+    */
+    template <typename T_UINT>
+    inline static
+    fract best_approximation(T_UINT p_num
+                            ,T_UINT p_den
+                            ,bool p_negative
+                            ,t_coef_den p_max_den
+                            );
+
     t_coef_num m_num;
     t_coef_den m_den;
   };
@@ -472,9 +843,6 @@ namespace quicky_utils
   //----------------------------------------------------------------------------
   template <typename T>
   constexpr fract<T>::fract() noexcept:
-#ifdef FRACT_DOUBLE_CHECK
-    m_double(0.0),
-#endif // FRACT_DOUBLE_CHECK
     m_num(0),
     m_den((unsigned int)1)
   {
@@ -483,9 +851,6 @@ namespace quicky_utils
   //----------------------------------------------------------------------------
   template <typename T>
   constexpr fract<T>::fract(const t_coef_num & p_num):
-#ifdef FRACT_DOUBLE_CHECK
-    m_double(p_num),
-#endif // FRACT_DOUBLE_CHECK
     m_num(p_num),
     m_den((unsigned int)1)
   {
@@ -495,9 +860,6 @@ namespace quicky_utils
   template <typename T>
   template <typename T_ARG>
   constexpr fract<T>::fract(const T_ARG & p_num):
-#ifdef FRACT_DOUBLE_CHECK
-          m_double(p_num),
-#endif // FRACT_DOUBLE_CHECK
           m_num(p_num),
           m_den((unsigned int)1)
     {
@@ -508,9 +870,6 @@ namespace quicky_utils
   constexpr fract<T>::fract(const t_coef_den & p_den
                            ,std::nullptr_t
                            ):
-#ifdef FRACT_DOUBLE_CHECK
-            m_double(((double)1)/((double)p_den)),
-#endif // FRACT_DOUBLE_CHECK
           m_num(1),
           m_den(p_den)
   {
@@ -518,69 +877,38 @@ namespace quicky_utils
 
     //----------------------------------------------------------------------------
   template <typename T>
-  fract<T>::fract(const t_coef_num & p_num
-	             ,const t_coef_num & p_den
-	             )
-#ifdef FRACT_DOUBLE_CHECK
-    :m_double(((double)p_num)/((double)p_den))
-#endif // FRACT_DOUBLE_CHECK
+  constexpr fract<T>::fract(const t_coef_num & p_num
+                           ,const t_coef_num & p_den
+                           ):
+    fract(reduce(t_coef_traits::abs(p_num), t_coef_traits::abs(p_den), (p_num < (t_coef_num)0) != (p_den < (t_coef_num)0)))
   {
-    assert(p_den);
-    t_coef_den l_pgcd = PGCD(p_num,p_den);
-    m_num = std::abs(p_num) / ((t_coef_num)l_pgcd);
-
-    if((p_num > (decltype(m_num))0 && p_den < (decltype(m_num))0) ||
-       (p_num < (decltype(m_num))0 && p_den > (decltype(m_num))0)
-       )
-      {
-          m_num = -m_num;
-      }
-    m_den = (t_coef_den)(std::abs(p_den)) / l_pgcd;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T>::fract(const t_coef_num & p_num
-                 ,const t_coef_den & p_den
-                 )
-#ifdef FRACT_DOUBLE_CHECK
-    :m_double(((double)p_num)/((double)p_den))
-#endif // FRACT_DOUBLE_CHECK
+  constexpr fract<T>::fract(const t_coef_num & p_num
+                           ,const t_coef_den & p_den
+                           ):
+    fract(reduce(p_num, p_den))
   {
-      assert(p_den);
-      t_coef_den l_pgcd = PGCD(p_num,p_den);
-      m_num = p_num / ((t_coef_num)l_pgcd);
-      m_den = p_den / l_pgcd;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T>::fract(const t_coef_den & p_num
-                 ,const t_coef_den & p_den
-                 )
-#ifdef FRACT_DOUBLE_CHECK
-    :m_double(((double)p_num)/((double)p_den))
-#endif // FRACT_DOUBLE_CHECK
+  constexpr fract<T>::fract(const t_coef_den & p_num
+                           ,const t_coef_den & p_den
+                           ):
+    fract(reduce(p_num, p_den, false))
   {
-      assert(p_den);
-      t_coef_den l_pgcd = PGCD(p_num,p_den);
-      m_num = (t_coef_num)(p_num / l_pgcd);
-      m_den = p_den / l_pgcd;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T>::fract(const t_coef_den & p_num
-                 ,const t_coef_num & p_den
-                 )
-#ifdef FRACT_DOUBLE_CHECK
-    :m_double(((double)p_num)/((double)p_den))
-#endif // FRACT_DOUBLE_CHECK
+  constexpr fract<T>::fract(const t_coef_den & p_num
+                           ,const t_coef_num & p_den
+                           ):
+    fract(reduce(p_num, t_coef_traits::abs(p_den), p_den < (t_coef_num)0))
   {
-      assert(p_den);
-      t_coef_den l_pgcd = PGCD(p_num,p_den);
-      m_num = (t_coef_num)(p_num / l_pgcd) * ((t_coef_num)(p_den < ((t_coef_num)0) ? - 1: 1));
-      m_den = ((t_coef_den) std::abs(p_den)) / l_pgcd;
   }
 
   //----------------------------------------------------------------------------
@@ -589,9 +917,6 @@ namespace quicky_utils
                            ,const t_coef_num & p_den
                            ,std::nullptr_t
                            ):
-#ifdef FRACT_DOUBLE_CHECK
-            m_double(((double)p_num)/((double)p_den)),
-#endif // FRACT_DOUBLE_CHECK
           m_num((std::abs(p_num) / ((t_coef_num)PGCD(p_num,p_den,nullptr))) * (((p_num > 0 && p_den < 0) || (p_num < 0 && p_den > 0))? -1 : 1)),
           m_den((t_coef_den)(std::abs(p_den)) / PGCD(p_num,p_den,nullptr))
   {
@@ -604,9 +929,6 @@ namespace quicky_utils
                            ,const t_coef_den & p_den
                            ,std::nullptr_t
                            ):
-#ifdef FRACT_DOUBLE_CHECK
-            m_double(((double)p_num)/((double)p_den)),
-#endif // FRACT_DOUBLE_CHECK
           m_num(p_num / ((t_coef_num)PGCD(p_num,p_den,nullptr))),
           m_den(p_den / PGCD(p_num,p_den,nullptr))
   {
@@ -619,9 +941,6 @@ namespace quicky_utils
                            ,const t_coef_num & p_den
                            ,std::nullptr_t
                            ):
-#ifdef FRACT_DOUBLE_CHECK
-            m_double(((double)p_num)/((double)p_den)),
-#endif // FRACT_DOUBLE_CHECK
             m_num(((t_coef_num)(p_num / PGCD(p_num,p_den,nullptr))) * ((t_coef_num )(p_den < 0 ? -1 : 1))),
             m_den((t_coef_den)(std::abs(p_den)) / PGCD(p_num,p_den,nullptr))
     {
@@ -634,9 +953,6 @@ namespace quicky_utils
                            ,const t_coef_den & p_den
                            ,std::nullptr_t
                            ):
-#ifdef FRACT_DOUBLE_CHECK
-            m_double(((double)p_num)/((double)p_den)),
-#endif // FRACT_DOUBLE_CHECK
           m_num(((t_coef_num)(p_num / PGCD(p_num,p_den,nullptr)))),
           m_den(p_den / PGCD(p_num,p_den,nullptr))
   {
@@ -645,7 +961,7 @@ namespace quicky_utils
 
     //----------------------------------------------------------------------------
   template <typename T>
-  fract<T> fract<T>::operator+(const fract & p_op
+  constexpr fract<T> fract<T>::operator+(const fract & p_op
 			 ) const
   {
     t_coef_den l_ppcm = PPCM(this->m_den,
@@ -653,15 +969,18 @@ namespace quicky_utils
 			 );
     t_coef_num l_num = (t_coef_num)(l_ppcm / this->m_den) * this->m_num + (t_coef_num)(l_ppcm / p_op.m_den) * p_op.m_num;
     fract l_result = fract(l_num, l_ppcm);
-#ifdef FRACT_DOUBLE_CHECK
-    assert(double_equal(l_result.to_double(), (this->to_double() + p_op.to_double())));
-#endif // FRACT_DOUBLE_CHECK
+#ifdef FRACT_SAMPLED_CHECK
+    if(!__builtin_is_constant_evaluated())
+      {
+        fract_verifier::verify(fract_verifier::operation_t::ADD, *this, p_op, l_result);
+      }
+#endif // FRACT_SAMPLED_CHECK
     return l_result;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T> fract<T>::operator-(const fract & p_op
+  constexpr fract<T> fract<T>::operator-(const fract & p_op
 			 ) const
   {
     t_coef_den l_ppcm = PPCM(this->m_den,
@@ -669,240 +988,229 @@ namespace quicky_utils
 			 );
     t_coef_num l_num = (t_coef_num)(l_ppcm / this->m_den) * this->m_num - (t_coef_num)(l_ppcm / p_op.m_den) * p_op.m_num;
     fract l_result = fract(l_num, l_ppcm);
-#ifdef FRACT_DOUBLE_CHECK
-    assert(double_equal(l_result.to_double(), (this->to_double() - p_op.to_double())));
-#endif // FRACT_DOUBLE_CHECK
+#ifdef FRACT_SAMPLED_CHECK
+    if(!__builtin_is_constant_evaluated())
+      {
+        fract_verifier::verify(fract_verifier::operation_t::SUB, *this, p_op, l_result);
+      }
+#endif // FRACT_SAMPLED_CHECK
     return l_result;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T> fract<T>::operator*(const fract & p_op
+  constexpr fract<T> fract<T>::operator*(const fract & p_op
 			 ) const 
   {
-    fract l_result = fract(m_num * p_op.m_num,m_den * p_op.m_den);
-#ifdef FRACT_DOUBLE_CHECK
-    assert(double_equal(l_result.to_double(), (this->to_double() * p_op.to_double())));
-#endif // FRACT_DOUBLE_CHECK
+    if(!m_num || !p_op.m_num)
+      {
+        return fract();
+      }
+    // Knuth cross reduction: operands being reduced, common factors of
+    // result can only come from a and d or from c and b. Removing them
+    // before multiplying keeps products small and result reduced
+    t_coef_den l_pgcd_1 = PGCD(m_num, p_op.m_den);
+    t_coef_den l_pgcd_2 = PGCD(p_op.m_num, m_den);
+    fract l_result = make_reduced((t_coef_num)(m_num / (t_coef_num)l_pgcd_1) * (t_coef_num)(p_op.m_num / (t_coef_num)l_pgcd_2)
+                                 ,(t_coef_den)(m_den / l_pgcd_2) * (t_coef_den)(p_op.m_den / l_pgcd_1)
+                                 );
+#ifdef FRACT_SAMPLED_CHECK
+    if(!__builtin_is_constant_evaluated())
+      {
+        fract_verifier::verify(fract_verifier::operation_t::MUL, *this, p_op, l_result);
+      }
+#endif // FRACT_SAMPLED_CHECK
     return l_result;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T> fract<T>::operator/(const fract & p_op
+  constexpr fract<T> fract<T>::operator/(const fract & p_op
 			 )const
   {
-    fract l_result = fract(m_num * (t_coef_num)p_op.m_den,((t_coef_num)(m_den)) * p_op.m_num);
-#ifdef FRACT_DOUBLE_CHECK
-    assert(double_equal(l_result.to_double(), (this->to_double() / p_op.to_double())));
-#endif // FRACT_DOUBLE_CHECK
+    assert(p_op.m_num);
+    if(!m_num)
+      {
+        return fract();
+      }
+    // Cross reduction of a / b by c / d = (a * d) / (b * c)
+    t_coef_den l_pgcd_num = PGCD(m_num, p_op.m_num);
+    t_coef_den l_pgcd_den = PGCD(m_den, p_op.m_den);
+    t_coef_num l_num = (t_coef_num)(m_num / (t_coef_num)l_pgcd_num) * (t_coef_num)(p_op.m_den / l_pgcd_den);
+    t_coef_den l_den = (t_coef_den)(m_den / l_pgcd_den) * t_coef_traits::abs(p_op.m_num / (t_coef_num)l_pgcd_num);
+    fract l_result = make_reduced(p_op.m_num < (t_coef_num)0 ? -l_num : l_num, l_den);
+#ifdef FRACT_SAMPLED_CHECK
+    if(!__builtin_is_constant_evaluated())
+      {
+        fract_verifier::verify(fract_verifier::operation_t::DIV, *this, p_op, l_result);
+      }
+#endif // FRACT_SAMPLED_CHECK
     return l_result;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  bool fract<T>::operator==(const fract & p_op)const
+  constexpr bool fract<T>::operator==(const fract & p_op)const
   {
     bool l_result = m_num == p_op.m_num && m_den == p_op.m_den;
-#ifdef FRACT_DOUBLE_CHECK
-    assert(l_result == double_equal(this->to_double(), p_op.to_double()));
-#endif // FRACT_DOUBLE_CHECK
     return l_result;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  bool fract<T>::operator!=(const fract & p_op)const
+  constexpr bool fract<T>::operator!=(const fract & p_op)const
   {
     bool l_result = m_num != p_op.m_num || m_den != p_op.m_den;
-#ifdef FRACT_DOUBLE_CHECK
-    assert(l_result != double_equal(this->to_double(), p_op.to_double()));
-#endif // FRACT_DOUBLE_CHECK
     return l_result;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T> & fract<T>::operator++()
+  constexpr fract<T> & fract<T>::operator++()
   {
-#ifdef FRACT_DOUBLE_CHECK
-    double l_before = this->to_double();
-#endif // FRACT_DOUBLE_CHECK
     *this = *this + fract((typename fract<T>::t_coef_num)1);
-#ifdef FRACT_DOUBLE_CHECK
-    assert(double_equal(this->to_double(), (l_before + 1)));
-#endif // FRACT_DOUBLE_CHECK
     return *this;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T> fract<T>::operator++(int)
+  constexpr fract<T> fract<T>::operator++(int)
   {
     fract tmp(*this); 
     *this = *this + fract((typename fract<T>::t_coef_num)1);
-#ifdef FRACT_DOUBLE_CHECK
-    assert(double_equal(this->to_double(), (tmp.to_double() + 1)));
-#endif // FRACT_DOUBLE_CHECK
     return tmp;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T> & fract<T>::operator--()
+  constexpr fract<T> & fract<T>::operator--()
   {
-#ifdef FRACT_DOUBLE_CHECK
-    double l_before = this->to_double();
-#endif // FRACT_DOUBLE_CHECK
     *this = *this - fract((typename fract<T>::t_coef_num)1);
-#ifdef FRACT_DOUBLE_CHECK
-    assert(double_equal(this->to_double(), (l_before - 1)));
-#endif // FRACT_DOUBLE_CHECK
     return *this;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T> fract<T>::operator--(int)
+  constexpr fract<T> fract<T>::operator--(int)
   {
     fract tmp(*this); 
     *this = *this - fract((typename fract<T>::t_coef_num)1);
-#ifdef FRACT_DOUBLE_CHECK
-    assert(double_equal(this->to_double(), (tmp.to_double() - 1)));
-#endif // FRACT_DOUBLE_CHECK
     return tmp;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T> fract<T>::operator-()const
+  constexpr fract<T> fract<T>::operator-()const
   {
-#ifdef FRACT_DOUBLE_CHECK
-    double l_before = this->to_double();
-#endif // FRACT_DOUBLE_CHECK
-    fract l_result = fract(-m_num, m_den);
-#ifdef FRACT_DOUBLE_CHECK
-    assert(double_equal(this->to_double(), -l_before));
-#endif // FRACT_DOUBLE_CHECK
+    fract l_result = make_reduced(-m_num, m_den);
     return l_result;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T> fract<T>::operator+()const
+  constexpr fract<T> fract<T>::operator+()const
   {
-    return fract(m_num, m_den);
+    return *this;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T>::operator bool()const
+  constexpr fract<T>::operator bool()const
   {
     return (bool)m_num;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T> & fract<T>::operator+=(const fract & p_op1)
+  constexpr fract<T> & fract<T>::operator+=(const fract & p_op1)
   {
-#ifdef FRACT_DOUBLE_CHECK
-    double l_before = this->to_double();
-#endif // FRACT_DOUBLE_CHECK
     *this = *this + p_op1;
-#ifdef FRACT_DOUBLE_CHECK
-    assert(double_equal(this->to_double(), (l_before + p_op1.to_double())));
-#endif // FRACT_DOUBLE_CHECK
     return * this;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T> & fract<T>::operator-=(const fract & p_op1)
+  constexpr fract<T> & fract<T>::operator-=(const fract & p_op1)
   {
-#ifdef FRACT_DOUBLE_CHECK
-    double l_before = this->to_double();
-#endif // FRACT_DOUBLE_CHECK
     *this = *this - p_op1;
-#ifdef FRACT_DOUBLE_CHECK
-    assert(double_equal(this->to_double(), (l_before - p_op1.to_double())));
-#endif // FRACT_DOUBLE_CHECK
     return * this;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T> & fract<T>::operator*=(const fract & p_op1)
+  constexpr fract<T> & fract<T>::operator*=(const fract & p_op1)
   {
-#ifdef FRACT_DOUBLE_CHECK
-    double l_before = this->to_double();
-#endif // FRACT_DOUBLE_CHECK
     *this = *this * p_op1;
-#ifdef FRACT_DOUBLE_CHECK
-    assert(double_equal(this->to_double(), (l_before * p_op1.to_double())));
-#endif // FRACT_DOUBLE_CHECK
     return * this;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T> & fract<T>::operator/=(const fract & p_op1)
+  constexpr fract<T> & fract<T>::operator/=(const fract & p_op1)
   {
-#ifdef FRACT_DOUBLE_CHECK
-    double l_before = this->to_double();
-#endif // FRACT_DOUBLE_CHECK
     *this = *this / p_op1;
-#ifdef FRACT_DOUBLE_CHECK
-    assert(double_equal(this->to_double(), (l_before / p_op1.to_double())));
-#endif // FRACT_DOUBLE_CHECK
     return * this;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  bool fract<T>::operator<(const fract & p_op)const
+  constexpr int fract<T>::compare(const fract & p_op)const
   {
-    t_coef_den l_ppcm = PPCM(this->m_den,
-			     p_op.m_den
-			     );
-    return ((t_coef_num)(l_ppcm / this->m_den) * this->m_num) < ((t_coef_num)(l_ppcm / p_op.m_den) * p_op.m_num);
+    typedef typename fract_wide_coef<t_coef_num>::type t_wide;
+    if constexpr (!std::is_void<t_wide>::value)
+      {
+        // Denominators are positive so a / b < c / d <=> a * d < c * b
+        t_wide l_left = (t_wide)m_num * (t_wide)p_op.m_den;
+        t_wide l_right = (t_wide)p_op.m_num * (t_wide)m_den;
+        return (l_left > l_right) - (l_left < l_right);
+      }
+    else
+      {
+        bool l_negative = m_num < (t_coef_num)0;
+        if(l_negative != (p_op.m_num < (t_coef_num)0))
+          {
+            return l_negative ? -1 : 1;
+          }
+        if(!l_negative)
+          {
+            return continued_fraction_compare((t_coef_den)m_num, m_den, (t_coef_den)p_op.m_num, p_op.m_den);
+          }
+        // Order of negative fractions is reversed order of their absolute values
+        return continued_fraction_compare(t_coef_traits::abs(p_op.m_num), p_op.m_den, t_coef_traits::abs(m_num), m_den);
+      }
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  bool fract<T>::operator<=(const fract & p_op)const
+  constexpr bool fract<T>::operator<(const fract & p_op)const
   {
-    t_coef_den l_ppcm = PPCM(this->m_den,
-			     p_op.m_den
-			     );
-    return ((t_coef_num)(l_ppcm / this->m_den) * this->m_num) <= ((t_coef_num)(l_ppcm / p_op.m_den) * p_op.m_num);
+    return compare(p_op) < 0;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  bool fract<T>::operator>(const fract & p_op)const
+  constexpr bool fract<T>::operator<=(const fract & p_op)const
   {
-    t_coef_den l_ppcm = PPCM(this->m_den,
-			     p_op.m_den
-			     );
-    return ((t_coef_num)(l_ppcm / this->m_den) * this->m_num) > ((t_coef_num)(l_ppcm / p_op.m_den) * p_op.m_num);
+    return compare(p_op) <= 0;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  bool fract<T>::operator>=(const fract & p_op)const
+  constexpr bool fract<T>::operator>(const fract & p_op)const
   {
-    t_coef_den l_ppcm = PPCM(this->m_den,
-			     p_op.m_den
-			     );
-    return ((t_coef_num)(l_ppcm / this->m_den) * this->m_num) >= ((t_coef_num)(l_ppcm / p_op.m_den) * p_op.m_num);
+    return compare(p_op) > 0;
+  }
+
+  //----------------------------------------------------------------------------
+  template <typename T>
+  constexpr bool fract<T>::operator>=(const fract & p_op)const
+  {
+    return compare(p_op) >= 0;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T>::fract(const fract & p_op):
-#ifdef FRACT_DOUBLE_CHECK
-    m_double(p_op.m_double),
-#endif // FRACT_DOUBLE_CHECK
+  constexpr fract<T>::fract(const fract & p_op):
     m_num(p_op.m_num),
     m_den(p_op.m_den)
   {
@@ -910,90 +1218,404 @@ namespace quicky_utils
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T>& fract<T>::operator=(fract&& p_other) noexcept
+  constexpr fract<T>::fract(fract && p_op) noexcept:
+    m_num(std::move(p_op.m_num)),
+    m_den(std::move(p_op.m_den))
+  {
+  }
+
+  //----------------------------------------------------------------------------
+  template <typename T>
+  constexpr fract<T>& fract<T>::operator=(fract&& p_other) noexcept
   {
 	// no-op on self-move-assignment
     if(this != &p_other)
       {
-	std::swap(m_num,p_other.m_num);
-	std::swap(m_den,p_other.m_den);
-#ifdef FRACT_DOUBLE_CHECK
-	std::swap(m_double,p_other.m_double);
-#endif // FRACT_DOUBLE_CHECK
+	m_num = std::move(p_other.m_num);
+	m_den = std::move(p_other.m_den);
       }
     return *this;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  fract<T>& fract<T>::operator=(const fract& p_other)
+  constexpr fract<T>& fract<T>::operator=(const fract& p_other)
   {
     this->m_num = p_other.m_num;
     this->m_den = p_other.m_den;
-#ifdef FRACT_DOUBLE_CHECK
-    this->m_double = p_other.m_double;
-#endif // FRACT_DOUBLE_CHECK
     return *this;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  float fract<T>::to_float()const
+  constexpr float fract<T>::to_float()const
+  {
+    return to_floating<float>();
+  }
+
+  //----------------------------------------------------------------------------
+  template <typename T>
+  constexpr double fract<T>::to_double()const
   {
-    return ((float)m_num)/((float)m_den);
+    return to_floating<double>();
+  }
 
+  //----------------------------------------------------------------------------
+  template <typename T>
+  template <typename T_FLOAT>
+  constexpr T_FLOAT fract<T>::to_floating()const
+  {
+    if constexpr (fract_builtin_coef<t_coef_den>::value)
+      {
+        T_FLOAT l_quotient = rounded_quotient<T_FLOAT>(t_coef_traits::abs(m_num), m_den);
+        return m_num < (t_coef_num)0 ? -l_quotient : l_quotient;
+      }
+    else
+      {
+        return ((T_FLOAT)m_num)/((T_FLOAT)m_den);
+      }
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  double fract<T>::to_double()const
+  template <typename T_FLOAT>
+  constexpr T_FLOAT fract<T>::rounded_quotient(t_coef_den p_num
+                                              ,t_coef_den p_den
+                                              )
   {
-    return ((double)m_num)/((double)m_den);
+      constexpr int l_digits = std::numeric_limits<T_FLOAT>::digits;
+      // Division of exactly representable operands is correctly rounded
+      if constexpr (std::numeric_limits<t_coef_den>::digits > l_digits)
+      {
+          constexpr t_coef_den l_exact_bound = (t_coef_den)1u << l_digits;
+          if(p_num >= l_exact_bound || p_den > l_exact_bound)
+          {
+              // Quotient is computed with at least two extra bits, last one
+              // being set when remainder is not null, so that its conversion
+              // is rounded as exact quotient would be
+              int l_shift = l_digits + 2 + (int)bit_length(p_den) - (int)bit_length(p_num);
+              unsigned __int128 l_num = p_num;
+              unsigned __int128 l_den = p_den;
+              if(l_shift >= 0)
+              {
+                  l_num <<= l_shift;
+              }
+              else
+              {
+                  l_den <<= -l_shift;
+              }
+              unsigned __int128 l_quotient = l_num / l_den;
+              l_quotient |= (bool)(l_num % l_den);
+              return scale_by_power_of_2((T_FLOAT)(uint64_t)l_quotient, -l_shift);
+          }
+      }
+      return ((T_FLOAT)p_num) / ((T_FLOAT)p_den);
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  typename fract<T>::t_coef_den fract<T>::PGCD(const t_coef_den & p_a
+  template <typename T_FLOAT>
+  constexpr T_FLOAT fract<T>::scale_by_power_of_2(T_FLOAT p_value
+                                                 ,int p_exponent
+                                                 )
+  {
+      // Square and multiply, factors being powers of 2 products are exact
+      T_FLOAT l_factor = p_exponent < 0 ? (T_FLOAT)0.5 : (T_FLOAT)2;
+      unsigned int l_exponent = p_exponent < 0 ? -(unsigned int)p_exponent : (unsigned int)p_exponent;
+      while(l_exponent)
+      {
+          if(l_exponent & 1u)
+          {
+              p_value *= l_factor;
+          }
+          l_exponent >>= 1;
+          if(l_exponent)
+          {
+              l_factor *= l_factor;
+          }
+      }
+      return p_value;
+  }
+
+  //----------------------------------------------------------------------------
+  template <typename T>
+  fract<T> fract<T>::from_double(double p_value
+                                ,t_coef_den p_max_den
+                                )
+  {
+      static_assert(fract_builtin_coef<t_coef_den>::value, "from_double requires built-in coefficients");
+      constexpr int l_digits = std::numeric_limits<double>::digits;
+      if(!p_max_den)
+      {
+          throw quicky_exception::quicky_logic_exception("Null maximum denominator", __LINE__, __FILE__);
+      }
+      double l_value = std::fabs(p_value);
+      if(!(l_value < std::ldexp(1.0, std::numeric_limits<t_coef_num>::digits)))
+      {
+          throw quicky_exception::quicky_logic_exception("Value " + std::to_string(p_value) + " cannot be represented by fract<" + type_string<T>::name() + ">", __LINE__, __FILE__);
+      }
+      bool l_negative = p_value < 0;
+      // Exact value of double is num / 2 ^ shift
+      int l_exponent = 0;
+      uint64_t l_num = (uint64_t)std::ldexp(std::frexp(l_value, &l_exponent), l_digits);
+      if(!l_num)
+      {
+          return fract();
+      }
+      int l_shift = l_digits - l_exponent;
+      if(l_shift <= 0)
+      {
+          t_coef_num l_integer = (t_coef_num)(l_num << -l_shift);
+          return make_reduced(l_negative ? -l_integer : l_integer, (t_coef_den)1u);
+      }
+      unsigned int l_zeros = std::min((unsigned int)__builtin_ctzll(l_num), (unsigned int)l_shift);
+      l_num >>= l_zeros;
+      l_shift -= (int)l_zeros;
+      // Values lower than 2 ^ -65 are closer to 0 than to 1 / max_den
+      if(l_shift > l_digits + 64)
+      {
+          return fract();
+      }
+      if(l_shift < 64)
+      {
+          return best_approximation<uint64_t>(l_num, (uint64_t)1u << l_shift, l_negative, p_max_den);
+      }
+      return best_approximation<unsigned __int128>(l_num, (unsigned __int128)1u << l_shift, l_negative, p_max_den);
+  }
+
+  //----------------------------------------------------------------------------
+  template <typename T>
+  template <typename T_UINT>
+  fract<T> fract<T>::best_approximation(T_UINT p_num
+                                       ,T_UINT p_den
+                                       ,bool p_negative
+                                       ,t_coef_den p_max_den
+                                       )
+  {
+      const T_UINT l_max_num = (T_UINT)std::numeric_limits<t_coef_num>::max();
+      const T_UINT l_max_den = (T_UINT)p_max_den;
+      T_UINT l_num;
+      T_UINT l_den;
+      if(p_den <= l_max_den && p_num <= l_max_num)
+      {
+          l_num = p_num;
+          l_den = p_den;
+      }
+      else
+      {
+          // Convergents h(n-2)/k(n-2) and h(n-1)/k(n-1) start from 0/1 and
+          // 1/0. Bounds are checked before computing next convergent so that
+          // products never overflow
+          T_UINT l_num0 = 0;
+          T_UINT l_den0 = 1;
+          T_UINT l_num1 = 1;
+          T_UINT l_den1 = 0;
+          T_UINT l_quotient;
+          for(;;)
+          {
+              l_quotient = p_num / p_den;
+              if((l_den1 && l_quotient > (l_max_den - l_den0) / l_den1) || (l_num1 && l_quotient > (l_max_num - l_num0) / l_num1))
+              {
+                  break;
+              }
+              T_UINT l_num2 = l_num0 + l_quotient * l_num1;
+              T_UINT l_den2 = l_den0 + l_quotient * l_den1;
+              l_num0 = l_num1;
+              l_den0 = l_den1;
+              l_num1 = l_num2;
+              l_den1 = l_den2;
+              T_UINT l_remainder = p_num - l_quotient * p_den;
+              p_num = p_den;
+              p_den = l_remainder;
+          }
+          // Value is (h1 * t + h0) / (k1 * t + k0) with t = num / den so that
+          // largest semiconvergent (h0 + f * h1) / (k0 + f * k1) is closer
+          // than convergent h1 / k1 iff t - f < f + k0 / k1
+          T_UINT l_factor = (l_max_den - l_den0) / l_den1;
+          if(l_num1)
+          {
+              l_factor = std::min(l_factor, (T_UINT)((l_max_num - l_num0) / l_num1));
+          }
+          bool l_semiconvergent = l_factor && (l_quotient / 2 < l_factor
+                                               || (!(l_quotient % 2) && l_quotient / 2 == l_factor && continued_fraction_compare(p_num - l_factor * p_den, p_den, l_factor * l_den1 + l_den0, l_den1) < 0)
+                                              );
+          l_num = l_semiconvergent ? l_num0 + l_factor * l_num1 : l_num1;
+          l_den = l_semiconvergent ? l_den0 + l_factor * l_den1 : l_den1;
+      }
+      t_coef_num l_result_num = (t_coef_num)l_num;
+      return make_reduced(p_negative ? -l_result_num : l_result_num, (t_coef_den)l_den);
+  }
+
+  //----------------------------------------------------------------------------
+  template <typename T>
+  constexpr typename fract<T>::t_coef_den fract<T>::PGCD(const t_coef_den & p_a
                                               ,const t_coef_den & p_b
                                               )
   {
       assert(p_b);
-      t_coef_den l_a = p_a;
-      t_coef_den l_b = p_b;
-      t_coef_den l_r;
-      while((l_r = (l_a % l_b)))
+      if constexpr (fract_builtin_coef<t_coef_den>::value)
+      {
+          return binary_PGCD(p_a, p_b);
+      }
+      else if constexpr (t_coef_traits::has_gcd)
+      {
+          return t_coef_traits::gcd(p_a, p_b);
+      }
+      else
+      {
+          t_coef_den l_a = p_a;
+          t_coef_den l_b = p_b;
+          t_coef_den l_r;
+          while((l_r = (l_a % l_b)))
+          {
+              l_a = l_b;
+              l_b = l_r;
+          }
+          return l_b;
+      }
+  }
+
+  //----------------------------------------------------------------------------
+  template <typename T>
+  constexpr fract<T> fract<T>::reduce(const t_coef_num & p_num
+                                     ,const t_coef_den & p_den
+                                     )
+  {
+      assert(p_den);
+      t_coef_den l_pgcd = PGCD(p_num, p_den);
+      // PGCD of null numerator is denominator that may not fit in numerator
+      return make_reduced(p_num ? (t_coef_num)(p_num / (t_coef_num)l_pgcd) : p_num, p_den / l_pgcd);
+  }
+
+  //----------------------------------------------------------------------------
+  template <typename T>
+  constexpr fract<T> fract<T>::reduce(const t_coef_den & p_num
+                                     ,const t_coef_den & p_den
+                                     ,bool p_negative
+                                     )
+  {
+      assert(p_den);
+      t_coef_den l_pgcd = PGCD(p_num, p_den);
+      t_coef_num l_num = (t_coef_num)(p_num / l_pgcd);
+      return make_reduced(p_negative ? -l_num : l_num, p_den / l_pgcd);
+  }
+
+  //----------------------------------------------------------------------------
+  template <typename T>
+  constexpr fract<T> fract<T>::make_reduced(t_coef_num p_num
+                                 ,t_coef_den p_den
+                                 )
+  {
+      fract l_result;
+      l_result.m_num = std::move(p_num);
+      l_result.m_den = std::move(p_den);
+      return l_result;
+  }
+
+  //----------------------------------------------------------------------------
+  template <typename T>
+  constexpr typename fract<T>::t_coef_den fract<T>::binary_PGCD(t_coef_den p_a
+                                                     ,t_coef_den p_b
+                                                     )
+  {
+      if(!p_a)
+      {
+          return p_b;
+      }
+      unsigned int l_shift = count_trailing_zeros(p_a | p_b);
+      p_a >>= count_trailing_zeros(p_a);
+      p_b >>= count_trailing_zeros(p_b);
+      while(p_a != p_b)
+      {
+          // Both numbers are odd so their difference is even. Minimum and
+          // absolute difference are computed with a mask instead of
+          // unpredictable branches while trailing zeros of b - a are counted
+          t_coef_den l_diff = (t_coef_den)(p_b - p_a);
+          t_coef_den l_mask = (t_coef_den)((t_coef_den)0 - (t_coef_den)(p_b < p_a));
+          unsigned int l_zeros = count_trailing_zeros(l_diff);
+          p_a = (t_coef_den)(p_a + (l_diff & l_mask));
+          p_b = (t_coef_den)((t_coef_den)((l_diff ^ l_mask) - l_mask) >> l_zeros);
+      }
+      return (t_coef_den)(p_a << l_shift);
+  }
+
+  //----------------------------------------------------------------------------
+  template <typename T>
+  template <typename T_UINT>
+  constexpr int fract<T>::continued_fraction_compare(T_UINT p_num1
+                                                    ,T_UINT p_den1
+                                                    ,T_UINT p_num2
+                                                    ,T_UINT p_den2
+                                                    )
+  {
+      for(;;)
+      {
+          T_UINT l_quotient1 = p_num1 / p_den1;
+          T_UINT l_quotient2 = p_num2 / p_den2;
+          if(l_quotient1 != l_quotient2)
+          {
+              return l_quotient1 < l_quotient2 ? -1 : 1;
+          }
+          T_UINT l_remainder1 = p_num1 % p_den1;
+          T_UINT l_remainder2 = p_num2 % p_den2;
+          if(!l_remainder1 || !l_remainder2)
+          {
+              return (bool)l_remainder1 - (bool)l_remainder2;
+          }
+          // r1 / d1 < r2 / d2 <=> d2 / r2 < d1 / r1
+          p_num1 = p_den2;
+          p_den2 = l_remainder1;
+          p_num2 = p_den1;
+          p_den1 = l_remainder2;
+      }
+  }
+
+  //----------------------------------------------------------------------------
+  template <typename T>
+  constexpr unsigned int fract<T>::count_trailing_zeros(const t_coef_den & p_value)
+  {
+      if constexpr (sizeof(t_coef_den) <= sizeof(unsigned int))
       {
-          l_a = l_b;
-          l_b = l_r;
+          return (unsigned int)__builtin_ctz((unsigned int)p_value);
+      }
+      else
+      {
+          return (unsigned int)__builtin_ctzll((unsigned long long)p_value);
       }
-      return l_b;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  typename fract<T>::t_coef_den fract<T>::PGCD(const t_coef_num & p_a
+  constexpr unsigned int fract<T>::bit_length(const t_coef_den & p_value)
+  {
+      return p_value ? (unsigned int)(std::numeric_limits<unsigned long long>::digits - __builtin_clzll((unsigned long long)p_value)) : 0u;
+  }
+
+  //----------------------------------------------------------------------------
+  template <typename T>
+  constexpr typename fract<T>::t_coef_den fract<T>::PGCD(const t_coef_num & p_a
                                               ,const t_coef_num & p_b
                                               )
   {
-      return PGCD((t_coef_den) std::abs(p_a),(t_coef_den) std::abs(p_b));
+      return PGCD(t_coef_traits::abs(p_a), t_coef_traits::abs(p_b));
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  typename fract<T>::t_coef_den fract<T>::PGCD(const t_coef_num & p_a
+  constexpr typename fract<T>::t_coef_den fract<T>::PGCD(const t_coef_num & p_a
                                               ,const t_coef_den & p_b
                                               )
   {
-      return PGCD((t_coef_den) std::abs(p_a), p_b);
+      return PGCD(t_coef_traits::abs(p_a), p_b);
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  typename fract<T>::t_coef_den fract<T>::PGCD(const t_coef_den & p_a
+  constexpr typename fract<T>::t_coef_den fract<T>::PGCD(const t_coef_den & p_a
                                               ,const t_coef_num & p_b
                                               )
   {
-      return PGCD(p_a, (t_coef_den) std::abs(p_b));
+      return PGCD(p_a, t_coef_traits::abs(p_b));
   }
 
   //----------------------------------------------------------------------------
@@ -1013,7 +1635,7 @@ namespace quicky_utils
                                                         ,std::nullptr_t
                                                         )
   {
-      return ((p_a % p_b) ? PGCD(p_b,p_a % p_b,nullptr) : p_b);
+      return ((p_a % p_b) ? PGCD(p_b,(t_coef_den)(p_a % p_b),nullptr) : p_b);
   }
 
   //----------------------------------------------------------------------------
@@ -1038,7 +1660,7 @@ namespace quicky_utils
 
   //----------------------------------------------------------------------------
   template <typename T>
-  typename fract<T>::t_coef_den fract<T>::PPCM(const t_coef_den & p_a,
+  constexpr typename fract<T>::t_coef_den fract<T>::PPCM(const t_coef_den & p_a,
                                                const t_coef_den & p_b
                                               )
   {
@@ -1047,29 +1669,29 @@ namespace quicky_utils
 
   //----------------------------------------------------------------------------
   template <typename T>
-  typename fract<T>::t_coef_den fract<T>::PPCM(const t_coef_num & p_a,
+  constexpr typename fract<T>::t_coef_den fract<T>::PPCM(const t_coef_num & p_a,
                                                const t_coef_num & p_b
                                               )
   {
-      return PPCM((t_coef_den )std::abs(p_a), (t_coef_den)std::abs(p_b));
+      return PPCM(t_coef_traits::abs(p_a), t_coef_traits::abs(p_b));
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  typename fract<T>::t_coef_den fract<T>::PPCM(const t_coef_num & p_a,
+  constexpr typename fract<T>::t_coef_den fract<T>::PPCM(const t_coef_num & p_a,
                                                const t_coef_den & p_b
                                               )
   {
-      return PPCM((t_coef_den )std::abs(p_a), p_b);
+      return PPCM(t_coef_traits::abs(p_a), p_b);
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  typename fract<T>::t_coef_den fract<T>::PPCM(const t_coef_den & p_a,
+  constexpr typename fract<T>::t_coef_den fract<T>::PPCM(const t_coef_den & p_a,
                                                const t_coef_num & p_b
                                               )
   {
-      return PPCM(p_a, (t_coef_den)std::abs(p_b));
+      return PPCM(p_a, t_coef_traits::abs(p_b));
   }
 
 
@@ -1129,111 +1751,87 @@ namespace quicky_utils
 
   //----------------------------------------------------------------------------
   template <typename T>
-  inline fract<T> operator+(const int & p_op1,
+  inline constexpr fract<T> operator+(const int & p_op1,
 			 const fract<T> & p_op2
 			 )
   {
     fract<T> l_result = fract<T>((typename fract<T>::t_coef_num)p_op1) + p_op2;
-#ifdef FRACT_DOUBLE_CHECK
-    assert(fract<T>::double_equal(l_result.to_double(), (((double)p_op1) + p_op2.to_double())));
-#endif // FRACT_DOUBLE_CHECK
     return l_result;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  inline fract<T> operator-(const int & p_op1,
+  inline constexpr fract<T> operator-(const int & p_op1,
 			 const fract<T> & p_op2
 			 )
   {
     fract<T> l_result = fract<T>(p_op1) - p_op2;
-#ifdef FRACT_DOUBLE_CHECK
-    assert(fract<T>::double_equal(l_result.to_double(), (((double)p_op1) - p_op2.to_double())));
-#endif // FRACT_DOUBLE_CHECK
     return l_result;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  inline fract<T> operator*(const int & p_op1,
+  inline constexpr fract<T> operator*(const int & p_op1,
 			 const fract<T> & p_op2
 			 )
   {
     fract<T> l_result = fract<T>(p_op1) * p_op2;
-#ifdef FRACT_DOUBLE_CHECK
-    assert(fract<T>::double_equal(l_result.to_double(), (((double)p_op1) * p_op2.to_double())));
-#endif // FRACT_DOUBLE_CHECK
     return l_result;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  inline fract<T> operator/(const int & p_op1,
+  inline constexpr fract<T> operator/(const int & p_op1,
 			 const fract<T> & p_op2
 			 )
   {
     fract<T> l_result = fract<T>(p_op1) / p_op2;
-#ifdef FRACT_DOUBLE_CHECK
-    assert(fract<T>::double_equal(l_result.to_double(), (((double)p_op1) / p_op2.to_double())));
-#endif // FRACT_DOUBLE_CHECK
     return l_result;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  inline bool operator==(const int & p_op1,
+  inline constexpr bool operator==(const int & p_op1,
 			 const fract<T> & p_op2
 			 )
   {
     bool l_result = fract<T>(p_op1) == p_op2;
-#ifdef FRACT_DOUBLE_CHECK
-    assert(l_result == fract<T>::double_equal((double)p_op1,p_op2));
-#endif // FRACT_DOUBLE_CHECK
     return l_result;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  inline bool operator==(const fract<T> & p_op1,
+  inline constexpr bool operator==(const fract<T> & p_op1,
 			 const int & p_op2
 			 )
   {
     bool l_result = p_op1 == fract<T>(p_op2);
-#ifdef FRACT_DOUBLE_CHECK
-    assert(l_result == fract<T>::double_equal(p_op1,(double)p_op2));
-#endif // FRACT_DOUBLE_CHECK
     return l_result;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  inline bool operator!=(const int & p_op1,
+  inline constexpr bool operator!=(const int & p_op1,
 			 const fract<T> & p_op2
 			 )
   {
     bool l_result = fract<T>((typename fract<T>::t_coef_num)p_op1) != p_op2;
-#ifdef FRACT_DOUBLE_CHECK
-    assert(l_result != fract<T>::double_equal((double)p_op1,p_op2.to_double()));
-#endif // FRACT_DOUBLE_CHECK
     return l_result;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  inline bool operator!=(const fract<T> & p_op1,
+  inline constexpr bool operator!=(const fract<T> & p_op1,
 			 const int & p_op2
 			 )
   {
     bool l_result = p_op1 != fract<T>((typename fract<T>::t_coef_num)p_op2);
-#ifdef FRACT_DOUBLE_CHECK
-    assert(l_result != fract<T>::double_equal(p_op1.to_double(),(double)p_op2));
-#endif // FRACT_DOUBLE_CHECK
     return l_result;
   }
 
   //----------------------------------------------------------------------------
   template <typename T>
-  inline bool operator<(const fract<T> & p_op1,
+  inline constexpr bool operator<(const fract<T> & p_op1,
 			const int & p_op2
 			)
   {
@@ -1242,7 +1840,7 @@ namespace quicky_utils
 
   //----------------------------------------------------------------------------
   template <typename T>
-  inline bool operator<=(const fract<T> & p_op1,
+  inline constexpr bool operator<=(const fract<T> & p_op1,
 			const int & p_op2
 			)
   {
@@ -1251,7 +1849,7 @@ namespace quicky_utils
 
   //----------------------------------------------------------------------------
   template <typename T>
-  inline bool operator>(const fract<T> & p_op1,
+  inline constexpr bool operator>(const fract<T> & p_op1,
 			const int & p_op2
 			)
   {
@@ -1260,7 +1858,7 @@ namespace quicky_utils
 
   //----------------------------------------------------------------------------
   template <typename T>
-  inline bool operator>=(const fract<T> & p_op1,
+  inline constexpr bool operator>=(const fract<T> & p_op1,
 			const int & p_op2
 			)
   {
@@ -1269,21 +1867,12 @@ namespace quicky_utils
 
   //---------------------------------------------------------------------------
   template <typename T>
-  fract<T>
+  constexpr fract<T>
   fract<T>::abs() const
   {
-        return fract<T>((t_coef_den)std::abs(m_num), m_den);
+        return make_reduced(m_num < (t_coef_num)0 ? -m_num : m_num, m_den);
   }
 
-#ifdef FRACT_DOUBLE_CHECK
-  bool fract<T>::double_equal(const double & p_op1,
-			   const double & p_op2
-			   )
-  {
-    double l_epsilon = 0.000000000000001;
-    return fabs(fabs(p_op1) - fabs(p_op2)) < l_epsilon;
-  }
-#endif // FRACT_DOUBLE_CHECK
   declare_template_specialise_type_string(typename T,fract<T>,"fract<" + type_string<T>::name() + ">");
   template_specialise_type_string(typename T,fract<T>,"fract<" + type_string<T>::name() + ">");
 
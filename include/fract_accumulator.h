@@ -0,0 +1,266 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+#ifndef QUICKY_UTILS_FRACT_ACCUMULATOR_H
+#define QUICKY_UTILS_FRACT_ACCUMULATOR_H
+
+#include "fract.h"
+#include <cstdint>
+
+namespace quicky_utils
+{
+    /**
+     * Sum of fractions whose reduction is deferred: terms are added on a
+     * common denominator without computing any PGCD. Accumulated value is
+     * reduced only when a term would make coefficients overflow or when
+     * normalize is called, so that normalized value is the one obtained
+     * with fract additions. Overflows are detected with compiler builtins
+     * so deferred reduction is restricted to built-in coefficients, other
+     * coefficients are reduced at each operation
+     */
+    template <typename T>
+    class fract_accumulator
+    {
+      public:
+        typedef fract<T> t_fract;
+        typedef typename t_fract::t_coef_num t_coef_num;
+        typedef typename t_fract::t_coef_den t_coef_den;
+
+        /**
+         * Empty constructor, accumulated value is 0
+         */
+        inline
+        fract_accumulator();
+
+        /**
+         * Constructor from initial value
+         * @param p_value initial value
+         */
+        inline explicit
+        fract_accumulator(const t_fract & p_value);
+
+        inline
+        fract_accumulator & operator+=(const t_fract & p_op);
+
+        inline
+        fract_accumulator & operator-=(const t_fract & p_op);
+
+        /**
+         * Reduce accumulated value
+         * @return accumulated value
+         */
+        inline
+        t_fract normalize();
+
+        /**
+         * Accumulated value, accumulator itself is not reduced
+         */
+        [[nodiscard]]
+        inline
+        t_fract get_fract() const;
+
+        /**
+         * Number of reductions done because a term would have made
+         * coefficients overflow
+         */
+        [[nodiscard]]
+        inline
+        uint64_t get_nb_overflow_reductions() const;
+
+      private:
+        /**
+         * Add or substract a term to accumulated value without reduction
+         * @tparam SUB true for substraction
+         * @param p_op term
+         * @return false if an intermediate result overflows, accumulated
+         * value is then unchanged
+         */
+        template <bool SUB>
+        inline
+        bool try_accumulate(const t_fract & p_op);
+
+        /**
+         * Add or substract a term, reducing accumulated value if needed
+         * @tparam SUB true for substraction
+         * @param p_op term
+         */
+        template <bool SUB>
+        inline
+        void accumulate(const t_fract & p_op);
+
+        t_coef_num m_num;
+        t_coef_den m_den;
+        uint64_t m_nb_overflow_reductions;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    fract_accumulator<T>::fract_accumulator()
+    :m_num((t_coef_num)0)
+    ,m_den((t_coef_den)1u)
+    ,m_nb_overflow_reductions(0)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    fract_accumulator<T>::fract_accumulator(const t_fract & p_value)
+    :m_num(p_value.m_num)
+    ,m_den(p_value.m_den)
+    ,m_nb_overflow_reductions(0)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    fract_accumulator<T> &
+    fract_accumulator<T>::operator+=(const t_fract & p_op)
+    {
+        accumulate<false>(p_op);
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    fract_accumulator<T> &
+    fract_accumulator<T>::operator-=(const t_fract & p_op)
+    {
+        accumulate<true>(p_op);
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename fract_accumulator<T>::t_fract
+    fract_accumulator<T>::normalize()
+    {
+        t_fract l_result = get_fract();
+        m_num = l_result.m_num;
+        m_den = l_result.m_den;
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename fract_accumulator<T>::t_fract
+    fract_accumulator<T>::get_fract() const
+    {
+        if constexpr (fract_builtin_coef<t_coef_den>::value)
+        {
+            return t_fract(m_num, m_den);
+        }
+        else
+        {
+            return t_fract::make_reduced(m_num, m_den);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    uint64_t
+    fract_accumulator<T>::get_nb_overflow_reductions() const
+    {
+        return m_nb_overflow_reductions;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <bool SUB>
+    bool
+    fract_accumulator<T>::try_accumulate(const t_fract & p_op)
+    {
+        t_coef_num l_num;
+        t_coef_den l_den;
+        t_coef_num l_term;
+        bool l_overflow = false;
+        // When a denominator is multiple of the other one it is kept as
+        // common denominator so that it grows only when needed
+        if(p_op.m_den == m_den)
+        {
+            l_num = m_num;
+            l_den = m_den;
+            l_term = p_op.m_num;
+        }
+        else if(!(m_den % p_op.m_den))
+        {
+            l_num = m_num;
+            l_den = m_den;
+            l_overflow = __builtin_mul_overflow(p_op.m_num, m_den / p_op.m_den, &l_term);
+        }
+        else if(!(p_op.m_den % m_den))
+        {
+            l_den = p_op.m_den;
+            l_term = p_op.m_num;
+            l_overflow = __builtin_mul_overflow(m_num, p_op.m_den / m_den, &l_num);
+        }
+        else
+        {
+            l_overflow = __builtin_mul_overflow(m_num, p_op.m_den, &l_num);
+            l_overflow |= __builtin_mul_overflow(p_op.m_num, m_den, &l_term);
+            l_overflow |= __builtin_mul_overflow(m_den, p_op.m_den, &l_den);
+        }
+        if constexpr (SUB)
+        {
+            l_overflow |= __builtin_sub_overflow(l_num, l_term, &l_num);
+        }
+        else
+        {
+            l_overflow |= __builtin_add_overflow(l_num, l_term, &l_num);
+        }
+        if(l_overflow)
+        {
+            return false;
+        }
+        m_num = l_num;
+        m_den = l_den;
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <bool SUB>
+    void
+    fract_accumulator<T>::accumulate(const t_fract & p_op)
+    {
+        if constexpr (fract_builtin_coef<t_coef_den>::value)
+        {
+            if(try_accumulate<SUB>(p_op))
+            {
+                return;
+            }
+            ++m_nb_overflow_reductions;
+            normalize();
+            if(try_accumulate<SUB>(p_op))
+            {
+                return;
+            }
+        }
+        // Reduced value or term does not fit: behave like fract
+        t_fract l_result = SUB ? get_fract() - p_op : get_fract() + p_op;
+        m_num = l_result.m_num;
+        m_den = l_result.m_den;
+    }
+
+#ifdef QUICKY_UTILS_SELF_TEST
+    /**
+     * Method regrouping tests of fract accumulator
+     */
+    bool
+    test_fract_accumulator();
+#endif // QUICKY_UTILS_SELF_TEST
+}
+#endif //QUICKY_UTILS_FRACT_ACCUMULATOR_H
+// EOF
@@ -0,0 +1,665 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+#ifndef QUICKY_UTILS_FRACT_ARRAY_H
+#define QUICKY_UTILS_FRACT_ARRAY_H
+
+#include "fract.h"
+#include "quicky_exception.h"
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace quicky_utils
+{
+    /**
+     * Array of fractions stored as separate numerator and denominator lanes
+     * so that operations on whole arrays are branchless loops vectorized by
+     * the compiler.
+     * Stored fractions are not necessarily reduced: additions can defer
+     * their reduction which is then done for the whole array by normalize.
+     * PGCD of a block of lanes is computed by binary algorithm removing one
+     * bit per step so that all lanes execute the same instructions, and
+     * exact divisions by PGCD are done in double precision which is exact
+     * for coefficients of at most 32 bits
+     * @tparam T coefficient type, built-in integer of at most 32 bits
+     */
+    template <typename T>
+    class fract_array
+    {
+      public:
+        typedef fract<T> t_fract;
+        typedef typename t_fract::t_coef_num t_coef_num;
+        typedef typename t_fract::t_coef_den t_coef_den;
+
+        static_assert(fract_builtin_coef<t_coef_den>::value && sizeof(t_coef_den) <= sizeof(uint32_t), "fract_array requires built-in coefficients of at most 32 bits");
+
+        /**
+         * Constructor of null fractions
+         * @param p_size number of fractions
+         */
+        inline explicit
+        fract_array(size_t p_size = 0);
+
+        /**
+         * Constructor from fractions
+         * @param p_fracts fractions
+         */
+        inline explicit
+        fract_array(const std::vector<t_fract> & p_fracts);
+
+        [[nodiscard]]
+        inline
+        size_t size() const;
+
+        /**
+         * Change number of fractions, new fractions are null
+         * @param p_size number of fractions
+         */
+        inline
+        void resize(size_t p_size);
+
+        /**
+         * Reduced fraction
+         * @param p_index index of fraction
+         * @return reduced fraction
+         */
+        [[nodiscard]]
+        inline
+        t_fract get(size_t p_index) const;
+
+        inline
+        void set(size_t p_index
+                ,const t_fract & p_fract
+                );
+
+        /**
+         * Reduced fractions
+         */
+        [[nodiscard]]
+        inline
+        std::vector<t_fract> to_fracts() const;
+
+        [[nodiscard]]
+        inline
+        const t_coef_num * get_nums() const;
+
+        [[nodiscard]]
+        inline
+        const t_coef_den * get_dens() const;
+
+        /**
+         * Reduce all fractions
+         */
+        inline
+        void normalize();
+
+        /**
+         * Convert all fractions, coefficients being exactly representable
+         * by doubles the conversion is correctly rounded as fract one
+         * @param p_result array of size() doubles receiving values
+         */
+        inline
+        void to_double(double * p_result) const;
+
+        /**
+         * Best rational approximations of doubles as computed by
+         * fract::from_double
+         * @param p_values array of doubles
+         * @param p_size number of doubles
+         * @param p_max_den maximum denominator
+         * @return reduced fractions
+         */
+        inline static
+        fract_array from_double(const double * p_values
+                               ,size_t p_size
+                               ,t_coef_den p_max_den = std::numeric_limits<t_coef_den>::max()
+                               );
+
+        /**
+         * Compute p_result = p_op1 + p_op2 for each fraction, p_result can
+         * be aliased with an operand
+         * @param p_op1 first operands
+         * @param p_op2 second operands
+         * @param p_result results
+         * @param p_reduce false to defer reduction of results
+         */
+        inline static
+        void add(const fract_array & p_op1
+                ,const fract_array & p_op2
+                ,fract_array & p_result
+                ,bool p_reduce = true
+                );
+
+        /**
+         * Compute p_result = p_op1 - p_op2 for each fraction, p_result can
+         * be aliased with an operand
+         * @param p_op1 first operands
+         * @param p_op2 second operands
+         * @param p_result results
+         * @param p_reduce false to defer reduction of results
+         */
+        inline static
+        void sub(const fract_array & p_op1
+                ,const fract_array & p_op2
+                ,fract_array & p_result
+                ,bool p_reduce = true
+                );
+
+        /**
+         * Compute p_result = p_op1 * p_op2 for each fraction with cross
+         * reduction, results are reduced when operands are. p_result can be
+         * aliased with an operand
+         * @param p_op1 first operands
+         * @param p_op2 second operands
+         * @param p_result results
+         */
+        inline static
+        void mul(const fract_array & p_op1
+                ,const fract_array & p_op2
+                ,fract_array & p_result
+                );
+
+        /**
+         * Three way comparison of each fraction
+         * @param p_op1 first operands
+         * @param p_op2 second operands
+         * @param p_result array of size() integers receiving -1, 0 or 1
+         */
+        inline static
+        void compare(const fract_array & p_op1
+                    ,const fract_array & p_op2
+                    ,int * p_result
+                    );
+
+        /**
+         * Compute PGCD of each pair of numbers
+         * @param p_a first numbers
+         * @param p_b second numbers
+         * @param p_result PGCD, can be aliased with an operand
+         * @param p_size number of pairs
+         */
+        inline static
+        void PGCD(const t_coef_den * p_a
+                 ,const t_coef_den * p_b
+                 ,t_coef_den * p_result
+                 ,size_t p_size
+                 );
+
+      private:
+        /**
+         * Compute addition or substraction of each fraction
+         * @tparam SUB true for substraction
+         */
+        template <bool SUB>
+        inline static
+        void add_sub(const fract_array & p_op1
+                    ,const fract_array & p_op2
+                    ,fract_array & p_result
+                    ,bool p_reduce
+                    );
+
+        /**
+         * Reduce fractions
+         * @param p_nums numerators
+         * @param p_dens denominators
+         * @param p_size number of fractions
+         */
+        inline static
+        void reduce(t_coef_num * p_nums
+                   ,t_coef_den * p_dens
+                   ,size_t p_size
+                   );
+
+        /**
+         * Check that operands have the same size and size result accordingly
+         */
+        inline static
+        void prepare(const fract_array & p_op1
+                    ,const fract_array & p_op2
+                    ,fract_array & p_result
+                    );
+
+        /**
+         * Branchless absolute value of a numerator
+         */
+        inline static
+        t_coef_den abs(t_coef_num p_value);
+
+        /**
+         * Division of a numerator by one of its divisors
+         */
+        inline static
+        t_coef_num exact_div(t_coef_num p_num
+                            ,t_coef_den p_divisor
+                            );
+
+        /**
+         * Division of a denominator by one of its divisors
+         */
+        inline static
+        t_coef_den exact_div(t_coef_den p_den
+                            ,t_coef_den p_divisor
+                            );
+
+        /**
+         * Number of fractions processed at once so that temporary lanes
+         * stay in L1 cache
+         */
+        static constexpr size_t m_chunk_size = 256;
+
+        std::vector<t_coef_num> m_nums;
+        std::vector<t_coef_den> m_dens;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    fract_array<T>::fract_array(size_t p_size)
+    :m_nums(p_size, (t_coef_num)0)
+    ,m_dens(p_size, (t_coef_den)1u)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    fract_array<T>::fract_array(const std::vector<t_fract> & p_fracts)
+    :m_nums(p_fracts.size())
+    ,m_dens(p_fracts.size())
+    {
+        for(size_t l_index = 0; l_index < p_fracts.size(); ++l_index)
+        {
+            m_nums[l_index] = p_fracts[l_index].m_num;
+            m_dens[l_index] = p_fracts[l_index].m_den;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    size_t
+    fract_array<T>::size() const
+    {
+        return m_nums.size();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    fract_array<T>::resize(size_t p_size)
+    {
+        m_nums.resize(p_size, (t_coef_num)0);
+        m_dens.resize(p_size, (t_coef_den)1u);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename fract_array<T>::t_fract
+    fract_array<T>::get(size_t p_index) const
+    {
+        return t_fract(m_nums[p_index], m_dens[p_index]);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    fract_array<T>::set(size_t p_index
+                       ,const t_fract & p_fract
+                       )
+    {
+        m_nums[p_index] = p_fract.m_num;
+        m_dens[p_index] = p_fract.m_den;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    std::vector<typename fract_array<T>::t_fract>
+    fract_array<T>::to_fracts() const
+    {
+        fract_array l_reduced(*this);
+        l_reduced.normalize();
+        std::vector<t_fract> l_result(size());
+        for(size_t l_index = 0; l_index < size(); ++l_index)
+        {
+            l_result[l_index] = t_fract::make_reduced(l_reduced.m_nums[l_index], l_reduced.m_dens[l_index]);
+        }
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    const typename fract_array<T>::t_coef_num *
+    fract_array<T>::get_nums() const
+    {
+        return m_nums.data();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    const typename fract_array<T>::t_coef_den *
+    fract_array<T>::get_dens() const
+    {
+        return m_dens.data();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    fract_array<T>::normalize()
+    {
+        for(size_t l_start = 0; l_start < size(); l_start += m_chunk_size)
+        {
+            reduce(m_nums.data() + l_start, m_dens.data() + l_start, std::min(m_chunk_size, size() - l_start));
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    fract_array<T>::to_double(double * p_result) const
+    {
+        const t_coef_num * l_nums = m_nums.data();
+        const t_coef_den * l_dens = m_dens.data();
+        for(size_t l_index = 0; l_index < size(); ++l_index)
+        {
+            p_result[l_index] = ((double)l_nums[l_index]) / ((double)l_dens[l_index]);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    fract_array<T>
+    fract_array<T>::from_double(const double * p_values
+                               ,size_t p_size
+                               ,t_coef_den p_max_den
+                               )
+    {
+        fract_array l_result(p_size);
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            l_result.set(l_index, t_fract::from_double(p_values[l_index], p_max_den));
+        }
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    fract_array<T>::add(const fract_array & p_op1
+                       ,const fract_array & p_op2
+                       ,fract_array & p_result
+                       ,bool p_reduce
+                       )
+    {
+        add_sub<false>(p_op1, p_op2, p_result, p_reduce);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    fract_array<T>::sub(const fract_array & p_op1
+                       ,const fract_array & p_op2
+                       ,fract_array & p_result
+                       ,bool p_reduce
+                       )
+    {
+        add_sub<true>(p_op1, p_op2, p_result, p_reduce);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <bool SUB>
+    void
+    fract_array<T>::add_sub(const fract_array & p_op1
+                           ,const fract_array & p_op2
+                           ,fract_array & p_result
+                           ,bool p_reduce
+                           )
+    {
+        prepare(p_op1, p_op2, p_result);
+        t_coef_den l_pgcd[m_chunk_size];
+        for(size_t l_start = 0; l_start < p_result.size(); l_start += m_chunk_size)
+        {
+            size_t l_size = std::min(m_chunk_size, p_result.size() - l_start);
+            const t_coef_num * l_nums1 = p_op1.m_nums.data() + l_start;
+            const t_coef_den * l_dens1 = p_op1.m_dens.data() + l_start;
+            const t_coef_num * l_nums2 = p_op2.m_nums.data() + l_start;
+            const t_coef_den * l_dens2 = p_op2.m_dens.data() + l_start;
+            t_coef_num * l_result_nums = p_result.m_nums.data() + l_start;
+            t_coef_den * l_result_dens = p_result.m_dens.data() + l_start;
+            PGCD(l_dens1, l_dens2, l_pgcd, l_size);
+            for(size_t l_index = 0; l_index < l_size; ++l_index)
+            {
+                // Common denominator is PPCM of denominators, products are
+                // computed modulo 2^32 as they are by fract
+                uint32_t l_factor1 = exact_div(l_dens2[l_index], l_pgcd[l_index]);
+                uint32_t l_factor2 = exact_div(l_dens1[l_index], l_pgcd[l_index]);
+                uint32_t l_term1 = (uint32_t)l_nums1[l_index] * l_factor1;
+                uint32_t l_term2 = (uint32_t)l_nums2[l_index] * l_factor2;
+                uint32_t l_den = l_factor1 * (uint32_t)l_dens1[l_index];
+                l_result_nums[l_index] = (t_coef_num)(SUB ? l_term1 - l_term2 : l_term1 + l_term2);
+                l_result_dens[l_index] = (t_coef_den)l_den;
+            }
+            if(p_reduce)
+            {
+                reduce(l_result_nums, l_result_dens, l_size);
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    fract_array<T>::mul(const fract_array & p_op1
+                       ,const fract_array & p_op2
+                       ,fract_array & p_result
+                       )
+    {
+        prepare(p_op1, p_op2, p_result);
+        t_coef_den l_pgcd1[m_chunk_size];
+        t_coef_den l_pgcd2[m_chunk_size];
+        for(size_t l_start = 0; l_start < p_result.size(); l_start += m_chunk_size)
+        {
+            size_t l_size = std::min(m_chunk_size, p_result.size() - l_start);
+            const t_coef_num * l_nums1 = p_op1.m_nums.data() + l_start;
+            const t_coef_den * l_dens1 = p_op1.m_dens.data() + l_start;
+            const t_coef_num * l_nums2 = p_op2.m_nums.data() + l_start;
+            const t_coef_den * l_dens2 = p_op2.m_dens.data() + l_start;
+            t_coef_num * l_result_nums = p_result.m_nums.data() + l_start;
+            t_coef_den * l_result_dens = p_result.m_dens.data() + l_start;
+            for(size_t l_index = 0; l_index < l_size; ++l_index)
+            {
+                l_pgcd1[l_index] = abs(l_nums1[l_index]);
+                l_pgcd2[l_index] = abs(l_nums2[l_index]);
+            }
+            PGCD(l_pgcd1, l_dens2, l_pgcd1, l_size);
+            PGCD(l_pgcd2, l_dens1, l_pgcd2, l_size);
+            for(size_t l_index = 0; l_index < l_size; ++l_index)
+            {
+                uint32_t l_num1 = (uint32_t)exact_div(l_nums1[l_index], l_pgcd1[l_index]);
+                uint32_t l_num2 = (uint32_t)exact_div(l_nums2[l_index], l_pgcd2[l_index]);
+                uint32_t l_den1 = exact_div(l_dens1[l_index], l_pgcd2[l_index]);
+                uint32_t l_den2 = exact_div(l_dens2[l_index], l_pgcd1[l_index]);
+                t_coef_num l_num = (t_coef_num)(l_num1 * l_num2);
+                // Null products are 0/1
+                l_result_dens[l_index] = l_num ? (t_coef_den)(l_den1 * l_den2) : (t_coef_den)1u;
+                l_result_nums[l_index] = l_num;
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    fract_array<T>::compare(const fract_array & p_op1
+                           ,const fract_array & p_op2
+                           ,int * p_result
+                           )
+    {
+        typedef typename fract_wide_coef<t_coef_num>::type t_wide;
+        if(p_op1.size() != p_op2.size())
+        {
+            throw quicky_exception::quicky_logic_exception("fract_array size mismatch " + std::to_string(p_op1.size()) + " != " + std::to_string(p_op2.size()), __LINE__, __FILE__);
+        }
+        const t_coef_num * l_nums1 = p_op1.m_nums.data();
+        const t_coef_den * l_dens1 = p_op1.m_dens.data();
+        const t_coef_num * l_nums2 = p_op2.m_nums.data();
+        const t_coef_den * l_dens2 = p_op2.m_dens.data();
+        for(size_t l_index = 0; l_index < p_op1.size(); ++l_index)
+        {
+            t_wide l_left = (t_wide)l_nums1[l_index] * (t_wide)l_dens2[l_index];
+            t_wide l_right = (t_wide)l_nums2[l_index] * (t_wide)l_dens1[l_index];
+            p_result[l_index] = (l_left > l_right) - (l_left < l_right);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    fract_array<T>::PGCD(const t_coef_den * p_a
+                        ,const t_coef_den * p_b
+                        ,t_coef_den * p_result
+                        ,size_t p_size
+                        )
+    {
+        // One 512 bits vector per block
+        constexpr size_t l_block_size = 64 / sizeof(t_coef_den);
+        size_t l_index = 0;
+        for(; l_index + l_block_size <= p_size; l_index += l_block_size)
+        {
+            t_coef_den l_a[l_block_size];
+            t_coef_den l_b[l_block_size];
+            t_coef_den l_scale[l_block_size];
+            for(size_t l_lane = 0; l_lane < l_block_size; ++l_lane)
+            {
+                l_a[l_lane] = p_a[l_index + l_lane];
+                l_b[l_lane] = p_b[l_index + l_lane];
+                l_scale[l_lane] = 1;
+            }
+            t_coef_den l_running;
+            do
+            {
+                l_running = 0;
+                for(size_t l_lane = 0; l_lane < l_block_size; ++l_lane)
+                {
+                    t_coef_den l_op_a = l_a[l_lane];
+                    t_coef_den l_op_b = l_b[l_lane];
+                    // Lanes whose PGCD is found have a null number
+                    t_coef_den l_lane_running = (t_coef_den)((t_coef_den)0 - (t_coef_den)((l_op_a != 0) & (l_op_b != 0)));
+                    t_coef_den l_even_a = (t_coef_den)((l_op_a & 1u) - 1u) & l_lane_running;
+                    t_coef_den l_even_b = (t_coef_den)((l_op_b & 1u) - 1u) & l_lane_running;
+                    t_coef_den l_odd = (t_coef_den)~(l_even_a | l_even_b) & l_lane_running;
+                    // Odd numbers are replaced by minimum and half of
+                    // absolute difference which is even
+                    t_coef_den l_lower = (t_coef_den)((t_coef_den)0 - (t_coef_den)(l_op_b < l_op_a));
+                    t_coef_den l_min = (t_coef_den)(l_op_a ^ ((l_op_a ^ l_op_b) & l_lower));
+                    t_coef_den l_difference = (t_coef_den)((t_coef_den)((t_coef_den)((t_coef_den)(l_op_b - l_op_a) ^ l_lower) - l_lower) >> 1);
+                    // Even numbers are halved, common factors of two are
+                    // accumulated in scale
+                    l_op_a = (t_coef_den)((l_op_a & ~l_even_a) | ((l_op_a >> 1) & l_even_a));
+                    l_op_b = (t_coef_den)((l_op_b & ~l_even_b) | ((l_op_b >> 1) & l_even_b));
+                    l_a[l_lane] = (t_coef_den)((l_op_a & ~l_odd) | (l_min & l_odd));
+                    l_b[l_lane] = (t_coef_den)((l_op_b & ~l_odd) | (l_difference & l_odd));
+                    l_scale[l_lane] = (t_coef_den)(l_scale[l_lane] + (l_scale[l_lane] & l_even_a & l_even_b));
+                    l_running |= l_lane_running;
+                }
+            } while(l_running);
+            for(size_t l_lane = 0; l_lane < l_block_size; ++l_lane)
+            {
+                p_result[l_index + l_lane] = (t_coef_den)((l_a[l_lane] | l_b[l_lane]) * l_scale[l_lane]);
+            }
+        }
+        for(; l_index < p_size; ++l_index)
+        {
+            p_result[l_index] = p_b[l_index] ? t_fract::PGCD(p_a[l_index], p_b[l_index]) : p_a[l_index];
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    fract_array<T>::reduce(t_coef_num * p_nums
+                          ,t_coef_den * p_dens
+                          ,size_t p_size
+                          )
+    {
+        t_coef_den l_pgcd[m_chunk_size];
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            l_pgcd[l_index] = abs(p_nums[l_index]);
+        }
+        PGCD(l_pgcd, p_dens, l_pgcd, p_size);
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            p_nums[l_index] = exact_div(p_nums[l_index], l_pgcd[l_index]);
+            p_dens[l_index] = exact_div(p_dens[l_index], l_pgcd[l_index]);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    fract_array<T>::prepare(const fract_array & p_op1
+                           ,const fract_array & p_op2
+                           ,fract_array & p_result
+                           )
+    {
+        if(p_op1.size() != p_op2.size())
+        {
+            throw quicky_exception::quicky_logic_exception("fract_array size mismatch " + std::to_string(p_op1.size()) + " != " + std::to_string(p_op2.size()), __LINE__, __FILE__);
+        }
+        p_result.resize(p_op1.size());
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename fract_array<T>::t_coef_den
+    fract_array<T>::abs(t_coef_num p_value)
+    {
+        t_coef_den l_sign = (t_coef_den)((t_coef_den)0 - (t_coef_den)(p_value < 0));
+        return (t_coef_den)((t_coef_den)((t_coef_den)p_value ^ l_sign) - l_sign);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename fract_array<T>::t_coef_num
+    fract_array<T>::exact_div(t_coef_num p_num
+                             ,t_coef_den p_divisor
+                             )
+    {
+        return (t_coef_num)((double)p_num / (double)p_divisor);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename fract_array<T>::t_coef_den
+    fract_array<T>::exact_div(t_coef_den p_den
+                             ,t_coef_den p_divisor
+                             )
+    {
+        return (t_coef_den)((double)p_den / (double)p_divisor);
+    }
+
+#ifdef QUICKY_UTILS_SELF_TEST
+    /**
+     * Method regrouping tests of fract arrays
+     */
+    bool
+    test_fract_array();
+#endif // QUICKY_UTILS_SELF_TEST
+}
+#endif //QUICKY_UTILS_FRACT_ARRAY_H
+// EOF
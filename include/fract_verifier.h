@@ -0,0 +1,437 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef QUICKY_UTILS_FRACT_VERIFIER_H
+#define QUICKY_UTILS_FRACT_VERIFIER_H
+
+#include <atomic>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+namespace quicky_utils
+{
+    /**
+     * Verification of fract arithmetic against double arithmetic done on a
+     * sample of operations. Each thread counts down operations and checks
+     * one operation out of period, so that verification state does not live
+     * in fractions and unsampled operations only cost a thread local
+     * decrement. Mismatches are recorded in a bounded lock-free queue that
+     * can be drained by a monitoring thread while operations go on, they
+     * are dropped and counted when queue is full.
+     * fract operators are verified when FRACT_SAMPLED_CHECK is defined
+     */
+    class fract_verifier
+    {
+      public:
+        typedef enum class operation {ADD, SUB, MUL, DIV} operation_t;
+
+        /**
+         * Operation whose result differs from the one of double arithmetic
+         */
+        struct mismatch
+        {
+            operation_t m_operation;
+            double m_op1;
+            double m_op2;
+            double m_result;
+            double m_expected;
+        };
+
+        /**
+         * Number of mismatches that can be recorded before being read
+         */
+        static constexpr size_t m_capacity = 256;
+
+        /**
+         * Number of operations after which a thread reads period again when
+         * verification is disabled
+         */
+        static constexpr uint32_t m_disabled_countdown = 65536;
+
+        /**
+         * Define sampling period, threads take it into account at the end
+         * of their current period
+         * @param p_period one operation out of p_period is checked, 0
+         * disables verification and threads then read period again every
+         * m_disabled_countdown operations
+         */
+        inline static
+        void set_period(uint32_t p_period);
+
+        /**
+         * Sampling period
+         * @return one operation out of period is checked, 0 if disabled
+         */
+        [[nodiscard]] inline static
+        uint32_t get_period();
+
+        /**
+         * Count down operations of calling thread
+         * @return true if current operation has to be checked
+         */
+        [[nodiscard]] inline static
+        bool sample();
+
+        /**
+         * Check sampled operations
+         * @tparam T_FRACT fraction type
+         * @param p_operation operation
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @param p_result result computed by fract
+         */
+        template <typename T_FRACT>
+        inline static
+        void verify(operation_t p_operation
+                   ,const T_FRACT & p_op1
+                   ,const T_FRACT & p_op2
+                   ,const T_FRACT & p_result
+                   );
+
+        /**
+         * Compare result of an operation with the one of double arithmetic
+         * and record it if difference exceeds rounding errors
+         * @param p_operation operation
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @param p_result result computed by fract
+         * @return true if results match
+         */
+        __attribute__((noinline)) inline static
+        bool check(operation_t p_operation
+                  ,double p_op1
+                  ,double p_op2
+                  ,double p_result
+                  );
+
+        /**
+         * Read oldest recorded mismatch, can be called concurrently
+         * @param p_mismatch mismatch read
+         * @return false if there is no recorded mismatch
+         */
+        [[nodiscard]] inline static
+        bool pop_mismatch(mismatch & p_mismatch);
+
+        /**
+         * Number of checked operations
+         */
+        [[nodiscard]] inline static
+        uint64_t get_nb_checks();
+
+        /**
+         * Number of mismatches, recorded or dropped
+         */
+        [[nodiscard]] inline static
+        uint64_t get_nb_mismatches();
+
+        /**
+         * Number of mismatches dropped because queue was full
+         */
+        [[nodiscard]] inline static
+        uint64_t get_nb_dropped();
+
+      private:
+        /**
+         * Queue slot: its sequence indicates if it is ready to be written
+         * or read for a given position
+         */
+        struct slot
+        {
+            std::atomic<size_t> m_sequence;
+            mismatch m_mismatch;
+        };
+
+        /**
+         * Process wide verification state
+         */
+        struct state
+        {
+            inline
+            state();
+
+            std::atomic<uint32_t> m_period;
+            std::atomic<uint64_t> m_nb_checks;
+            std::atomic<uint64_t> m_nb_mismatches;
+            std::atomic<uint64_t> m_nb_dropped;
+            std::array<slot, m_capacity> m_slots;
+            std::atomic<size_t> m_write_position;
+            std::atomic<size_t> m_read_position;
+        };
+
+        static_assert(!(m_capacity & (m_capacity - 1)), "Capacity must be a power of 2");
+
+        /**
+         * Unique verification state
+         * @return state
+         */
+        inline static
+        state & get();
+
+        /**
+         * Remaining operations before next check of calling thread
+         * @return reference on thread local countdown
+         */
+        inline static
+        uint32_t & get_countdown();
+
+        /**
+         * Start a new sampling period for calling thread
+         * @return true if current operation has to be checked
+         */
+        __attribute__((noinline)) inline static
+        bool restart_countdown();
+
+        /**
+         * Record a mismatch without blocking
+         * @param p_mismatch mismatch to record
+         * @return false if queue is full
+         */
+        inline static
+        bool push_mismatch(const mismatch & p_mismatch);
+    };
+
+    //-------------------------------------------------------------------------
+    fract_verifier::state::state()
+    :m_period(1024)
+    ,m_nb_checks(0)
+    ,m_nb_mismatches(0)
+    ,m_nb_dropped(0)
+    ,m_write_position(0)
+    ,m_read_position(0)
+    {
+        for(size_t l_index = 0; l_index < m_capacity; ++l_index)
+        {
+            m_slots[l_index].m_sequence.store(l_index, std::memory_order_relaxed);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    fract_verifier::state &
+    fract_verifier::get()
+    {
+        static state l_state;
+        return l_state;
+    }
+
+    //-------------------------------------------------------------------------
+    uint32_t &
+    fract_verifier::get_countdown()
+    {
+        static thread_local uint32_t l_countdown = 0;
+        return l_countdown;
+    }
+
+    //-------------------------------------------------------------------------
+    void
+    fract_verifier::set_period(uint32_t p_period)
+    {
+        get().m_period.store(p_period, std::memory_order_relaxed);
+    }
+
+    //-------------------------------------------------------------------------
+    uint32_t
+    fract_verifier::get_period()
+    {
+        return get().m_period.load(std::memory_order_relaxed);
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    fract_verifier::sample()
+    {
+        uint32_t & l_countdown = get_countdown();
+        if(__builtin_expect(l_countdown > 1, 1))
+        {
+            --l_countdown;
+            return false;
+        }
+        return restart_countdown();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T_FRACT>
+    void
+    fract_verifier::verify(operation_t p_operation
+                          ,const T_FRACT & p_op1
+                          ,const T_FRACT & p_op2
+                          ,const T_FRACT & p_result
+                          )
+    {
+        if(sample())
+        {
+            check(p_operation, p_op1.to_double(), p_op2.to_double(), p_result.to_double());
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    fract_verifier::restart_countdown()
+    {
+        uint32_t & l_countdown = get_countdown();
+        // Countdown is null only before first operation of thread
+        bool l_sampled = l_countdown;
+        uint32_t l_period = get_period();
+        l_countdown = l_period ? l_period : m_disabled_countdown;
+        return l_sampled && l_period;
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    fract_verifier::check(operation_t p_operation
+                         ,double p_op1
+                         ,double p_op2
+                         ,double p_result
+                         )
+    {
+        // Operands are rounded before double operation so error bound is
+        // relative to operands for additions, cancellation making it large
+        // compared to result, and relative to result for products
+        double l_expected = 0.0;
+        double l_magnitude = 0.0;
+        switch(p_operation)
+        {
+            case operation_t::ADD:
+                l_expected = p_op1 + p_op2;
+                l_magnitude = std::fabs(p_op1) + std::fabs(p_op2);
+                break;
+            case operation_t::SUB:
+                l_expected = p_op1 - p_op2;
+                l_magnitude = std::fabs(p_op1) + std::fabs(p_op2);
+                break;
+            case operation_t::MUL:
+                l_expected = p_op1 * p_op2;
+                l_magnitude = std::fabs(l_expected);
+                break;
+            case operation_t::DIV:
+                l_expected = p_op1 / p_op2;
+                l_magnitude = std::fabs(l_expected);
+                break;
+        }
+        state & l_state = get();
+        l_state.m_nb_checks.fetch_add(1, std::memory_order_relaxed);
+        // Written so that NaN is a mismatch
+        if(std::fabs(p_result - l_expected) <= 4 * std::numeric_limits<double>::epsilon() * l_magnitude)
+        {
+            return true;
+        }
+        l_state.m_nb_mismatches.fetch_add(1, std::memory_order_relaxed);
+        if(!push_mismatch(mismatch{p_operation, p_op1, p_op2, p_result, l_expected}))
+        {
+            l_state.m_nb_dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    fract_verifier::push_mismatch(const mismatch & p_mismatch)
+    {
+        state & l_state = get();
+        size_t l_position = l_state.m_write_position.load(std::memory_order_relaxed);
+        for(;;)
+        {
+            slot & l_slot = l_state.m_slots[l_position & (m_capacity - 1)];
+            size_t l_sequence = l_slot.m_sequence.load(std::memory_order_acquire);
+            // Slot is free for this position when its sequence is equal to
+            // position, it still holds mismatch of previous lap when it is
+            // lower
+            if(l_sequence == l_position)
+            {
+                if(l_state.m_write_position.compare_exchange_weak(l_position, l_position + 1, std::memory_order_relaxed))
+                {
+                    l_slot.m_mismatch = p_mismatch;
+                    l_slot.m_sequence.store(l_position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if((std::ptrdiff_t)(l_sequence - l_position) < 0)
+            {
+                return false;
+            }
+            else
+            {
+                l_position = l_state.m_write_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    fract_verifier::pop_mismatch(mismatch & p_mismatch)
+    {
+        state & l_state = get();
+        size_t l_position = l_state.m_read_position.load(std::memory_order_relaxed);
+        for(;;)
+        {
+            slot & l_slot = l_state.m_slots[l_position & (m_capacity - 1)];
+            size_t l_sequence = l_slot.m_sequence.load(std::memory_order_acquire);
+            // Slot is readable when written for this position
+            if(l_sequence == l_position + 1)
+            {
+                if(l_state.m_read_position.compare_exchange_weak(l_position, l_position + 1, std::memory_order_relaxed))
+                {
+                    p_mismatch = l_slot.m_mismatch;
+                    // Slot becomes free for position of next lap
+                    l_slot.m_sequence.store(l_position + m_capacity, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if((std::ptrdiff_t)(l_sequence - (l_position + 1)) < 0)
+            {
+                return false;
+            }
+            else
+            {
+                l_position = l_state.m_read_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    uint64_t
+    fract_verifier::get_nb_checks()
+    {
+        return get().m_nb_checks.load(std::memory_order_relaxed);
+    }
+
+    //-------------------------------------------------------------------------
+    uint64_t
+    fract_verifier::get_nb_mismatches()
+    {
+        return get().m_nb_mismatches.load(std::memory_order_relaxed);
+    }
+
+    //-------------------------------------------------------------------------
+    uint64_t
+    fract_verifier::get_nb_dropped()
+    {
+        return get().m_nb_dropped.load(std::memory_order_relaxed);
+    }
+
+#ifdef QUICKY_UTILS_SELF_TEST
+    /**
+     * Method regrouping tests of fract verifier
+     */
+    bool
+    test_fract_verifier();
+#endif // QUICKY_UTILS_SELF_TEST
+}
+#endif //QUICKY_UTILS_FRACT_VERIFIER_H
+// EOF
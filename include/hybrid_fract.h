@@ -0,0 +1,704 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifndef QUICKY_UTILS_HYBRID_FRACT_H
+#define QUICKY_UTILS_HYBRID_FRACT_H
+
+#include "fract.h"
+#include "type_string.h"
+#include "quicky_exception.h"
+#include <memory>
+#include <limits>
+#include <iostream>
+#include <type_traits>
+
+namespace quicky_utils
+{
+    /**
+     * Unsigned type of same width than a signed wide coefficient, __int128
+     * is not handled by std::make_unsigned in strict standard mode
+     */
+    template <typename T>
+    struct hybrid_fract_unsigned
+    {
+        typedef typename std::make_unsigned<T>::type type;
+    };
+
+    template <>
+    struct hybrid_fract_unsigned<__int128>
+    {
+        typedef unsigned __int128 type;
+    };
+
+    /**
+     * Fraction stored inline as fract<T> while its coefficients fit and
+     * promoted to a fract whose coefficients are twice wider when an
+     * operation overflows. Operations are computed exactly on double width
+     * intermediates so that the only extra cost compared to fract is the
+     * check that reduced result fits in T. Results of operations on
+     * promoted values are demoted back to inline storage when they fit.
+     * Overflow of promoted coefficients raises an exception like safe types
+     * @tparam T built-in coefficient type of at most 32 bits
+     */
+    template <typename T>
+    class hybrid_fract
+    {
+      public:
+        typedef fract<T> t_fract;
+        typedef typename t_fract::t_coef_num t_coef_num;
+        typedef typename t_fract::t_coef_den t_coef_den;
+        typedef typename fract_wide_coef<t_coef_num>::type t_wide_coef_num;
+        typedef fract<typename hybrid_fract_unsigned<t_wide_coef_num>::type> t_wide_fract;
+
+        static_assert(fract_builtin_coef<t_coef_den>::value && sizeof(t_coef_den) <= sizeof(uint32_t), "hybrid_fract requires built-in coefficients of at most 32 bits");
+
+        /**
+         * Empty constructor, value is 0
+         */
+        inline
+        hybrid_fract();
+
+        /**
+         * Constructor from inline fraction
+         * @param p_value value
+         */
+        inline
+        hybrid_fract(const t_fract & p_value);
+
+        /**
+         * Constructor from wide fraction, value is kept inline if it fits
+         * @param p_value value
+         */
+        inline explicit
+        hybrid_fract(const t_wide_fract & p_value);
+
+        inline
+        hybrid_fract(const hybrid_fract & p_value);
+
+        inline
+        hybrid_fract(hybrid_fract && p_value) noexcept;
+
+        inline
+        hybrid_fract & operator=(const hybrid_fract & p_op);
+
+        inline
+        hybrid_fract & operator=(hybrid_fract && p_op) noexcept;
+
+        inline explicit
+        operator bool() const;
+
+        /**
+         * Indicate if value is stored as wide fraction
+         * @return true if coefficients do not fit in T
+         */
+        [[nodiscard]] inline
+        bool is_promoted() const;
+
+        /**
+         * Inline value accessor
+         * @return value, exception is raised if value is promoted
+         */
+        [[nodiscard]] inline
+        t_fract get_fract() const;
+
+        /**
+         * Conversion to wide fraction whatever the storage
+         * @return value as wide fraction
+         */
+        [[nodiscard]] inline
+        t_wide_fract to_wide_fract() const;
+
+        /**
+         * Conversion correctly rounded to nearest double
+         */
+        [[nodiscard]] inline
+        double to_double() const;
+
+        /**
+         * Three-way comparison shared by relational operators
+         * @param p_op operand to compare with
+         * @return -1, 0 or 1 if this is lower, equal or greater than p_op
+         */
+        [[nodiscard]] inline
+        int compare(const hybrid_fract & p_op) const;
+
+        inline
+        bool operator==(const hybrid_fract & p_op) const;
+
+        inline
+        bool operator!=(const hybrid_fract & p_op) const;
+
+        inline
+        bool operator<(const hybrid_fract & p_op) const;
+
+        inline
+        bool operator>(const hybrid_fract & p_op) const;
+
+        inline
+        bool operator<=(const hybrid_fract & p_op) const;
+
+        inline
+        bool operator>=(const hybrid_fract & p_op) const;
+
+        inline
+        hybrid_fract operator+(const hybrid_fract & p_op) const;
+
+        inline
+        hybrid_fract operator-(const hybrid_fract & p_op) const;
+
+        inline
+        hybrid_fract operator*(const hybrid_fract & p_op) const;
+
+        inline
+        hybrid_fract operator/(const hybrid_fract & p_op) const;
+
+        inline
+        hybrid_fract operator-() const;
+
+        inline
+        hybrid_fract operator+() const;
+
+        inline
+        hybrid_fract & operator+=(const hybrid_fract & p_op);
+
+        inline
+        hybrid_fract & operator-=(const hybrid_fract & p_op);
+
+        inline
+        hybrid_fract & operator*=(const hybrid_fract & p_op);
+
+        inline
+        hybrid_fract & operator/=(const hybrid_fract & p_op);
+
+      private:
+        /**
+         * Add or substract fractions on intermediates twice wider than
+         * their coefficients using Knuth reduction: only the PGCD of the
+         * numerator with the PGCD of denominators has to be computed
+         * @tparam SUB true for substraction
+         * @tparam T_FRACT type of operands, inline or wide fraction
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @return reduced result
+         */
+        template <bool SUB, typename T_FRACT>
+        static inline
+        hybrid_fract add_sub(const T_FRACT & p_op1
+                            ,const T_FRACT & p_op2
+                            );
+
+        /**
+         * Multiply fractions on intermediates twice wider than their
+         * coefficients after cross reduction so that result is reduced
+         * @tparam T_FRACT type of operands, inline or wide fraction
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @return reduced result
+         */
+        template <typename T_FRACT>
+        static inline
+        hybrid_fract mul(const T_FRACT & p_op1
+                        ,const T_FRACT & p_op2
+                        );
+
+        /**
+         * Divide fractions on intermediates twice wider than their
+         * coefficients after cross reduction so that result is reduced
+         * @tparam T_FRACT type of operands, inline or wide fraction
+         * @param p_op1 dividend
+         * @param p_op2 non null divisor
+         * @return reduced result
+         */
+        template <typename T_FRACT>
+        static inline
+        hybrid_fract div(const T_FRACT & p_op1
+                        ,const T_FRACT & p_op2
+                        );
+
+        /**
+         * Build result of an operation from coprime absolute values of its
+         * coefficients
+         * @tparam T_UINT type of intermediates
+         * @param p_negative true if result is negative
+         * @param p_num absolute value of numerator
+         * @param p_den denominator
+         * @return result stored inline if it fits
+         */
+        template <typename T_UINT>
+        static inline
+        hybrid_fract from_result(bool p_negative
+                                ,T_UINT p_num
+                                ,T_UINT p_den
+                                );
+
+        /**
+         * Build promoted result of an operation, exception is raised if it
+         * does not fit in wide fraction
+         * @tparam T_UINT type of intermediates
+         * @param p_negative true if result is negative
+         * @param p_num absolute value of numerator
+         * @param p_den denominator
+         * @return promoted result
+         */
+        template <typename T_UINT>
+        static
+        hybrid_fract promote(bool p_negative
+                            ,T_UINT p_num
+                            ,T_UINT p_den
+                            );
+
+        /**
+         * Raise division by zero exception
+         */
+        [[noreturn]] static inline
+        void throw_division_by_zero();
+
+        t_fract m_value;
+
+        /**
+         * Value when it does not fit in m_value, null otherwise
+         */
+        std::unique_ptr<t_wide_fract> m_wide_value;
+    };
+
+    template <typename T>
+    inline
+    std::ostream &
+    operator<<(std::ostream & p_stream
+              ,const hybrid_fract<T> & p_value
+              );
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    hybrid_fract<T>::hybrid_fract()
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    hybrid_fract<T>::hybrid_fract(const t_fract & p_value)
+    :m_value(p_value)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    hybrid_fract<T>::hybrid_fract(const t_wide_fract & p_value)
+    {
+        *this = from_result(p_value.m_num < 0, t_wide_fract::t_coef_traits::abs(p_value.m_num), p_value.m_den);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    hybrid_fract<T>::hybrid_fract(const hybrid_fract & p_value)
+    :m_value(p_value.m_value)
+    ,m_wide_value(p_value.m_wide_value ? std::make_unique<t_wide_fract>(*p_value.m_wide_value) : nullptr)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    hybrid_fract<T>::hybrid_fract(hybrid_fract && p_value) noexcept
+    :m_value(p_value.m_value)
+    ,m_wide_value(std::move(p_value.m_wide_value))
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    hybrid_fract<T> &
+    hybrid_fract<T>::operator=(const hybrid_fract & p_op)
+    {
+        if(this != &p_op)
+        {
+            m_value = p_op.m_value;
+            m_wide_value = p_op.m_wide_value ? std::make_unique<t_wide_fract>(*p_op.m_wide_value) : nullptr;
+        }
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    hybrid_fract<T> &
+    hybrid_fract<T>::operator=(hybrid_fract && p_op) noexcept
+    {
+        m_value = p_op.m_value;
+        m_wide_value = std::move(p_op.m_wide_value);
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    hybrid_fract<T>::operator bool() const
+    {
+        // Promoted values do not fit inline so they are not null
+        return m_wide_value || m_value;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    hybrid_fract<T>::is_promoted() const
+    {
+        return (bool)m_wide_value;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename hybrid_fract<T>::t_fract
+    hybrid_fract<T>::get_fract() const
+    {
+        if(m_wide_value)
+        {
+            throw quicky_exception::quicky_logic_exception("hybrid_fract value does not fit in " + type_string<t_fract>::name(), __LINE__, __FILE__);
+        }
+        return m_value;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    typename hybrid_fract<T>::t_wide_fract
+    hybrid_fract<T>::to_wide_fract() const
+    {
+        if(m_wide_value)
+        {
+            return *m_wide_value;
+        }
+        return t_wide_fract::make_reduced(m_value.m_num, m_value.m_den);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    double
+    hybrid_fract<T>::to_double() const
+    {
+        return m_wide_value ? m_wide_value->to_double() : m_value.to_double();
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    int
+    hybrid_fract<T>::compare(const hybrid_fract & p_op) const
+    {
+        if(!m_wide_value && !p_op.m_wide_value)
+        {
+            return m_value.compare(p_op.m_value);
+        }
+        return to_wide_fract().compare(p_op.to_wide_fract());
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    hybrid_fract<T>::operator==(const hybrid_fract & p_op) const
+    {
+        return !compare(p_op);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    hybrid_fract<T>::operator!=(const hybrid_fract & p_op) const
+    {
+        return compare(p_op);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    hybrid_fract<T>::operator<(const hybrid_fract & p_op) const
+    {
+        return compare(p_op) < 0;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    hybrid_fract<T>::operator>(const hybrid_fract & p_op) const
+    {
+        return compare(p_op) > 0;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    hybrid_fract<T>::operator<=(const hybrid_fract & p_op) const
+    {
+        return compare(p_op) <= 0;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    hybrid_fract<T>::operator>=(const hybrid_fract & p_op) const
+    {
+        return compare(p_op) >= 0;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    hybrid_fract<T>
+    hybrid_fract<T>::operator+(const hybrid_fract & p_op) const
+    {
+        if(!m_wide_value && !p_op.m_wide_value)
+        {
+            return add_sub<false>(m_value, p_op.m_value);
+        }
+        return add_sub<false>(to_wide_fract(), p_op.to_wide_fract());
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    hybrid_fract<T>
+    hybrid_fract<T>::operator-(const hybrid_fract & p_op) const
+    {
+        if(!m_wide_value && !p_op.m_wide_value)
+        {
+            return add_sub<true>(m_value, p_op.m_value);
+        }
+        return add_sub<true>(to_wide_fract(), p_op.to_wide_fract());
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    hybrid_fract<T>
+    hybrid_fract<T>::operator*(const hybrid_fract & p_op) const
+    {
+        if(!m_wide_value && !p_op.m_wide_value)
+        {
+            return mul(m_value, p_op.m_value);
+        }
+        return mul(to_wide_fract(), p_op.to_wide_fract());
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    hybrid_fract<T>
+    hybrid_fract<T>::operator/(const hybrid_fract & p_op) const
+    {
+        if(!p_op)
+        {
+            throw_division_by_zero();
+        }
+        if(!m_wide_value && !p_op.m_wide_value)
+        {
+            return div(m_value, p_op.m_value);
+        }
+        return div(to_wide_fract(), p_op.to_wide_fract());
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    hybrid_fract<T>
+    hybrid_fract<T>::operator-() const
+    {
+        if(!m_wide_value)
+        {
+            // Negation of minimum numerator is promoted
+            return from_result(m_value.m_num > 0, t_fract::t_coef_traits::abs(m_value.m_num), m_value.m_den);
+        }
+        return from_result(m_wide_value->m_num > 0, t_wide_fract::t_coef_traits::abs(m_wide_value->m_num), m_wide_value->m_den);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    hybrid_fract<T>
+    hybrid_fract<T>::operator+() const
+    {
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    hybrid_fract<T> &
+    hybrid_fract<T>::operator+=(const hybrid_fract & p_op)
+    {
+        return *this = *this + p_op;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    hybrid_fract<T> &
+    hybrid_fract<T>::operator-=(const hybrid_fract & p_op)
+    {
+        return *this = *this - p_op;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    hybrid_fract<T> &
+    hybrid_fract<T>::operator*=(const hybrid_fract & p_op)
+    {
+        return *this = *this * p_op;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    hybrid_fract<T> &
+    hybrid_fract<T>::operator/=(const hybrid_fract & p_op)
+    {
+        return *this = *this / p_op;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <bool SUB, typename T_FRACT>
+    hybrid_fract<T>
+    hybrid_fract<T>::add_sub(const T_FRACT & p_op1
+                            ,const T_FRACT & p_op2
+                            )
+    {
+        typedef typename T_FRACT::t_coef_den t_den;
+        typedef typename fract_wide_coef<typename T_FRACT::t_coef_num>::type t_wide_num;
+        typedef typename hybrid_fract_unsigned<t_wide_num>::type t_wide_den;
+        t_den l_pgcd = T_FRACT::PGCD(p_op1.m_den, p_op2.m_den);
+        t_den l_den1 = p_op1.m_den / l_pgcd;
+        t_den l_den2 = p_op2.m_den / l_pgcd;
+        // Products of a numerator by a denominator fit in wide type
+        t_wide_num l_term1 = (t_wide_num)p_op1.m_num * (t_wide_num)l_den2;
+        t_wide_num l_term2 = (t_wide_num)p_op2.m_num * (t_wide_num)l_den1;
+        t_wide_num l_sum;
+        bool l_overflow = SUB ? __builtin_sub_overflow(l_term1, l_term2, &l_sum) : __builtin_add_overflow(l_term1, l_term2, &l_sum);
+        // Absolute value of exact sum always fits in unsigned wide type:
+        // when signed sum overflows its sign is the opposite of the one of
+        // wrapped value and its absolute value is computed modulo 2^n
+        bool l_negative = (l_sum < 0) != l_overflow;
+        t_wide_den l_num = l_negative ? (t_wide_den)0 - (t_wide_den)l_sum : (t_wide_den)l_sum;
+        t_den l_pgcd2 = T_FRACT::PGCD((t_den)(l_num % l_pgcd), l_pgcd);
+        return from_result(l_negative, (t_wide_den)(l_num / l_pgcd2), (t_wide_den)l_den1 * (t_wide_den)(p_op2.m_den / l_pgcd2));
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <typename T_FRACT>
+    hybrid_fract<T>
+    hybrid_fract<T>::mul(const T_FRACT & p_op1
+                        ,const T_FRACT & p_op2
+                        )
+    {
+        typedef typename T_FRACT::t_coef_den t_den;
+        typedef typename fract_wide_coef<typename T_FRACT::t_coef_num>::type t_wide_num;
+        typedef typename hybrid_fract_unsigned<t_wide_num>::type t_wide_den;
+        t_den l_num1 = T_FRACT::t_coef_traits::abs(p_op1.m_num);
+        t_den l_num2 = T_FRACT::t_coef_traits::abs(p_op2.m_num);
+        t_den l_pgcd1 = T_FRACT::PGCD(l_num1, p_op2.m_den);
+        t_den l_pgcd2 = T_FRACT::PGCD(l_num2, p_op1.m_den);
+        return from_result((p_op1.m_num < 0) != (p_op2.m_num < 0)
+                          ,(t_wide_den)(l_num1 / l_pgcd1) * (t_wide_den)(l_num2 / l_pgcd2)
+                          ,(t_wide_den)(p_op1.m_den / l_pgcd2) * (t_wide_den)(p_op2.m_den / l_pgcd1)
+                          );
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <typename T_FRACT>
+    hybrid_fract<T>
+    hybrid_fract<T>::div(const T_FRACT & p_op1
+                        ,const T_FRACT & p_op2
+                        )
+    {
+        typedef typename T_FRACT::t_coef_den t_den;
+        typedef typename fract_wide_coef<typename T_FRACT::t_coef_num>::type t_wide_num;
+        typedef typename hybrid_fract_unsigned<t_wide_num>::type t_wide_den;
+        t_den l_num1 = T_FRACT::t_coef_traits::abs(p_op1.m_num);
+        t_den l_num2 = T_FRACT::t_coef_traits::abs(p_op2.m_num);
+        t_den l_pgcd1 = T_FRACT::PGCD(l_num1, l_num2);
+        t_den l_pgcd2 = T_FRACT::PGCD(p_op1.m_den, p_op2.m_den);
+        return from_result((p_op1.m_num < 0) != (p_op2.m_num < 0)
+                          ,(t_wide_den)(l_num1 / l_pgcd1) * (t_wide_den)(p_op2.m_den / l_pgcd2)
+                          ,(t_wide_den)(p_op1.m_den / l_pgcd2) * (t_wide_den)(l_num2 / l_pgcd1)
+                          );
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <typename T_UINT>
+    hybrid_fract<T>
+    hybrid_fract<T>::from_result(bool p_negative
+                                ,T_UINT p_num
+                                ,T_UINT p_den
+                                )
+    {
+        // Reductions leave denominator of null results unchanged
+        p_den = p_num ? p_den : (T_UINT)1u;
+        p_negative = p_negative && p_num;
+        if(p_num <= (T_UINT)std::numeric_limits<t_coef_num>::max() + p_negative && p_den <= (T_UINT)std::numeric_limits<t_coef_den>::max())
+        {
+            // Absolute value is negated as unsigned so that minimum fits
+            t_coef_den l_num = (t_coef_den)p_num;
+            return hybrid_fract(t_fract::make_reduced((t_coef_num)(p_negative ? (t_coef_den)((t_coef_den)0 - l_num) : l_num), (t_coef_den)p_den));
+        }
+        return promote(p_negative, p_num, p_den);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <typename T_UINT>
+    hybrid_fract<T>
+    hybrid_fract<T>::promote(bool p_negative
+                            ,T_UINT p_num
+                            ,T_UINT p_den
+                            )
+    {
+        typedef typename t_wide_fract::t_coef_num t_wide_num;
+        typedef typename t_wide_fract::t_coef_den t_wide_den;
+        if(p_num > (T_UINT)std::numeric_limits<t_wide_num>::max() + p_negative || p_den > (T_UINT)std::numeric_limits<t_wide_den>::max())
+        {
+            throw quicky_exception::quicky_logic_exception("hybrid_fract result does not fit in " + type_string<t_wide_fract>::name(), __LINE__, __FILE__);
+        }
+        t_wide_den l_num = (t_wide_den)p_num;
+        hybrid_fract l_result;
+        l_result.m_wide_value = std::make_unique<t_wide_fract>(t_wide_fract::make_reduced((t_wide_num)(p_negative ? (t_wide_den)((t_wide_den)0 - l_num) : l_num), (t_wide_den)p_den));
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    hybrid_fract<T>::throw_division_by_zero()
+    {
+        throw quicky_exception::quicky_logic_exception("Illegal division by 0 hybrid_fract", __LINE__, __FILE__);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    std::ostream &
+    operator<<(std::ostream & p_stream
+              ,const hybrid_fract<T> & p_value
+              )
+    {
+        if(p_value.is_promoted())
+        {
+            p_stream << p_value.to_wide_fract();
+        }
+        else
+        {
+            p_stream << p_value.get_fract();
+        }
+        return p_stream;
+    }
+
+#ifdef QUICKY_UTILS_SELF_TEST
+    /**
+     * Method regrouping tests of hybrid fractions
+     */
+    bool
+    test_hybrid_fract();
+#endif // QUICKY_UTILS_SELF_TEST
+}
+#endif //QUICKY_UTILS_HYBRID_FRACT_H
+// EOF
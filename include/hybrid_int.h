@@ -0,0 +1,549 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+#ifndef QUICKY_UTILS_HYBRID_INT_H
+#define QUICKY_UTILS_HYBRID_INT_H
+
+#include "ext_uint.h"
+#include "ext_int.h"
+#include "quicky_exception.h"
+#include <memory>
+#include <limits>
+#include <string>
+#include <iostream>
+#include <cstdint>
+
+namespace quicky_utils
+{
+    /**
+     * Signed integer stored inline as int64_t while it fits and promoted to
+     * ext_int when an operation overflows. Overflows are detected with
+     * compiler builtins so that operations on inline values cost the same
+     * as safe_int ones. Results of operations on promoted values are
+     * demoted back to inline storage when they fit in 64 bits
+     */
+    class hybrid_int
+    {
+      public:
+        typedef ext_int<int64_t> ext_type;
+
+        /**
+         * Empty constructor
+         */
+        inline
+        hybrid_int();
+
+        /**
+         * Constructor from int64_t
+         * @param p_value value
+         */
+        inline
+        hybrid_int(const int64_t & p_value);
+
+        /**
+         * Constructor from ext_int, value is kept inline if it fits
+         * @param p_value value
+         */
+        inline explicit
+        hybrid_int(const ext_type & p_value);
+
+        inline
+        hybrid_int(const hybrid_int & p_value);
+
+        inline
+        hybrid_int(hybrid_int && p_value) noexcept;
+
+        inline
+        hybrid_int & operator=(const hybrid_int & p_op);
+
+        inline
+        hybrid_int & operator=(hybrid_int && p_op) noexcept;
+
+        inline explicit
+        operator bool() const;
+
+        inline explicit
+        operator double() const;
+
+        /**
+         * Indicate if value is stored as ext_int
+         * @return true if value does not fit in int64_t
+         */
+        [[nodiscard]] inline
+        bool is_promoted() const;
+
+        /**
+         * Inline value accessor
+         * @return value, exception is raised if value is promoted
+         */
+        [[nodiscard]] inline
+        int64_t get_value() const;
+
+        /**
+         * Conversion to ext_int whatever the storage
+         * @return value as ext_int
+         */
+        [[nodiscard]] inline
+        ext_type to_ext_int() const;
+
+        /**
+         * Decimal representation
+         * @return string representation
+         */
+        [[nodiscard]] inline
+        std::string to_string() const;
+
+        /**
+         * Three-way comparison shared by relational operators
+         * @param p_op operand to compare with
+         * @return -1, 0 or 1 if this is lower, equal or greater than p_op
+         */
+        [[nodiscard]] inline
+        int compare(const hybrid_int & p_op) const;
+
+        inline
+        bool operator==(const hybrid_int & p_op) const;
+
+        inline
+        bool operator!=(const hybrid_int & p_op) const;
+
+        inline
+        bool operator<(const hybrid_int & p_op) const;
+
+        inline
+        bool operator>(const hybrid_int & p_op) const;
+
+        inline
+        bool operator<=(const hybrid_int & p_op) const;
+
+        inline
+        bool operator>=(const hybrid_int & p_op) const;
+
+        inline
+        hybrid_int operator+(const hybrid_int & p_op) const;
+
+        inline
+        hybrid_int operator-(const hybrid_int & p_op) const;
+
+        inline
+        hybrid_int operator*(const hybrid_int & p_op) const;
+
+        /**
+         * Division truncated toward zero like built-in types
+         */
+        inline
+        hybrid_int operator/(const hybrid_int & p_op) const;
+
+        /**
+         * Remainder having sign of dividend like built-in types
+         */
+        inline
+        hybrid_int operator%(const hybrid_int & p_op) const;
+
+        inline
+        hybrid_int operator-() const;
+
+        inline
+        hybrid_int operator+() const;
+
+        inline
+        hybrid_int & operator+=(const hybrid_int & p_op);
+
+        inline
+        hybrid_int & operator-=(const hybrid_int & p_op);
+
+        inline
+        hybrid_int & operator*=(const hybrid_int & p_op);
+
+        inline
+        hybrid_int & operator/=(const hybrid_int & p_op);
+
+        inline
+        hybrid_int & operator%=(const hybrid_int & p_op);
+
+      private:
+        /**
+         * Build result of an operation done on ext_int
+         * @param p_value result
+         * @return result stored inline if it fits
+         */
+        static inline
+        hybrid_int from_ext_int(ext_type && p_value);
+
+        /**
+         * Raise division by zero exception
+         */
+        [[noreturn]] static inline
+        void throw_division_by_zero();
+
+        int64_t m_value;
+
+        /**
+         * Value when it does not fit in m_value, null otherwise
+         */
+        std::unique_ptr<ext_type> m_ext_value;
+    };
+
+    inline
+    std::ostream &
+    operator<<(std::ostream & p_stream
+              ,const hybrid_int & p_value
+              );
+
+    //-------------------------------------------------------------------------
+    hybrid_int::hybrid_int()
+    :m_value(0)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int::hybrid_int(const int64_t & p_value)
+    :m_value(p_value)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int::hybrid_int(const ext_type & p_value)
+    :m_value(0)
+    {
+        if(p_value.get_extension().empty())
+        {
+            m_value = p_value.get_root();
+        }
+        else
+        {
+            m_ext_value = std::make_unique<ext_type>(p_value);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int::hybrid_int(const hybrid_int & p_value)
+    :m_value(p_value.m_value)
+    ,m_ext_value(p_value.m_ext_value ? std::make_unique<ext_type>(*p_value.m_ext_value) : nullptr)
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int::hybrid_int(hybrid_int && p_value) noexcept
+    :m_value(p_value.m_value)
+    ,m_ext_value(std::move(p_value.m_ext_value))
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int &
+    hybrid_int::operator=(const hybrid_int & p_op)
+    {
+        if(this != &p_op)
+        {
+            m_value = p_op.m_value;
+            m_ext_value = p_op.m_ext_value ? std::make_unique<ext_type>(*p_op.m_ext_value) : nullptr;
+        }
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int &
+    hybrid_int::operator=(hybrid_int && p_op) noexcept
+    {
+        m_value = p_op.m_value;
+        m_ext_value = std::move(p_op.m_ext_value);
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int::operator bool() const
+    {
+        // Promoted values do not fit in 64 bits so they are not null
+        return m_ext_value || m_value;
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int::operator double() const
+    {
+        return m_ext_value ? (double)*m_ext_value : (double)m_value;
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    hybrid_int::is_promoted() const
+    {
+        return (bool)m_ext_value;
+    }
+
+    //-------------------------------------------------------------------------
+    int64_t
+    hybrid_int::get_value() const
+    {
+        if(m_ext_value)
+        {
+            throw quicky_exception::quicky_logic_exception("hybrid_int value " + m_ext_value->to_string() + " does not fit in int64_t", __LINE__, __FILE__);
+        }
+        return m_value;
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int::ext_type
+    hybrid_int::to_ext_int() const
+    {
+        return m_ext_value ? *m_ext_value : ext_type(m_value);
+    }
+
+    //-------------------------------------------------------------------------
+    std::string
+    hybrid_int::to_string() const
+    {
+        return m_ext_value ? m_ext_value->to_string() : std::to_string(m_value);
+    }
+
+    //-------------------------------------------------------------------------
+    int
+    hybrid_int::compare(const hybrid_int & p_op) const
+    {
+        if(!m_ext_value && !p_op.m_ext_value)
+        {
+            return (m_value > p_op.m_value) - (m_value < p_op.m_value);
+        }
+        return to_ext_int().compare(p_op.to_ext_int());
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    hybrid_int::operator==(const hybrid_int & p_op) const
+    {
+        return !compare(p_op);
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    hybrid_int::operator!=(const hybrid_int & p_op) const
+    {
+        return compare(p_op);
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    hybrid_int::operator<(const hybrid_int & p_op) const
+    {
+        return compare(p_op) < 0;
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    hybrid_int::operator>(const hybrid_int & p_op) const
+    {
+        return compare(p_op) > 0;
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    hybrid_int::operator<=(const hybrid_int & p_op) const
+    {
+        return compare(p_op) <= 0;
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    hybrid_int::operator>=(const hybrid_int & p_op) const
+    {
+        return compare(p_op) >= 0;
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int
+    hybrid_int::operator+(const hybrid_int & p_op) const
+    {
+        int64_t l_result;
+        if(!m_ext_value && !p_op.m_ext_value && !__builtin_add_overflow(m_value, p_op.m_value, &l_result))
+        {
+            return hybrid_int(l_result);
+        }
+        return from_ext_int(to_ext_int() + p_op.to_ext_int());
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int
+    hybrid_int::operator-(const hybrid_int & p_op) const
+    {
+        int64_t l_result;
+        if(!m_ext_value && !p_op.m_ext_value && !__builtin_sub_overflow(m_value, p_op.m_value, &l_result))
+        {
+            return hybrid_int(l_result);
+        }
+        return from_ext_int(to_ext_int() - p_op.to_ext_int());
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int
+    hybrid_int::operator*(const hybrid_int & p_op) const
+    {
+        int64_t l_result;
+        if(!m_ext_value && !p_op.m_ext_value && !__builtin_mul_overflow(m_value, p_op.m_value, &l_result))
+        {
+            return hybrid_int(l_result);
+        }
+        return from_ext_int(to_ext_int() * p_op.to_ext_int());
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int
+    hybrid_int::operator/(const hybrid_int & p_op) const
+    {
+        if(!m_ext_value && !p_op.m_ext_value)
+        {
+            if(!p_op.m_value)
+            {
+                throw_division_by_zero();
+            }
+            // Only min / -1 overflows
+            if(-1 != p_op.m_value || std::numeric_limits<int64_t>::min() != m_value)
+            {
+                return hybrid_int(m_value / p_op.m_value);
+            }
+        }
+        return from_ext_int(to_ext_int() / p_op.to_ext_int());
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int
+    hybrid_int::operator%(const hybrid_int & p_op) const
+    {
+        if(!m_ext_value && !p_op.m_ext_value)
+        {
+            if(!p_op.m_value)
+            {
+                throw_division_by_zero();
+            }
+            // min % -1 is undefined for built-in types
+            return hybrid_int(-1 != p_op.m_value ? m_value % p_op.m_value : 0);
+        }
+        return from_ext_int(to_ext_int() % p_op.to_ext_int());
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int
+    hybrid_int::operator-() const
+    {
+        if(!m_ext_value && std::numeric_limits<int64_t>::min() != m_value)
+        {
+            return hybrid_int(-m_value);
+        }
+        return from_ext_int(-to_ext_int());
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int
+    hybrid_int::operator+() const
+    {
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int &
+    hybrid_int::operator+=(const hybrid_int & p_op)
+    {
+        int64_t l_result;
+        if(!m_ext_value && !p_op.m_ext_value && !__builtin_add_overflow(m_value, p_op.m_value, &l_result))
+        {
+            m_value = l_result;
+            return *this;
+        }
+        return *this = *this + p_op;
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int &
+    hybrid_int::operator-=(const hybrid_int & p_op)
+    {
+        int64_t l_result;
+        if(!m_ext_value && !p_op.m_ext_value && !__builtin_sub_overflow(m_value, p_op.m_value, &l_result))
+        {
+            m_value = l_result;
+            return *this;
+        }
+        return *this = *this - p_op;
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int &
+    hybrid_int::operator*=(const hybrid_int & p_op)
+    {
+        int64_t l_result;
+        if(!m_ext_value && !p_op.m_ext_value && !__builtin_mul_overflow(m_value, p_op.m_value, &l_result))
+        {
+            m_value = l_result;
+            return *this;
+        }
+        return *this = *this * p_op;
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int &
+    hybrid_int::operator/=(const hybrid_int & p_op)
+    {
+        return *this = *this / p_op;
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int &
+    hybrid_int::operator%=(const hybrid_int & p_op)
+    {
+        return *this = *this % p_op;
+    }
+
+    //-------------------------------------------------------------------------
+    hybrid_int
+    hybrid_int::from_ext_int(ext_type && p_value)
+    {
+        hybrid_int l_result;
+        if(p_value.get_extension().empty())
+        {
+            l_result.m_value = p_value.get_root();
+        }
+        else
+        {
+            l_result.m_ext_value = std::make_unique<ext_type>(std::move(p_value));
+        }
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    void
+    hybrid_int::throw_division_by_zero()
+    {
+        throw quicky_exception::quicky_logic_exception("Illegal division by 0 hybrid_int", __LINE__, __FILE__);
+    }
+
+    //-------------------------------------------------------------------------
+    std::ostream &
+    operator<<(std::ostream & p_stream
+              ,const hybrid_int & p_value
+              )
+    {
+        p_stream << p_value.to_string();
+        return p_stream;
+    }
+
+#ifdef QUICKY_UTILS_SELF_TEST
+    /**
+     * Method regrouping tests of hybrid integer
+     */
+    bool
+    test_hybrid_int();
+#endif // QUICKY_UTILS_SELF_TEST
+}
+#endif //QUICKY_UTILS_HYBRID_INT_H
+// EOF
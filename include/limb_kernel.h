@@ -0,0 +1,1028 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+#ifndef QUICKY_UTILS_LIMB_KERNEL_H
+#define QUICKY_UTILS_LIMB_KERNEL_H
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <cassert>
+#include <type_traits>
+#include <limits>
+#include <cmath>
+#include <cstring>
+#include "bignum_workspace.h"
+#include "bignum_thread_pool.h"
+#include "common.h"
+
+namespace quicky_utils
+{
+    /**
+     * Unsigned type able to store the product of two limbs and its signed
+     * counterpart
+     * @tparam T limb type
+     */
+    template <typename T>
+    struct limb_double;
+
+    template <>
+    struct limb_double<uint8_t>
+    {
+        typedef uint16_t type;
+        typedef int16_t signed_type;
+    };
+
+    template <>
+    struct limb_double<uint16_t>
+    {
+        typedef uint32_t type;
+        typedef int32_t signed_type;
+    };
+
+    template <>
+    struct limb_double<uint32_t>
+    {
+        typedef uint64_t type;
+        typedef int64_t signed_type;
+    };
+
+    template <>
+    struct limb_double<uint64_t>
+    {
+        __extension__ typedef unsigned __int128 type;
+        __extension__ typedef __int128 signed_type;
+    };
+
+    /**
+     * Low level routines working on little endian arrays of limbs.
+     * They are shared by extensible integer types and do not allocate memory
+     * except when explicitly mentionned
+     * @tparam T limb type, must be an unsigned built-in type
+     */
+    template <typename T>
+    class limb_kernel
+    {
+      public:
+        typedef typename limb_double<T>::type double_type;
+
+        /**
+         * Number of bits of a limb
+         */
+        static constexpr unsigned int m_nb_bits = 8 * sizeof(T);
+
+        /**
+         * Return size of number once upper null limbs are removed
+         * @param p_op limbs
+         * @param p_size number of limbs
+         * @return number of significant limbs, 0 if number is null
+         */
+        static
+        size_t significant_size(const T * p_op
+                               ,size_t p_size
+                               );
+
+        /**
+         * Count number of leading zero bits of a non null limb
+         * @param p_limb limb to analyze
+         * @return number of leading zero bits
+         */
+        static
+        unsigned int count_leading_zeros(T p_limb);
+
+        /**
+         * Count number of trailing zero bits of a non null limb
+         * @param p_limb limb to analyze
+         * @return number of trailing zero bits
+         */
+        static
+        unsigned int count_trailing_zeros(T p_limb);
+
+        /**
+         * Compute p_result = p_op << p_shift with 0 < p_shift < m_nb_bits
+         * p_result can be aliased with p_op or located at upper addresses
+         * @return bits shifted out of most significant limb
+         */
+        static
+        T lshift(T * p_result
+                ,const T * p_op
+                ,size_t p_size
+                ,unsigned int p_shift
+                );
+
+        /**
+         * Compute p_result = p_op >> p_shift with 0 < p_shift < m_nb_bits
+         * p_result can be aliased with p_op or located at lower addresses
+         * @return bits shifted out of least significant limb, left aligned
+         */
+        static
+        T rshift(T * p_result
+                ,const T * p_op
+                ,size_t p_size
+                ,unsigned int p_shift
+                );
+
+        /**
+         * Compare two numbers without leading null limbs
+         * @return -1, 0 or 1 if first operand is lower, equal or greater
+         */
+        static
+        int compare(const T * p_op1
+                   ,size_t p_size1
+                   ,const T * p_op2
+                   ,size_t p_size2
+                   );
+
+        /**
+         * Locate most significant limb differing between two numbers of same
+         * size. Limbs are scanned from most significant one by blocks whose
+         * difference is reduced with a branchless loop that compiler can
+         * vectorize
+         * @return index of most significant differing limb plus one, 0 if
+         * numbers are equal
+         */
+        static
+        size_t get_difference_size(const T * p_op1
+                                  ,const T * p_op2
+                                  ,size_t p_size
+                                  );
+
+        /**
+         * Hash limbs of a number
+         * @param p_op limbs of number
+         * @param p_size number of limbs
+         * @param p_seed initial hash value
+         * @return hash value
+         */
+        static
+        uint64_t get_hash(const T * p_op
+                         ,size_t p_size
+                         ,uint64_t p_seed = 0
+                         );
+
+        /**
+         * Compute p_result = p_op1 + p_op2 with p_size1 >= p_size2
+         * p_result can be aliased with p_op1
+         * @return outgoing carry
+         */
+        static
+        T add(T * p_result
+             ,const T * p_op1
+             ,size_t p_size1
+             ,const T * p_op2
+             ,size_t p_size2
+             );
+
+        /**
+         * Compute p_result = p_op1 - p_op2 with p_size1 >= p_size2
+         * p_result can be aliased with p_op1
+         * @return outgoing borrow
+         */
+        static
+        T sub(T * p_result
+             ,const T * p_op1
+             ,size_t p_size1
+             ,const T * p_op2
+             ,size_t p_size2
+             );
+
+        /**
+         * Compute two's complement p_result = -p_op on p_size limbs
+         * p_result can be aliased with p_op
+         * @return true if operand was non null
+         */
+        static
+        bool negate(T * p_result
+                   ,const T * p_op
+                   ,size_t p_size
+                   );
+
+        /**
+         * Compute p_result = p_op * p_mult + p_add
+         * p_result can be aliased with p_op
+         * @return most significant limb of result
+         */
+        static
+        T mul_1(T * p_result
+               ,const T * p_op
+               ,size_t p_size
+               ,T p_mult
+               ,T p_add = 0
+               );
+
+        /**
+         * Compute p_result += p_op * p_mult on p_size limbs
+         * @return carry to add to limb p_size of result
+         */
+        static
+        T addmul_1(T * p_result
+                  ,const T * p_op
+                  ,size_t p_size
+                  ,T p_mult
+                  );
+
+        /**
+         * Compute p_result -= p_op * p_mult on p_size limbs
+         * @return borrow to substract to limb p_size of result
+         */
+        static
+        T submul_1(T * p_result
+                  ,const T * p_op
+                  ,size_t p_size
+                  ,T p_mult
+                  );
+
+        /**
+         * Compute p_result -= p_op * p_mult on p_size limbs by splitting
+         * limbs in p_nb_tasks ranges executed by bignum_thread_pool. Borrow
+         * of each range is then propagated sequentially
+         * @return borrow to substract to limb p_size of result
+         */
+        static
+        T parallel_submul_1(T * p_result
+                           ,const T * p_op
+                           ,size_t p_size
+                           ,T p_mult
+                           ,size_t p_nb_tasks
+                           );
+
+        /**
+         * Compute p_quotient = p_op / p_divisor
+         * p_quotient can be aliased with p_op
+         * @return remainder of division
+         */
+        static
+        T divrem_1(T * p_quotient
+                  ,const T * p_op
+                  ,size_t p_size
+                  ,T p_divisor
+                  );
+
+        /**
+         * Schoolbook multiplication. p_result must have p_size1 + p_size2
+         * limbs and must not be aliased with operands
+         */
+        static
+        void mul(T * p_result
+                ,const T * p_op1
+                ,size_t p_size1
+                ,const T * p_op2
+                ,size_t p_size2
+                );
+
+        /**
+         * Schoolbook squaring computing each cross product once.
+         * p_result must have 2 * p_size limbs and must not be aliased with
+         * operand
+         */
+        static
+        void sqr(T * p_result
+                ,const T * p_op
+                ,size_t p_size
+                );
+
+        /**
+         * Round a magnitude to nearest floating value, ties to even, and
+         * split it like frexp. Only the 64 most significant bits are read,
+         * lower ones are scanned until a non null one is found to decide
+         * rounding. Limbs are read through p_limb so that callers can
+         * provide a magnitude without materializing it
+         * @tparam FLOATING_TYPE float or double
+         * @tparam LIMB_ACCESSOR functor returning limb of given index
+         * @param p_limb accessor of magnitude limbs
+         * @param p_size number of limbs, upper one being non null
+         * @param p_exponent exponent e such that value = mantissa * 2 ^ e
+         * @return mantissa in [0.5, 1[ or 0 if p_size is 0
+         */
+        template <typename FLOATING_TYPE, typename LIMB_ACCESSOR>
+        static
+        FLOATING_TYPE to_mantissa_exp(const LIMB_ACCESSOR & p_limb
+                                     ,size_t p_size
+                                     ,int64_t & p_exponent
+                                     );
+
+        /**
+         * Round a magnitude to nearest floating value, ties to even.
+         * Magnitudes out of floating type range give infinity
+         * @tparam FLOATING_TYPE float or double
+         * @tparam LIMB_ACCESSOR functor returning limb of given index
+         * @param p_limb accessor of magnitude limbs
+         * @param p_size number of limbs, upper one being non null
+         * @return rounded value
+         */
+        template <typename FLOATING_TYPE, typename LIMB_ACCESSOR>
+        static
+        FLOATING_TYPE to_floating(const LIMB_ACCESSOR & p_limb
+                                 ,size_t p_size
+                                 );
+
+        /**
+         * Knuth algorithm D division.
+         * p_quotient must have p_num_size - p_den_size + 1 limbs and
+         * p_remainder p_den_size limbs. Upper limb of denominator must be non
+         * null and p_num_size >= p_den_size. Temporary buffers are leased from
+         * thread bignum_workspace. With big denominators multiply and
+         * substract steps are split across bignum_thread_pool
+         */
+        static
+        void divrem(T * p_quotient
+                   ,T * p_remainder
+                   ,const T * p_num
+                   ,size_t p_num_size
+                   ,const T * p_den
+                   ,size_t p_den_size
+                   );
+
+      private:
+        static_assert(std::is_unsigned<T>::value, "Limb type must be unsigned");
+
+        /**
+         * Extract 64 most significant bits of a magnitude. Least significant
+         * bit is forced to 1 when some lower bits are set so that converting
+         * it to a floating type rounds as the complete magnitude would do
+         * @param p_limb accessor of magnitude limbs
+         * @param p_size number of limbs, upper one being non null
+         * @param p_shift weight of least significant extracted bit
+         * @return extracted bits
+         */
+        template <typename LIMB_ACCESSOR>
+        static
+        uint64_t get_rounding_bits(const LIMB_ACCESSOR & p_limb
+                                  ,size_t p_size
+                                  ,size_t & p_shift
+                                  );
+
+        /**
+         * Build a power of two directly from its IEEE 754 representation,
+         * avoiding a call to ldexp
+         * @tparam FLOATING_TYPE float or double
+         * @param p_exponent exponent lower than max exponent of type
+         * @return 2 ^ p_exponent
+         */
+        template <typename FLOATING_TYPE>
+        static
+        FLOATING_TYPE get_power_of_two(unsigned int p_exponent);
+
+        /**
+         * Each quotient limb of a division needs a synchronisation of threads
+         * so a division task must be this number of times bigger than pool
+         * grain to amortize it
+         */
+        static constexpr size_t m_division_grain_factor = 8;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    size_t
+    limb_kernel<T>::significant_size(const T * p_op
+                                    ,size_t p_size
+                                    )
+    {
+        while(p_size && !p_op[p_size - 1])
+        {
+            --p_size;
+        }
+        return p_size;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    unsigned int
+    limb_kernel<T>::count_leading_zeros(T p_limb)
+    {
+        assert(p_limb);
+        if(sizeof(T) <= sizeof(unsigned int))
+        {
+            return __builtin_clz((unsigned int)p_limb) - (8 * sizeof(unsigned int) - m_nb_bits);
+        }
+        return __builtin_clzll((unsigned long long)p_limb) - (8 * sizeof(unsigned long long) - m_nb_bits);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    unsigned int
+    limb_kernel<T>::count_trailing_zeros(T p_limb)
+    {
+        assert(p_limb);
+        if(sizeof(T) <= sizeof(unsigned int))
+        {
+            return __builtin_ctz((unsigned int)p_limb);
+        }
+        return __builtin_ctzll((unsigned long long)p_limb);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    T
+    limb_kernel<T>::lshift(T * p_result
+                          ,const T * p_op
+                          ,size_t p_size
+                          ,unsigned int p_shift
+                          )
+    {
+        assert(p_size && p_shift && p_shift < m_nb_bits);
+        // Iterate from upper limb so that in place shift is possible
+        T l_out = (T)(p_op[p_size - 1] >> (m_nb_bits - p_shift));
+        for(size_t l_index = p_size - 1; l_index > 0; --l_index)
+        {
+            p_result[l_index] = (T)((p_op[l_index] << p_shift) | (p_op[l_index - 1] >> (m_nb_bits - p_shift)));
+        }
+        p_result[0] = (T)(p_op[0] << p_shift);
+        return l_out;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    T
+    limb_kernel<T>::rshift(T * p_result
+                          ,const T * p_op
+                          ,size_t p_size
+                          ,unsigned int p_shift
+                          )
+    {
+        assert(p_size && p_shift && p_shift < m_nb_bits);
+        // Iterate from lower limb so that in place shift is possible
+        T l_out = (T)(p_op[0] << (m_nb_bits - p_shift));
+        for(size_t l_index = 0; l_index < p_size - 1; ++l_index)
+        {
+            p_result[l_index] = (T)((p_op[l_index] >> p_shift) | (p_op[l_index + 1] << (m_nb_bits - p_shift)));
+        }
+        p_result[p_size - 1] = (T)(p_op[p_size - 1] >> p_shift);
+        return l_out;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    int
+    limb_kernel<T>::compare(const T * p_op1
+                           ,size_t p_size1
+                           ,const T * p_op2
+                           ,size_t p_size2
+                           )
+    {
+        if(p_size1 != p_size2)
+        {
+            return p_size1 < p_size2 ? -1 : 1;
+        }
+        size_t l_index = get_difference_size(p_op1, p_op2, p_size1);
+        if(!l_index)
+        {
+            return 0;
+        }
+        return p_op1[l_index - 1] < p_op2[l_index - 1] ? -1 : 1;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    size_t
+    limb_kernel<T>::get_difference_size(const T * p_op1
+                                       ,const T * p_op2
+                                       ,size_t p_size
+                                       )
+    {
+        // One 256 bits vector per block
+        constexpr size_t l_block_size = 32 / sizeof(T);
+        size_t l_index = p_size;
+        while(l_index >= l_block_size)
+        {
+            T l_difference = 0;
+            for(size_t l_block_index = l_index - l_block_size; l_block_index < l_index; ++l_block_index)
+            {
+                l_difference |= p_op1[l_block_index] ^ p_op2[l_block_index];
+            }
+            if(l_difference)
+            {
+                break;
+            }
+            l_index -= l_block_size;
+        }
+        while(l_index && p_op1[l_index - 1] == p_op2[l_index - 1])
+        {
+            --l_index;
+        }
+        return l_index;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    uint64_t
+    limb_kernel<T>::get_hash(const T * p_op
+                            ,size_t p_size
+                            ,uint64_t p_seed
+                            )
+    {
+        uint64_t l_hash = p_seed ^ (p_size * 0x9E3779B97F4A7C15ULL);
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            l_hash = (l_hash ^ p_op[l_index]) * 0xFF51AFD7ED558CCDULL;
+            l_hash ^= l_hash >> 32;
+        }
+        return l_hash;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    T
+    limb_kernel<T>::add(T * p_result
+                       ,const T * p_op1
+                       ,size_t p_size1
+                       ,const T * p_op2
+                       ,size_t p_size2
+                       )
+    {
+        assert(p_size1 >= p_size2);
+        T l_carry = 0;
+        size_t l_index = 0;
+        for(;
+            l_index < p_size2;
+            ++l_index
+           )
+        {
+            T l_sum = (T)(p_op1[l_index] + l_carry);
+            l_carry = l_sum < l_carry;
+            T l_result = (T)(l_sum + p_op2[l_index]);
+            l_carry += l_result < l_sum;
+            p_result[l_index] = l_result;
+        }
+        for(;
+            l_index < p_size1;
+            ++l_index
+           )
+        {
+            T l_sum = (T)(p_op1[l_index] + l_carry);
+            l_carry = l_sum < l_carry;
+            p_result[l_index] = l_sum;
+        }
+        return l_carry;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    T
+    limb_kernel<T>::sub(T * p_result
+                       ,const T * p_op1
+                       ,size_t p_size1
+                       ,const T * p_op2
+                       ,size_t p_size2
+                       )
+    {
+        assert(p_size1 >= p_size2);
+        T l_borrow = 0;
+        size_t l_index = 0;
+        for(;
+            l_index < p_size2;
+            ++l_index
+           )
+        {
+            T l_op1 = p_op1[l_index];
+            T l_diff = (T)(l_op1 - p_op2[l_index]);
+            T l_new_borrow = l_diff > l_op1;
+            T l_result = (T)(l_diff - l_borrow);
+            l_new_borrow += l_result > l_diff;
+            p_result[l_index] = l_result;
+            l_borrow = l_new_borrow;
+        }
+        for(;
+            l_index < p_size1;
+            ++l_index
+           )
+        {
+            T l_op1 = p_op1[l_index];
+            T l_result = (T)(l_op1 - l_borrow);
+            l_borrow = l_result > l_op1;
+            p_result[l_index] = l_result;
+        }
+        return l_borrow;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    limb_kernel<T>::negate(T * p_result
+                          ,const T * p_op
+                          ,size_t p_size
+                          )
+    {
+        // Low null limbs stay null, first non null limb is negated and
+        // upper limbs are complemented
+        size_t l_index = 0;
+        while(l_index < p_size && !p_op[l_index])
+        {
+            p_result[l_index] = 0;
+            ++l_index;
+        }
+        if(l_index == p_size)
+        {
+            return false;
+        }
+        p_result[l_index] = (T)(-p_op[l_index]);
+        for(++l_index; l_index < p_size; ++l_index)
+        {
+            p_result[l_index] = (T)~p_op[l_index];
+        }
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    T
+    limb_kernel<T>::mul_1(T * p_result
+                         ,const T * p_op
+                         ,size_t p_size
+                         ,T p_mult
+                         ,T p_add
+                         )
+    {
+        T l_carry = p_add;
+        for(size_t l_index = 0;
+            l_index < p_size;
+            ++l_index
+           )
+        {
+            double_type l_product = ((double_type)p_op[l_index]) * p_mult + l_carry;
+            p_result[l_index] = (T)l_product;
+            l_carry = (T)(l_product >> m_nb_bits);
+        }
+        return l_carry;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    T
+    limb_kernel<T>::addmul_1(T * p_result
+                            ,const T * p_op
+                            ,size_t p_size
+                            ,T p_mult
+                            )
+    {
+        T l_carry = 0;
+        for(size_t l_index = 0;
+            l_index < p_size;
+            ++l_index
+           )
+        {
+            double_type l_product = ((double_type)p_op[l_index]) * p_mult + p_result[l_index] + l_carry;
+            p_result[l_index] = (T)l_product;
+            l_carry = (T)(l_product >> m_nb_bits);
+        }
+        return l_carry;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    T
+    limb_kernel<T>::submul_1(T * p_result
+                            ,const T * p_op
+                            ,size_t p_size
+                            ,T p_mult
+                            )
+    {
+        T l_borrow = 0;
+        for(size_t l_index = 0;
+            l_index < p_size;
+            ++l_index
+           )
+        {
+            double_type l_product = ((double_type)p_op[l_index]) * p_mult + l_borrow;
+            T l_low = (T)l_product;
+            T l_previous = p_result[l_index];
+            T l_result = (T)(l_previous - l_low);
+            l_borrow = (T)((l_product >> m_nb_bits) + (l_result > l_previous));
+            p_result[l_index] = l_result;
+        }
+        return l_borrow;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    T
+    limb_kernel<T>::parallel_submul_1(T * p_result
+                                     ,const T * p_op
+                                     ,size_t p_size
+                                     ,T p_mult
+                                     ,size_t p_nb_tasks
+                                     )
+    {
+        p_nb_tasks = std::max((size_t)1, std::min(p_nb_tasks, p_size));
+        typename bignum_workspace<T>::buffer l_borrows_buffer = bignum_workspace<T>::get().acquire(p_nb_tasks);
+        T * l_borrows = l_borrows_buffer.data();
+        bignum_thread_pool::parallel_for(p_nb_tasks, p_nb_tasks, [&](size_t p_task_begin, size_t p_task_end)
+        {
+            for(size_t l_task = p_task_begin; l_task < p_task_end; ++l_task)
+            {
+                size_t l_begin = l_task * p_size / p_nb_tasks;
+                size_t l_end = (l_task + 1) * p_size / p_nb_tasks;
+                l_borrows[l_task] = submul_1(p_result + l_begin, p_op + l_begin, l_end - l_begin, p_mult);
+            }
+        });
+        // Pending borrow can exceed a limb while propagated but final borrow
+        // is the same as sequential one
+        double_type l_pending = 0;
+        for(size_t l_task = 0; l_task < p_nb_tasks; ++l_task)
+        {
+            size_t l_end = (l_task + 1) * p_size / p_nb_tasks;
+            for(size_t l_index = l_task * p_size / p_nb_tasks; l_pending && l_index < l_end; ++l_index)
+            {
+                T l_low = (T)l_pending;
+                T l_previous = p_result[l_index];
+                p_result[l_index] = (T)(l_previous - l_low);
+                l_pending = (l_pending >> m_nb_bits) + (l_low > l_previous);
+            }
+            l_pending += l_borrows[l_task];
+        }
+        return (T)l_pending;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    T
+    limb_kernel<T>::divrem_1(T * p_quotient
+                            ,const T * p_op
+                            ,size_t p_size
+                            ,T p_divisor
+                            )
+    {
+        assert(p_divisor);
+        double_type l_remainder = 0;
+        size_t l_index = p_size;
+        while(l_index)
+        {
+            --l_index;
+            double_type l_current = (l_remainder << m_nb_bits) | p_op[l_index];
+            p_quotient[l_index] = (T)(l_current / p_divisor);
+            l_remainder = l_current % p_divisor;
+        }
+        return (T)l_remainder;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    limb_kernel<T>::mul(T * p_result
+                       ,const T * p_op1
+                       ,size_t p_size1
+                       ,const T * p_op2
+                       ,size_t p_size2
+                       )
+    {
+        assert(p_result != p_op1 && p_result != p_op2);
+        for(size_t l_index = 0;
+            l_index < p_size1 + p_size2;
+            ++l_index
+           )
+        {
+            p_result[l_index] = 0;
+        }
+        for(size_t l_index = 0;
+            l_index < p_size2;
+            ++l_index
+           )
+        {
+            p_result[l_index + p_size1] = addmul_1(p_result + l_index, p_op1, p_size1, p_op2[l_index]);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    limb_kernel<T>::sqr(T * p_result
+                       ,const T * p_op
+                       ,size_t p_size
+                       )
+    {
+        assert(p_result != p_op && p_size);
+        // Cross products a[i] * a[j] with i < j, row i starting at 2 * i + 1
+        p_result[0] = 0;
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            p_result[l_index + 1] = 0;
+        }
+        for(size_t l_index = 0; l_index + 1 < p_size; ++l_index)
+        {
+            p_result[l_index + p_size] = addmul_1(p_result + 2 * l_index + 1, p_op + l_index + 1, p_size - l_index - 1, p_op[l_index]);
+        }
+        p_result[2 * p_size - 1] = 0;
+        // Double cross products then add squares of limbs
+        lshift(p_result, p_result, 2 * p_size, 1);
+        T l_carry = 0;
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            double_type l_square = ((double_type)p_op[l_index]) * p_op[l_index];
+            double_type l_low = (double_type)p_result[2 * l_index] + (T)l_square + l_carry;
+            p_result[2 * l_index] = (T)l_low;
+            double_type l_high = (double_type)p_result[2 * l_index + 1] + (T)(l_square >> m_nb_bits) + (T)(l_low >> m_nb_bits);
+            p_result[2 * l_index + 1] = (T)l_high;
+            l_carry = (T)(l_high >> m_nb_bits);
+        }
+        assert(!l_carry);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <typename LIMB_ACCESSOR>
+    uint64_t
+    limb_kernel<T>::get_rounding_bits(const LIMB_ACCESSOR & p_limb
+                                     ,size_t p_size
+                                     ,size_t & p_shift
+                                     )
+    {
+        assert(p_size && p_limb(p_size - 1));
+        if(p_size * m_nb_bits <= 64)
+        {
+            // Magnitude is exactly representable in extracted bits
+            uint64_t l_bits = 0;
+            for(size_t l_index = p_size; l_index > 0;)
+            {
+                --l_index;
+                l_bits = (uint64_t)(((unsigned __int128)l_bits << m_nb_bits) | p_limb(l_index));
+            }
+            p_shift = 0;
+            return l_bits;
+        }
+        typedef unsigned __int128 t_window;
+        size_t l_bit_length = p_size * m_nb_bits - count_leading_zeros(p_limb(p_size - 1));
+        p_shift = l_bit_length > 64 ? l_bit_length - 64 : 0;
+        // Limbs containing the 64 upper bits hold less than 128 bits
+        size_t l_first_limb = p_shift / m_nb_bits;
+        t_window l_window = 0;
+        for(size_t l_index = p_size; l_index > l_first_limb;)
+        {
+            --l_index;
+            l_window = (l_window << m_nb_bits) | p_limb(l_index);
+        }
+        unsigned int l_window_shift = (unsigned int)(p_shift - l_first_limb * m_nb_bits);
+        uint64_t l_bits = (uint64_t)(l_window >> l_window_shift);
+        bool l_sticky = l_window & ((((t_window)1) << l_window_shift) - 1);
+        for(size_t l_index = l_first_limb; !l_sticky && l_index > 0;)
+        {
+            --l_index;
+            l_sticky = p_limb(l_index);
+        }
+        return l_bits | l_sticky;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <typename FLOATING_TYPE>
+    FLOATING_TYPE
+    limb_kernel<T>::get_power_of_two(unsigned int p_exponent)
+    {
+        static_assert(std::numeric_limits<FLOATING_TYPE>::is_iec559, "IEEE 754 representation expected");
+        typedef typename std::conditional<sizeof(FLOATING_TYPE) == sizeof(uint32_t), uint32_t, uint64_t>::type t_bits;
+        static_assert(sizeof(t_bits) == sizeof(FLOATING_TYPE), "Unsupported floating type");
+        assert(p_exponent < (unsigned int)std::numeric_limits<FLOATING_TYPE>::max_exponent);
+        constexpr unsigned int l_nb_fraction_bits = std::numeric_limits<FLOATING_TYPE>::digits - 1;
+        constexpr unsigned int l_bias = std::numeric_limits<FLOATING_TYPE>::max_exponent - 1;
+        t_bits l_bits = ((t_bits)(p_exponent + l_bias)) << l_nb_fraction_bits;
+        FLOATING_TYPE l_result;
+        std::memcpy(&l_result, &l_bits, sizeof(l_result));
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <typename FLOATING_TYPE, typename LIMB_ACCESSOR>
+    FLOATING_TYPE
+    limb_kernel<T>::to_mantissa_exp(const LIMB_ACCESSOR & p_limb
+                                   ,size_t p_size
+                                   ,int64_t & p_exponent
+                                   )
+    {
+        static_assert(std::numeric_limits<FLOATING_TYPE>::digits < 63, "Rounding relies on extracted bits being wider than mantissa");
+        p_exponent = 0;
+        if(!p_size)
+        {
+            return 0;
+        }
+        size_t l_shift;
+        // Conversion of extracted bits performs rounding to nearest even
+        int l_exponent;
+        FLOATING_TYPE l_mantissa = std::frexp((FLOATING_TYPE)get_rounding_bits(p_limb, p_size, l_shift), &l_exponent);
+        p_exponent = l_exponent + (int64_t)l_shift;
+        return l_mantissa;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    template <typename FLOATING_TYPE, typename LIMB_ACCESSOR>
+    FLOATING_TYPE
+    limb_kernel<T>::to_floating(const LIMB_ACCESSOR & p_limb
+                               ,size_t p_size
+                               )
+    {
+        if(!p_size)
+        {
+            return 0;
+        }
+        size_t l_shift;
+        FLOATING_TYPE l_result = (FLOATING_TYPE)get_rounding_bits(p_limb, p_size, l_shift);
+        // When bits are dropped extracted value is at least 2 ^ 63 so any
+        // shift reaching max exponent overflows
+        if(l_shift >= (size_t)std::numeric_limits<FLOATING_TYPE>::max_exponent)
+        {
+            return std::numeric_limits<FLOATING_TYPE>::infinity();
+        }
+        // Scaling by an exact power of two does not round again
+        return l_shift ? l_result * get_power_of_two<FLOATING_TYPE>((unsigned int)l_shift) : l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    limb_kernel<T>::divrem(T * p_quotient
+                          ,T * p_remainder
+                          ,const T * p_num
+                          ,size_t p_num_size
+                          ,const T * p_den
+                          ,size_t p_den_size
+                          )
+    {
+        assert(p_den_size && p_den[p_den_size - 1]);
+        assert(p_num_size >= p_den_size);
+        if(1 == p_den_size)
+        {
+            p_remainder[0] = divrem_1(p_quotient, p_num, p_num_size, p_den[0]);
+            return;
+        }
+        // Normalize operands so that upper bit of denominator is set
+        unsigned int l_shift = count_leading_zeros(p_den[p_den_size - 1]);
+        bignum_workspace<T> & l_workspace = bignum_workspace<T>::get();
+        typename bignum_workspace<T>::buffer l_den_buffer = l_workspace.acquire(p_den_size);
+        typename bignum_workspace<T>::buffer l_num_buffer = l_workspace.acquire(p_num_size + 1);
+        T * l_den = l_den_buffer.data();
+        T * l_num = l_num_buffer.data();
+        if(l_shift)
+        {
+            lshift(l_den, p_den, p_den_size, l_shift);
+            l_num[p_num_size] = lshift(l_num, p_num, p_num_size, l_shift);
+        }
+        else
+        {
+            std::copy(p_den, p_den + p_den_size, l_den);
+            std::copy(p_num, p_num + p_num_size, l_num);
+            l_num[p_num_size] = 0;
+        }
+
+        constexpr double_type l_base = ((double_type)1) << m_nb_bits;
+        size_t l_nb_tasks = bignum_thread_pool::get_nb_tasks(p_den_size / m_division_grain_factor);
+        const T l_den_high = l_den[p_den_size - 1];
+        const T l_den_second = l_den[p_den_size - 2];
+        for(size_t l_j = p_num_size - p_den_size + 1; l_j > 0;)
+        {
+            --l_j;
+            // Estimate quotient limb using the two upper limbs of the current remainder
+            double_type l_current = (((double_type)l_num[l_j + p_den_size]) << m_nb_bits) | l_num[l_j + p_den_size - 1];
+            double_type l_qhat = l_current / l_den_high;
+            double_type l_rhat = l_current % l_den_high;
+            while(l_qhat >= l_base || l_qhat * l_den_second > ((l_rhat << m_nb_bits) | l_num[l_j + p_den_size - 2]))
+            {
+                --l_qhat;
+                l_rhat += l_den_high;
+                if(l_rhat >= l_base)
+                {
+                    break;
+                }
+            }
+            // Multiply and substract
+            T l_borrow = l_nb_tasks > 1 ? parallel_submul_1(l_num + l_j, l_den, p_den_size, (T)l_qhat, l_nb_tasks) : submul_1(l_num + l_j, l_den, p_den_size, (T)l_qhat);
+            T l_upper = l_num[l_j + p_den_size];
+            l_num[l_j + p_den_size] = (T)(l_upper - l_borrow);
+            if(l_borrow > l_upper)
+            {
+                // Estimation was one too large: add back
+                --l_qhat;
+                T l_carry = add(l_num + l_j, l_num + l_j, p_den_size, l_den, p_den_size);
+                l_num[l_j + p_den_size] = (T)(l_num[l_j + p_den_size] + l_carry);
+            }
+            p_quotient[l_j] = (T)l_qhat;
+        }
+
+        // Unnormalize remainder
+        if(l_shift)
+        {
+            // Upper limb of l_num is null after last substraction
+            rshift(p_remainder, l_num, p_den_size, l_shift);
+        }
+        else
+        {
+            std::copy(l_num, l_num + p_den_size, p_remainder);
+        }
+    }
+
+}
+#endif //QUICKY_UTILS_LIMB_KERNEL_H
+// EOF
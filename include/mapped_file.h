@@ -0,0 +1,148 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+#ifndef QUICKY_UTILS_MAPPED_FILE_H
+#define QUICKY_UTILS_MAPPED_FILE_H
+
+#include "quicky_exception.h"
+#include <string>
+#include <cstddef>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <vector>
+#endif // _WIN32
+
+namespace quicky_utils
+{
+    /**
+     * Read only view of a file content. On POSIX systems file is mapped in
+     * memory so that opening it costs nothing whatever its size: pages are
+     * loaded by the system when accessed. On other systems content is read
+     * in memory. Data is aligned on a page, or on default allocation
+     * alignment when read
+     */
+    class mapped_file
+    {
+      public:
+        /**
+         * Map a file
+         * @param p_name name of file
+         */
+        inline explicit
+        mapped_file(const std::string & p_name);
+
+        mapped_file(const mapped_file &) = delete;
+        mapped_file & operator=(const mapped_file &) = delete;
+
+        inline
+        ~mapped_file();
+
+        /**
+         * File content
+         * @return pointer on first byte, nullptr for an empty file
+         */
+        [[nodiscard]] inline
+        const void * get_data() const;
+
+        /**
+         * Size of file
+         * @return number of bytes
+         */
+        [[nodiscard]] inline
+        size_t get_size() const;
+
+      private:
+        const void * m_data;
+        size_t m_size;
+#ifdef _WIN32
+        std::vector<char> m_content;
+#endif // _WIN32
+    };
+
+    //-------------------------------------------------------------------------
+    mapped_file::mapped_file(const std::string & p_name)
+    :m_data(nullptr)
+    ,m_size(0)
+    {
+#ifndef _WIN32
+        int l_descriptor = open(p_name.c_str(), O_RDONLY);
+        if(-1 == l_descriptor)
+        {
+            throw quicky_exception::quicky_runtime_exception("Unable to open file " + p_name, __LINE__, __FILE__);
+        }
+        struct stat l_stat{};
+        if(-1 == fstat(l_descriptor, &l_stat))
+        {
+            close(l_descriptor);
+            throw quicky_exception::quicky_runtime_exception("Unable to get size of file " + p_name, __LINE__, __FILE__);
+        }
+        m_size = (size_t)l_stat.st_size;
+        if(m_size)
+        {
+            void * l_data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, l_descriptor, 0);
+            if(MAP_FAILED == l_data)
+            {
+                close(l_descriptor);
+                throw quicky_exception::quicky_runtime_exception("Unable to map file " + p_name, __LINE__, __FILE__);
+            }
+            m_data = l_data;
+        }
+        // Mapping remains valid once descriptor is closed
+        close(l_descriptor);
+#else
+        std::ifstream l_file(p_name, std::ios::binary);
+        if(!l_file.is_open())
+        {
+            throw quicky_exception::quicky_runtime_exception("Unable to open file " + p_name, __LINE__, __FILE__);
+        }
+        m_content.assign(std::istreambuf_iterator<char>(l_file), std::istreambuf_iterator<char>());
+        m_size = m_content.size();
+        m_data = m_size ? m_content.data() : nullptr;
+#endif // _WIN32
+    }
+
+    //-------------------------------------------------------------------------
+    mapped_file::~mapped_file()
+    {
+#ifndef _WIN32
+        if(m_data)
+        {
+            munmap(const_cast<void *>(m_data), m_size);
+        }
+#endif // _WIN32
+    }
+
+    //-------------------------------------------------------------------------
+    const void *
+    mapped_file::get_data() const
+    {
+        return m_data;
+    }
+
+    //-------------------------------------------------------------------------
+    size_t
+    mapped_file::get_size() const
+    {
+        return m_size;
+    }
+}
+#endif //QUICKY_UTILS_MAPPED_FILE_H
+// EOF
@@ -0,0 +1,555 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+#ifndef QUICKY_UTILS_MODULAR_CONTEXT_H
+#define QUICKY_UTILS_MODULAR_CONTEXT_H
+
+#include "ext_uint.h"
+#include "limb_kernel.h"
+#include "quicky_exception.h"
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+namespace quicky_utils
+{
+    /**
+     * Modular arithmetic modulo a fixed odd number using Montgomery
+     * representation. Constants are computed once at construction and all
+     * operations work on preallocated buffers of the modulus width so that
+     * inner loops of powmod and invmod do not allocate memory.
+     * Buffers are shared by operations so a context must not be used
+     * concurrently by several threads
+     * @tparam T limb type of ext_uint
+     */
+    template <typename T>
+    class modular_context
+    {
+      public:
+        /**
+         * Constructor
+         * @param p_modulus odd modulus greater than 1
+         */
+        explicit
+        modular_context(const ext_uint<T> & p_modulus);
+
+        /**
+         * Modulus accessor
+         * @return modulus
+         */
+        [[nodiscard]]
+        const ext_uint<T> & get_modulus() const;
+
+        /**
+         * Number of limbs of numbers in Montgomery representation
+         * @return number of limbs of modulus
+         */
+        [[nodiscard]]
+        size_t get_size() const;
+
+        /**
+         * Compute p_op1 * p_op2 mod modulus
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         * @return product modulo modulus
+         */
+        ext_uint<T> mulmod(const ext_uint<T> & p_op1
+                          ,const ext_uint<T> & p_op2
+                          ) const;
+
+        /**
+         * Compute p_base ^ p_exponent mod modulus using sliding window
+         * exponentiation
+         * @param p_base number to raise
+         * @param p_exponent exponent
+         * @return power modulo modulus
+         */
+        ext_uint<T> powmod(const ext_uint<T> & p_base
+                          ,const ext_uint<T> & p_exponent
+                          ) const;
+
+        /**
+         * Compute inverse of p_op modulo modulus using binary extended
+         * euclidean algorithm. Throw if p_op is not invertible
+         * @param p_op number to invert
+         * @return x such that x * p_op = 1 mod modulus
+         */
+        ext_uint<T> invmod(const ext_uint<T> & p_op) const;
+
+        /**
+         * Convert number in Montgomery representation p_op * R mod modulus
+         * @param p_result buffer of get_size() limbs
+         * @param p_op number to convert
+         */
+        void to_montgomery(T * p_result
+                          ,const ext_uint<T> & p_op
+                          ) const;
+
+        /**
+         * Convert number from Montgomery representation
+         * @param p_op buffer of get_size() limbs
+         * @return p_op / R mod modulus
+         */
+        ext_uint<T> from_montgomery(const T * p_op) const;
+
+        /**
+         * Montgomery product p_result = p_op1 * p_op2 / R mod modulus
+         * Operands must be lower than modulus. Buffers have get_size() limbs
+         * and p_result can be aliased with operands
+         * @param p_result result buffer
+         * @param p_op1 first operand
+         * @param p_op2 second operand
+         */
+        void montgomery_mul(T * p_result
+                           ,const T * p_op1
+                           ,const T * p_op2
+                           ) const;
+
+      private:
+
+        /**
+         * Store p_op mod modulus in a buffer of m_size limbs
+         * @param p_result result buffer
+         * @param p_op number to reduce
+         */
+        void reduce(T * p_result
+                   ,const ext_uint<T> & p_op
+                   ) const;
+
+        /**
+         * Compute p_op / 2 mod modulus in place on m_size + 1 limbs
+         * @param p_op number lower than modulus
+         */
+        void half_mod(T * p_op) const;
+
+        /**
+         * Compute p_op1 - p_op2 mod modulus in place on m_size + 1 limbs
+         * @param p_op1 number lower than modulus
+         * @param p_op2 number lower than modulus
+         */
+        void sub_mod(T * p_op1
+                    ,const T * p_op2
+                    ) const;
+
+        /**
+         * Check if a number is equal to p_value
+         * @param p_op number
+         * @param p_size number of limbs
+         * @param p_value value of least significant limb
+         * @return true if number is equal to p_value
+         */
+        static
+        bool is_equal(const T * p_op
+                     ,size_t p_size
+                     ,T p_value
+                     );
+
+        /**
+         * Choose exponentiation window size depending on exponent size
+         * @param p_nb_bits number of bits of exponent
+         * @return window size in bits
+         */
+        static
+        unsigned int get_window_size(size_t p_nb_bits);
+
+        ext_uint<T> m_modulus;
+
+        /**
+         * Number of limbs of modulus
+         */
+        size_t m_size;
+
+        /**
+         * -modulus^-1 mod 2^(limb bits)
+         */
+        T m_inverse;
+
+        /**
+         * R mod modulus, R being 2 ^ (m_size * limb bits)
+         */
+        std::vector<T> m_one;
+
+        /**
+         * R^2 mod modulus
+         */
+        std::vector<T> m_r2;
+
+        /**
+         * Number 1 used to leave Montgomery representation
+         */
+        std::vector<T> m_unit;
+
+        /**
+         * Scratch buffers
+         */
+        mutable std::vector<T> m_product;
+        mutable std::vector<T> m_quotient;
+        mutable std::vector<T> m_op1;
+        mutable std::vector<T> m_op2;
+        mutable std::vector<T> m_window;
+        mutable std::vector<T> m_u;
+        mutable std::vector<T> m_v;
+        mutable std::vector<T> m_x1;
+        mutable std::vector<T> m_x2;
+    };
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    modular_context<T>::modular_context(const ext_uint<T> & p_modulus):
+    m_modulus(p_modulus),
+    m_size(p_modulus.get_extension().size()),
+    m_inverse(0),
+    m_one(m_size),
+    m_r2(m_size),
+    m_unit(m_size, 0),
+    m_product(2 * m_size + 1),
+    m_op1(m_size),
+    m_op2(m_size),
+    m_u(m_size + 1),
+    m_v(m_size + 1),
+    m_x1(m_size + 1),
+    m_x2(m_size + 1)
+    {
+        const std::vector<T> & l_modulus = m_modulus.get_extension();
+        if(!(l_modulus[0] & 1u) || (1 == m_size && 1 == l_modulus[0]))
+        {
+            throw quicky_exception::quicky_logic_exception("Montgomery modulus must be odd and greater than 1", __LINE__, __FILE__);
+        }
+
+        // Newton iteration doubles the number of correct bits of inverse
+        T l_inverse = 1;
+        for(unsigned int l_nb_bits = 1; l_nb_bits < limb_kernel<T>::m_nb_bits; l_nb_bits *= 2)
+        {
+            l_inverse = (T)((unsigned long long)l_inverse * (T)(2 - (unsigned long long)l_modulus[0] * l_inverse));
+        }
+        m_inverse = (T)(0 - (unsigned long long)l_inverse);
+
+        // R^2 mod modulus computed by long division of 2 ^ (2 * m_size * limb bits)
+        std::vector<T> l_r2(2 * m_size + 1, 0);
+        l_r2.back() = 1;
+        m_quotient.resize(m_size + 2);
+        limb_kernel<T>::divrem(&m_quotient[0], &m_r2[0], &l_r2[0], l_r2.size(), &l_modulus[0], m_size);
+
+        m_unit[0] = 1;
+        montgomery_mul(&m_one[0], &m_r2[0], &m_unit[0]);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    const ext_uint<T> &
+    modular_context<T>::get_modulus() const
+    {
+        return m_modulus;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    size_t
+    modular_context<T>::get_size() const
+    {
+        return m_size;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    modular_context<T>::mulmod(const ext_uint<T> & p_op1
+                              ,const ext_uint<T> & p_op2
+                              ) const
+    {
+        reduce(&m_op1[0], p_op1);
+        reduce(&m_op2[0], p_op2);
+        // (op1 * op2 / R) * R^2 / R = op1 * op2
+        montgomery_mul(&m_op1[0], &m_op1[0], &m_op2[0]);
+        montgomery_mul(&m_op1[0], &m_op1[0], &m_r2[0]);
+        return ext_uint<T>::from_limbs(&m_op1[0], m_size);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    modular_context<T>::powmod(const ext_uint<T> & p_base
+                              ,const ext_uint<T> & p_exponent
+                              ) const
+    {
+        size_t l_nb_bits = p_exponent.bit_length();
+        if(!l_nb_bits)
+        {
+            return ext_uint<T>({1});
+        }
+
+        // Precompute odd powers base^1, base^3, ..., base^(2^window - 1)
+        unsigned int l_window_size = get_window_size(l_nb_bits);
+        size_t l_nb_powers = ((size_t)1) << (l_window_size - 1);
+        if(m_window.size() < l_nb_powers * m_size)
+        {
+            m_window.resize(l_nb_powers * m_size);
+        }
+        T * l_powers = &m_window[0];
+        to_montgomery(l_powers, p_base);
+        if(l_nb_powers > 1)
+        {
+            montgomery_mul(&m_op2[0], l_powers, l_powers);
+            for(size_t l_index = 1; l_index < l_nb_powers; ++l_index)
+            {
+                montgomery_mul(l_powers + l_index * m_size, l_powers + (l_index - 1) * m_size, &m_op2[0]);
+            }
+        }
+
+        T * l_result = &m_op1[0];
+        std::copy(m_one.begin(), m_one.end(), l_result);
+        size_t l_remaining = l_nb_bits;
+        while(l_remaining)
+        {
+            if(!p_exponent.test_bit(l_remaining - 1))
+            {
+                montgomery_mul(l_result, l_result, l_result);
+                --l_remaining;
+                continue;
+            }
+            // Longest window ending with a set bit
+            size_t l_width = std::min((size_t)l_window_size, l_remaining);
+            while(!p_exponent.test_bit(l_remaining - l_width))
+            {
+                --l_width;
+            }
+            size_t l_value = 0;
+            for(size_t l_index = 0; l_index < l_width; ++l_index)
+            {
+                l_value = (l_value << 1u) | p_exponent.test_bit(l_remaining - 1 - l_index);
+                montgomery_mul(l_result, l_result, l_result);
+            }
+            montgomery_mul(l_result, l_result, l_powers + ((l_value - 1) / 2) * m_size);
+            l_remaining -= l_width;
+        }
+        return from_montgomery(l_result);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    modular_context<T>::invmod(const ext_uint<T> & p_op) const
+    {
+        // Invariants: x1 * op = u and x2 * op = v modulo modulus
+        const std::vector<T> & l_modulus = m_modulus.get_extension();
+        size_t l_size = m_size + 1;
+        T * l_u = &m_u[0];
+        T * l_v = &m_v[0];
+        T * l_x1 = &m_x1[0];
+        T * l_x2 = &m_x2[0];
+        reduce(l_u, p_op);
+        l_u[m_size] = 0;
+        std::copy(l_modulus.begin(), l_modulus.end(), l_v);
+        l_v[m_size] = 0;
+        std::fill(l_x1, l_x1 + l_size, (T)0);
+        l_x1[0] = 1;
+        std::fill(l_x2, l_x2 + l_size, (T)0);
+
+        while(!is_equal(l_u, l_size, 1) && !is_equal(l_v, l_size, 1))
+        {
+            if(is_equal(l_u, l_size, 0))
+            {
+                throw quicky_exception::quicky_logic_exception("Operand is not invertible modulo " + m_modulus.to_string(), __LINE__, __FILE__);
+            }
+            while(!(l_u[0] & 1u))
+            {
+                limb_kernel<T>::rshift(l_u, l_u, l_size, 1);
+                half_mod(l_x1);
+            }
+            while(!(l_v[0] & 1u))
+            {
+                limb_kernel<T>::rshift(l_v, l_v, l_size, 1);
+                half_mod(l_x2);
+            }
+            if(limb_kernel<T>::compare(l_u, l_size, l_v, l_size) >= 0)
+            {
+                limb_kernel<T>::sub(l_u, l_u, l_size, l_v, l_size);
+                sub_mod(l_x1, l_x2);
+            }
+            else
+            {
+                limb_kernel<T>::sub(l_v, l_v, l_size, l_u, l_size);
+                sub_mod(l_x2, l_x1);
+            }
+        }
+        return ext_uint<T>::from_limbs(is_equal(l_u, l_size, 1) ? l_x1 : l_x2, l_size);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    modular_context<T>::to_montgomery(T * p_result
+                                     ,const ext_uint<T> & p_op
+                                     ) const
+    {
+        reduce(p_result, p_op);
+        montgomery_mul(p_result, p_result, &m_r2[0]);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    ext_uint<T>
+    modular_context<T>::from_montgomery(const T * p_op) const
+    {
+        montgomery_mul(&m_op2[0], p_op, &m_unit[0]);
+        return ext_uint<T>::from_limbs(&m_op2[0], m_size);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    modular_context<T>::montgomery_mul(T * p_result
+                                      ,const T * p_op1
+                                      ,const T * p_op2
+                                      ) const
+    {
+        const T * l_modulus = &m_modulus.get_extension()[0];
+        T * l_product = &m_product[0];
+        limb_kernel<T>::mul(l_product, p_op1, m_size, p_op2, m_size);
+        l_product[2 * m_size] = 0;
+
+        // Montgomery reduction: add multiples of modulus to clear lower limbs
+        for(size_t l_index = 0; l_index < m_size; ++l_index)
+        {
+            T l_factor = (T)((unsigned long long)l_product[l_index] * m_inverse);
+            T l_carry = limb_kernel<T>::addmul_1(l_product + l_index, l_modulus, m_size, l_factor);
+            for(size_t l_carry_index = l_index + m_size; l_carry; ++l_carry_index)
+            {
+                assert(l_carry_index <= 2 * m_size);
+                T l_sum = (T)(l_product[l_carry_index] + l_carry);
+                l_carry = l_sum < l_carry;
+                l_product[l_carry_index] = l_sum;
+            }
+        }
+
+        // Result is lower than 2 * modulus
+        T * l_high = l_product + m_size;
+        if(l_high[m_size] || limb_kernel<T>::compare(l_high, m_size, l_modulus, m_size) >= 0)
+        {
+            limb_kernel<T>::sub(p_result, l_high, m_size, l_modulus, m_size);
+        }
+        else
+        {
+            std::copy(l_high, l_high + m_size, p_result);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    modular_context<T>::reduce(T * p_result
+                              ,const ext_uint<T> & p_op
+                              ) const
+    {
+        const std::vector<T> & l_op = p_op.get_extension();
+        const std::vector<T> & l_modulus = m_modulus.get_extension();
+        if(l_op.size() < m_size || (l_op.size() == m_size && limb_kernel<T>::compare(&l_op[0], m_size, &l_modulus[0], m_size) < 0))
+        {
+            std::copy(l_op.begin(), l_op.end(), p_result);
+            std::fill(p_result + l_op.size(), p_result + m_size, (T)0);
+            return;
+        }
+        if(m_quotient.size() < l_op.size() - m_size + 1)
+        {
+            m_quotient.resize(l_op.size() - m_size + 1);
+        }
+        limb_kernel<T>::divrem(&m_quotient[0], p_result, &l_op[0], l_op.size(), &l_modulus[0], m_size);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    modular_context<T>::half_mod(T * p_op) const
+    {
+        if(p_op[0] & 1u)
+        {
+            const std::vector<T> & l_modulus = m_modulus.get_extension();
+            limb_kernel<T>::add(p_op, p_op, m_size + 1, &l_modulus[0], m_size);
+        }
+        limb_kernel<T>::rshift(p_op, p_op, m_size + 1, 1);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    modular_context<T>::sub_mod(T * p_op1
+                               ,const T * p_op2
+                               ) const
+    {
+        if(limb_kernel<T>::compare(p_op1, m_size + 1, p_op2, m_size + 1) < 0)
+        {
+            const std::vector<T> & l_modulus = m_modulus.get_extension();
+            limb_kernel<T>::add(p_op1, p_op1, m_size + 1, &l_modulus[0], m_size);
+        }
+        limb_kernel<T>::sub(p_op1, p_op1, m_size + 1, p_op2, m_size + 1);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    modular_context<T>::is_equal(const T * p_op
+                                ,size_t p_size
+                                ,T p_value
+                                )
+    {
+        if(p_op[0] != p_value)
+        {
+            return false;
+        }
+        for(size_t l_index = 1; l_index < p_size; ++l_index)
+        {
+            if(p_op[l_index])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    unsigned int
+    modular_context<T>::get_window_size(size_t p_nb_bits)
+    {
+        if(p_nb_bits > 671)
+        {
+            return 6;
+        }
+        if(p_nb_bits > 239)
+        {
+            return 5;
+        }
+        if(p_nb_bits > 79)
+        {
+            return 4;
+        }
+        if(p_nb_bits > 23)
+        {
+            return 3;
+        }
+        return p_nb_bits > 7 ? 2 : 1;
+    }
+
+#ifdef QUICKY_UTILS_SELF_TEST
+    /**
+     * Method regrouping tests of modular_context class
+     */
+    bool
+    test_modular_context();
+#endif // QUICKY_UTILS_SELF_TEST
+}
+#endif //QUICKY_UTILS_MODULAR_CONTEXT_H
+// EOF
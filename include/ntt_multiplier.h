@@ -0,0 +1,508 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+#ifndef QUICKY_UTILS_NTT_MULTIPLIER_H
+#define QUICKY_UTILS_NTT_MULTIPLIER_H
+
+#include "limb_kernel.h"
+#include "bignum_thread_pool.h"
+#include <vector>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cassert>
+
+namespace quicky_utils
+{
+    /**
+     * Multiplication of big numbers using number theoretic transforms.
+     * Operands are cut in 32 bits chunks whose cyclic convolution is computed
+     * modulo three NTT friendly primes and rebuilt with Chinese remainder
+     * theorem. Product of primes is greater than 2 ^ 85 so convolution
+     * coefficients, lower than 2 ^ 85 for transforms up to 2 ^ 21 points, are
+     * exact. Butterflies of each transform level and CRT digits are split in
+     * tasks executed by bignum_thread_pool
+     * @tparam T limb type
+     */
+    template <typename T>
+    class ntt_multiplier
+    {
+      public:
+        /**
+         * Compute p_result = p_op1 * p_op2. p_result must have
+         * p_size1 + p_size2 limbs and must not be aliased with operands
+         */
+        static
+        void mul(T * p_result
+                ,const T * p_op1
+                ,size_t p_size1
+                ,const T * p_op2
+                ,size_t p_size2
+                );
+
+        /**
+         * Indicate if NTT multiplication should be used for operands of
+         * these sizes: smaller operand must reach threshold and product must
+         * fit in biggest transform
+         * @param p_size1 number of limbs of first operand
+         * @param p_size2 number of limbs of second operand
+         * @return true if NTT multiplication should be used
+         */
+        static
+        bool is_applicable(size_t p_size1
+                          ,size_t p_size2
+                          );
+
+        /**
+         * Indicate if product of operands of these sizes fits in biggest
+         * transform
+         * @param p_size1 number of limbs of first operand
+         * @param p_size2 number of limbs of second operand
+         * @return true if product can be computed by NTT
+         */
+        static
+        bool is_supported(size_t p_size1
+                         ,size_t p_size2
+                         );
+
+        /**
+         * Define size in bits of smaller operand from which NTT
+         * multiplication is used by ext_uint
+         * @param p_nb_bits threshold in bits
+         */
+        static
+        void set_threshold(size_t p_nb_bits);
+
+        /**
+         * Threshold in bits from which NTT multiplication is used by ext_uint
+         * @return threshold in bits
+         */
+        static
+        size_t get_threshold();
+
+      private:
+        /**
+         * Number of bits of convolution chunks
+         */
+        static constexpr unsigned int m_chunk_bits = 32;
+
+        /**
+         * Maximum number of points of a transform
+         */
+        static constexpr size_t m_max_length = ((size_t)1) << 21;
+
+        /**
+         * Primes p = k * 2 ^ n + 1 and their primitive roots
+         */
+        static constexpr std::array<uint32_t, 3> m_primes = {{167772161, 469762049, 754974721}};
+        static constexpr std::array<uint32_t, 3> m_roots = {{3, 3, 11}};
+
+        static
+        uint32_t mul_mod(uint32_t p_op1
+                        ,uint32_t p_op2
+                        ,uint32_t p_prime
+                        );
+
+        static
+        uint32_t pow_mod(uint32_t p_base
+                        ,uint64_t p_exponent
+                        ,uint32_t p_prime
+                        );
+
+        /**
+         * In place iterative radix 2 transform
+         * @param p_data values to transform, size is a power of 2
+         * @param p_prime_index index of prime
+         * @param p_inverse true for inverse transform, including 1 / n scaling
+         */
+        static
+        void transform(std::vector<uint32_t> & p_data
+                      ,unsigned int p_prime_index
+                      ,bool p_inverse
+                      );
+
+        /**
+         * Cyclic convolution of chunks modulo one prime
+         * @param p_chunks1 chunks of first operand
+         * @param p_chunks2 chunks of second operand
+         * @param p_length number of points of transform
+         * @param p_prime_index index of prime
+         * @param p_result convolution modulo prime
+         */
+        static
+        void convolution(const std::vector<uint32_t> & p_chunks1
+                        ,const std::vector<uint32_t> & p_chunks2
+                        ,size_t p_length
+                        ,unsigned int p_prime_index
+                        ,std::vector<uint32_t> & p_result
+                        );
+
+        /**
+         * Cut number in chunks of m_chunk_bits bits
+         * @param p_op limbs of number
+         * @param p_size number of limbs
+         * @return chunks, least significant first
+         */
+        static
+        std::vector<uint32_t> get_chunks(const T * p_op
+                                        ,size_t p_size
+                                        );
+
+        /**
+         * Number of chunks of a number
+         * @param p_size number of limbs
+         * @return number of chunks
+         */
+        static
+        size_t get_nb_chunks(size_t p_size);
+
+        static std::atomic<size_t> m_threshold;
+    };
+
+    template <typename T>
+    constexpr std::array<uint32_t, 3> ntt_multiplier<T>::m_primes;
+
+    template <typename T>
+    constexpr std::array<uint32_t, 3> ntt_multiplier<T>::m_roots;
+
+    template <typename T>
+    std::atomic<size_t> ntt_multiplier<T>::m_threshold(3072);
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    ntt_multiplier<T>::set_threshold(size_t p_nb_bits)
+    {
+        m_threshold = p_nb_bits;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    size_t
+    ntt_multiplier<T>::get_threshold()
+    {
+        return m_threshold;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    size_t
+    ntt_multiplier<T>::get_nb_chunks(size_t p_size)
+    {
+        return (p_size * limb_kernel<T>::m_nb_bits + m_chunk_bits - 1) / m_chunk_bits;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    ntt_multiplier<T>::is_supported(size_t p_size1
+                                   ,size_t p_size2
+                                   )
+    {
+        return get_nb_chunks(p_size1) + get_nb_chunks(p_size2) <= m_max_length;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool
+    ntt_multiplier<T>::is_applicable(size_t p_size1
+                                    ,size_t p_size2
+                                    )
+    {
+        return std::min(p_size1, p_size2) * limb_kernel<T>::m_nb_bits >= m_threshold && is_supported(p_size1, p_size2);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    uint32_t
+    ntt_multiplier<T>::mul_mod(uint32_t p_op1
+                              ,uint32_t p_op2
+                              ,uint32_t p_prime
+                              )
+    {
+        return (uint32_t)(((uint64_t)p_op1 * p_op2) % p_prime);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    uint32_t
+    ntt_multiplier<T>::pow_mod(uint32_t p_base
+                              ,uint64_t p_exponent
+                              ,uint32_t p_prime
+                              )
+    {
+        uint32_t l_result = 1;
+        while(p_exponent)
+        {
+            if(p_exponent & 1)
+            {
+                l_result = mul_mod(l_result, p_base, p_prime);
+            }
+            p_base = mul_mod(p_base, p_base, p_prime);
+            p_exponent >>= 1;
+        }
+        return l_result;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    ntt_multiplier<T>::transform(std::vector<uint32_t> & p_data
+                                ,unsigned int p_prime_index
+                                ,bool p_inverse
+                                )
+    {
+        uint32_t l_prime = m_primes[p_prime_index];
+        size_t l_size = p_data.size();
+        // Bit reversal permutation
+        for(size_t l_index = 1, l_reversed = 0; l_index < l_size; ++l_index)
+        {
+            size_t l_bit = l_size >> 1;
+            for(; l_reversed & l_bit; l_bit >>= 1)
+            {
+                l_reversed ^= l_bit;
+            }
+            l_reversed ^= l_bit;
+            if(l_index < l_reversed)
+            {
+                std::swap(p_data[l_index], p_data[l_reversed]);
+            }
+        }
+        // Powers of root of unity of order l_size are computed once and
+        // stored with their Shoup quotient floor(w * 2 ^ 32 / p) so that
+        // butterflies need no division. Level of length L uses one power
+        // every l_size / L
+        size_t l_half_size = l_size / 2;
+        std::vector<uint32_t> l_twiddles(std::max(l_half_size, (size_t)1));
+        std::vector<uint32_t> l_twiddles_shoup(l_twiddles.size());
+        uint32_t l_root = pow_mod(m_roots[p_prime_index], (l_prime - 1) / l_size, l_prime);
+        if(p_inverse)
+        {
+            l_root = pow_mod(l_root, l_prime - 2, l_prime);
+        }
+        l_twiddles[0] = 1;
+        for(size_t l_index = 1; l_index < l_half_size; ++l_index)
+        {
+            l_twiddles[l_index] = mul_mod(l_twiddles[l_index - 1], l_root, l_prime);
+        }
+        for(size_t l_index = 0; l_index < l_twiddles.size(); ++l_index)
+        {
+            l_twiddles_shoup[l_index] = (uint32_t)((((uint64_t)l_twiddles[l_index]) << 32) / l_prime);
+        }
+        // Butterflies of a level are independent so they are numbered and
+        // split in ranges
+        size_t l_nb_tasks = bignum_thread_pool::get_nb_tasks(l_half_size);
+        for(unsigned int l_log_half = 0; ((size_t)2 << l_log_half) <= l_size; ++l_log_half)
+        {
+            size_t l_half = ((size_t)1) << l_log_half;
+            size_t l_stride = l_half_size >> l_log_half;
+            bignum_thread_pool::parallel_for(l_half_size, l_nb_tasks, [&](size_t p_begin, size_t p_end)
+            {
+                // Captured values are copied so that stores through data
+                // pointers cannot alias them, and range is processed block by
+                // block to keep contiguous inner loops
+                const uint32_t l_modulus = l_prime;
+                const uint32_t * l_powers = l_twiddles.data();
+                const uint32_t * l_powers_shoup = l_twiddles_shoup.data();
+                for(size_t l_butterfly = p_begin; l_butterfly < p_end;)
+                {
+                    size_t l_start = (l_butterfly >> l_log_half) << (l_log_half + 1);
+                    size_t l_index_begin = l_butterfly & (l_half - 1);
+                    size_t l_index_end = std::min(l_half, l_index_begin + p_end - l_butterfly);
+                    uint32_t * l_low = p_data.data() + l_start;
+                    uint32_t * l_high = l_low + l_half;
+                    for(size_t l_index = l_index_begin; l_index < l_index_end; ++l_index)
+                    {
+                        uint32_t l_twiddle = l_powers[l_index * l_stride];
+                        uint32_t l_twiddle_shoup = l_powers_shoup[l_index * l_stride];
+                        uint32_t l_even = l_low[l_index];
+                        uint32_t l_value = l_high[l_index];
+                        uint32_t l_quotient = (uint32_t)(((uint64_t)l_value * l_twiddle_shoup) >> 32);
+                        uint32_t l_odd = l_value * l_twiddle - l_quotient * l_modulus;
+                        l_odd = l_odd >= l_modulus ? l_odd - l_modulus : l_odd;
+                        uint32_t l_sum = l_even + l_odd;
+                        l_low[l_index] = l_sum >= l_modulus ? l_sum - l_modulus : l_sum;
+                        l_high[l_index] = l_even >= l_odd ? l_even - l_odd : l_even + l_modulus - l_odd;
+                    }
+                    l_butterfly += l_index_end - l_index_begin;
+                }
+            });
+        }
+        if(p_inverse)
+        {
+            uint32_t l_inverse_size = pow_mod((uint32_t)(l_size % l_prime), l_prime - 2, l_prime);
+            bignum_thread_pool::parallel_for(l_size, [&](size_t p_begin, size_t p_end)
+            {
+                for(size_t l_index = p_begin; l_index < p_end; ++l_index)
+                {
+                    p_data[l_index] = mul_mod(p_data[l_index], l_inverse_size, l_prime);
+                }
+            });
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    ntt_multiplier<T>::convolution(const std::vector<uint32_t> & p_chunks1
+                                  ,const std::vector<uint32_t> & p_chunks2
+                                  ,size_t p_length
+                                  ,unsigned int p_prime_index
+                                  ,std::vector<uint32_t> & p_result
+                                  )
+    {
+        uint32_t l_prime = m_primes[p_prime_index];
+        p_result.assign(p_length, 0);
+        for(size_t l_index = 0; l_index < p_chunks1.size(); ++l_index)
+        {
+            p_result[l_index] = p_chunks1[l_index] % l_prime;
+        }
+        transform(p_result, p_prime_index, false);
+        if(&p_chunks1 == &p_chunks2)
+        {
+            // Squaring needs a single forward transform
+            bignum_thread_pool::parallel_for(p_length, [&](size_t p_begin, size_t p_end)
+            {
+                for(size_t l_index = p_begin; l_index < p_end; ++l_index)
+                {
+                    p_result[l_index] = mul_mod(p_result[l_index], p_result[l_index], l_prime);
+                }
+            });
+        }
+        else
+        {
+            std::vector<uint32_t> l_op2(p_length, 0);
+            for(size_t l_index = 0; l_index < p_chunks2.size(); ++l_index)
+            {
+                l_op2[l_index] = p_chunks2[l_index] % l_prime;
+            }
+            transform(l_op2, p_prime_index, false);
+            bignum_thread_pool::parallel_for(p_length, [&](size_t p_begin, size_t p_end)
+            {
+                for(size_t l_index = p_begin; l_index < p_end; ++l_index)
+                {
+                    p_result[l_index] = mul_mod(p_result[l_index], l_op2[l_index], l_prime);
+                }
+            });
+        }
+        transform(p_result, p_prime_index, true);
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    std::vector<uint32_t>
+    ntt_multiplier<T>::get_chunks(const T * p_op
+                                 ,size_t p_size
+                                 )
+    {
+        std::vector<uint32_t> l_chunks(get_nb_chunks(p_size), 0);
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            for(unsigned int l_bit = 0; l_bit < limb_kernel<T>::m_nb_bits; l_bit += 8)
+            {
+                size_t l_position = l_index * limb_kernel<T>::m_nb_bits + l_bit;
+                uint32_t l_byte = (uint8_t)(p_op[l_index] >> l_bit);
+                l_chunks[l_position / m_chunk_bits] |= l_byte << (l_position % m_chunk_bits);
+            }
+        }
+        return l_chunks;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    void
+    ntt_multiplier<T>::mul(T * p_result
+                          ,const T * p_op1
+                          ,size_t p_size1
+                          ,const T * p_op2
+                          ,size_t p_size2
+                          )
+    {
+        assert(p_result != p_op1 && p_result != p_op2);
+        assert(is_supported(p_size1, p_size2));
+        std::vector<uint32_t> l_chunks1 = get_chunks(p_op1, p_size1);
+        std::vector<uint32_t> l_chunks2;
+        bool l_square = p_op1 == p_op2 && p_size1 == p_size2;
+        if(!l_square)
+        {
+            l_chunks2 = get_chunks(p_op2, p_size2);
+        }
+        const std::vector<uint32_t> & l_op2 = l_square ? l_chunks1 : l_chunks2;
+        size_t l_nb_coefs = l_chunks1.size() + l_op2.size() - 1;
+        size_t l_length = 1;
+        while(l_length < l_nb_coefs)
+        {
+            l_length <<= 1;
+        }
+
+        std::array<std::vector<uint32_t>, 3> l_residues;
+        for(unsigned int l_prime_index = 0; l_prime_index < 3; ++l_prime_index)
+        {
+            convolution(l_chunks1, l_op2, l_length, l_prime_index, l_residues[l_prime_index]);
+        }
+
+        // Garner digits are computed in place of residues, then
+        // reconstruction and carry propagation are done sequentially
+        typedef unsigned __int128 t_accumulator;
+        const uint32_t l_p1 = m_primes[0];
+        const uint32_t l_p2 = m_primes[1];
+        const uint32_t l_p3 = m_primes[2];
+        const uint32_t l_inv_p1_p2 = pow_mod(l_p1 % l_p2, l_p2 - 2, l_p2);
+        const uint32_t l_inv_p1_p3 = pow_mod(l_p1 % l_p3, l_p3 - 2, l_p3);
+        const uint32_t l_inv_p2_p3 = pow_mod(l_p2 % l_p3, l_p3 - 2, l_p3);
+        bignum_thread_pool::parallel_for(l_nb_coefs, [&](size_t p_begin, size_t p_end)
+        {
+            for(size_t l_index = p_begin; l_index < p_end; ++l_index)
+            {
+                uint32_t l_x1 = l_residues[0][l_index];
+                uint32_t l_x2 = mul_mod((l_residues[1][l_index] + l_p2 - l_x1 % l_p2) % l_p2, l_inv_p1_p2, l_p2);
+                uint32_t l_x3 = mul_mod((l_residues[2][l_index] + l_p3 - l_x1 % l_p3) % l_p3, l_inv_p1_p3, l_p3);
+                l_residues[1][l_index] = l_x2;
+                l_residues[2][l_index] = mul_mod((l_x3 + l_p3 - l_x2 % l_p3) % l_p3, l_inv_p2_p3, l_p3);
+            }
+        });
+        std::fill(p_result, p_result + p_size1 + p_size2, 0);
+        t_accumulator l_carry = 0;
+        size_t l_nb_result_bits = (p_size1 + p_size2) * limb_kernel<T>::m_nb_bits;
+        size_t l_nb_result_chunks = (l_nb_result_bits + m_chunk_bits - 1) / m_chunk_bits;
+        for(size_t l_index = 0; l_index < l_nb_result_chunks; ++l_index)
+        {
+            if(l_index < l_nb_coefs)
+            {
+                l_carry += l_residues[0][l_index] + (t_accumulator)l_residues[1][l_index] * l_p1 + (t_accumulator)l_residues[2][l_index] * l_p1 * l_p2;
+            }
+            uint32_t l_chunk = (uint32_t)l_carry;
+            l_carry >>= m_chunk_bits;
+            for(unsigned int l_bit = 0; l_bit < m_chunk_bits && l_index * m_chunk_bits + l_bit < l_nb_result_bits; l_bit += 8)
+            {
+                size_t l_position = l_index * m_chunk_bits + l_bit;
+                p_result[l_position / limb_kernel<T>::m_nb_bits] |= (T)((T)(uint8_t)(l_chunk >> l_bit) << (l_position % limb_kernel<T>::m_nb_bits));
+            }
+        }
+        assert(!l_carry);
+    }
+
+#ifdef QUICKY_UTILS_SELF_TEST
+    /**
+     * Method regrouping tests of ntt_multiplier class
+     */
+    bool
+    test_ntt_multiplier();
+#endif // QUICKY_UTILS_SELF_TEST
+}
+#endif //QUICKY_UTILS_NTT_MULTIPLIER_H
+// EOF
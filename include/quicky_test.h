@@ -72,6 +72,44 @@ namespace quicky_utils
         static inline
         test_verbosity_t get_verbosity();
 
+        /**
+         * Define if tests run their benchmarks on large data and report
+         * timings, otherwise benchmarks only check results on small data
+         * @param p_benchmark true to run benchmarks
+         */
+        [[maybe_unused]]
+        static inline
+        void set_benchmark(bool p_benchmark);
+
+        /**
+         * Indicate if tests run their benchmarks
+         * @return true if benchmarks are run
+         */
+        [[maybe_unused]]
+        static inline
+        bool is_benchmark();
+
+        /**
+         * Size of data processed by a benchmark
+         * @param p_test_size size used to check results only
+         * @param p_bench_size size used when benchmarks are run
+         * @return size depending on benchmark mode
+         */
+        [[maybe_unused]]
+        static inline
+        size_t get_bench_size(size_t p_test_size,
+                              size_t p_bench_size
+                             );
+
+        /**
+         * Return stream where benchmarks report timings
+         * @return default output stream when benchmarks are run, a stream
+         * discarding reports otherwise
+         */
+        [[maybe_unused]]
+        static inline
+        std::ostream & get_bench_ostream();
+
         /**
          * Provide string representation of verbosity
          * @param p_verbosity
@@ -228,6 +266,7 @@ namespace quicky_utils
         std::ostream * m_default_ostream;
         static quicky_test m_unique_instance;
         static test_verbosity_t m_verbosity;
+        static bool m_benchmark;
     };
 
     //-------------------------------------------------------------------------
@@ -437,6 +476,42 @@ namespace quicky_utils
         return m_verbosity;
     }
 
+    //-------------------------------------------------------------------------
+    [[maybe_unused]]
+    void
+    quicky_test::set_benchmark(bool p_benchmark)
+    {
+        m_benchmark = p_benchmark;
+    }
+
+    //-------------------------------------------------------------------------
+    [[maybe_unused]]
+    bool
+    quicky_test::is_benchmark()
+    {
+        return m_benchmark;
+    }
+
+    //-------------------------------------------------------------------------
+    [[maybe_unused]]
+    size_t
+    quicky_test::get_bench_size(size_t p_test_size,
+                                size_t p_bench_size
+                               )
+    {
+        return m_benchmark ? p_bench_size : p_test_size;
+    }
+
+    //-------------------------------------------------------------------------
+    [[maybe_unused]]
+    std::ostream &
+    quicky_test::get_bench_ostream()
+    {
+        // Stream without buffer is in error state so it ignores output
+        static std::ostream l_discard_stream(nullptr);
+        return m_benchmark ? *m_unique_instance.m_default_ostream : l_discard_stream;
+    }
+
     //-------------------------------------------------------------------------
     inline
     std::string
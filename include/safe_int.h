@@ -21,6 +21,10 @@
 #include "safe_type_exception.h"
 #include "type_string.h"
 #include <cstdlib>
+// Imports std::abs in global namespace before global abs overloads of this
+// file and of ext_int.h are declared, otherwise a later inclusion, like the
+// one done by x86 intrinsics headers, conflicts with them
+#include <stdlib.h>
 #include <cmath>
 #include <limits>
 #include <iostream>
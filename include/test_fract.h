@@ -18,11 +18,17 @@
 #ifndef QUICKY_UTILS_TEST_FRACT_H
 #define QUICKY_UTILS_TEST_FRACT_H
 
+#include <random>
+#include <chrono>
 #include "safe_types.h"
-#include "ext_int.h"
+#include "ext_fract.h"
 #include "fract.h"
 #include <cinttypes>
 #include <iostream>
+#include <vector>
+#include <algorithm>
+#include <sstream>
+#include <cmath>
 #include "quicky_test.h"
 
 namespace quicky_utils
@@ -410,6 +416,446 @@ namespace quicky_utils
         return l_ok;
     }
 
+    /**
+     * Check binary PGCD against Euclide algorithm used by constexpr version
+     * and compare their speed, as well as PPCM one
+     * @tparam T coefficient type
+     * @param p_nb_pairs number of random pairs
+     * @param p_generator random generator
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool bench_fract_PGCD(size_t p_nb_pairs
+                         ,std::mt19937_64 & p_generator
+                         )
+    {
+        typedef typename quicky_utils::fract<T>::t_coef_den t_coef_den;
+        typedef typename quicky_utils::fract<T> t_fract;
+        bool l_ok = true;
+        std::vector<t_coef_den> l_values(2 * p_nb_pairs);
+        for(auto & l_iter: l_values)
+        {
+            // Random sizes so that all quotient lengths are exercised
+            l_iter = (t_coef_den)((p_generator() >> (p_generator() % (8 * sizeof(t_coef_den)))) | 1u);
+        }
+        // PPCM operands are kept on half width so that their product fits
+        std::vector<t_coef_den> l_half_values(l_values.size());
+        for(size_t l_index = 0; l_index < l_values.size(); ++l_index)
+        {
+            l_half_values[l_index] = (t_coef_den)(l_values[l_index] >> (4 * sizeof(t_coef_den)) | 1u);
+        }
+        auto l_time = [&](auto p_function, const std::vector<t_coef_den> & p_values)
+        {
+            t_coef_den l_checksum = 0;
+            auto l_start = std::chrono::steady_clock::now();
+            for(size_t l_index = 0; l_index < p_nb_pairs; ++l_index)
+            {
+                l_checksum = (t_coef_den)(l_checksum ^ p_function(p_values[2 * l_index], p_values[2 * l_index + 1]));
+            }
+            auto l_duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+            return std::make_pair(l_checksum, l_duration);
+        };
+        auto l_binary = l_time([](t_coef_den p_a, t_coef_den p_b){return t_fract::PGCD(p_a, p_b);}, l_values);
+        auto l_euclide = l_time([](t_coef_den p_a, t_coef_den p_b){return t_fract::PGCD(p_a, p_b, nullptr);}, l_values);
+        auto l_binary_ppcm = l_time([](t_coef_den p_a, t_coef_den p_b){return t_fract::PPCM(p_a, p_b);}, l_half_values);
+        auto l_euclide_ppcm = l_time([](t_coef_den p_a, t_coef_den p_b){return t_fract::PPCM(p_a, p_b, nullptr);}, l_half_values);
+        std::string l_type = quicky_utils::type_string<T>::name();
+        l_ok &= quicky_test::check_expected(l_binary.first, l_euclide.first, "binary PGCD " + l_type);
+        l_ok &= quicky_test::check_expected(l_binary_ppcm.first, l_euclide_ppcm.first, "binary PPCM " + l_type);
+        bool l_pairs_ok = t_fract::PGCD((t_coef_den)0u, (t_coef_den)12u) == (t_coef_den)12u;
+        for(size_t l_index = 0; l_index < 1000; ++l_index)
+        {
+            t_coef_den l_a = l_values[2 * l_index] << (l_index % 5);
+            t_coef_den l_b = l_values[2 * l_index + 1] << (l_index % 3);
+            l_pairs_ok &= t_fract::PGCD(l_a, l_b) == t_fract::PGCD(l_a, l_b, nullptr);
+        }
+        l_ok &= quicky_test::check_expected(l_pairs_ok, true, "binary PGCD of even numbers " + l_type);
+        quicky_test::get_bench_ostream() << p_nb_pairs << " " << l_type << " pairs: PGCD binary " << l_binary.second << " us, Euclide " << l_euclide.second << " us, PPCM binary " << l_binary_ppcm.second << " us, Euclide " << l_euclide_ppcm.second << " us" << std::endl;
+        return l_ok;
+    }
+
+    /**
+     * Check cross reduced multiplication and division against reduction of
+     * products done by previous implementation, check that they no longer
+     * overflow when result is representable and compare their speed
+     * @tparam T coefficient type
+     * @param p_nb_operations number of random operations
+     * @param p_generator random generator
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool bench_fract_cross_reduction(size_t p_nb_operations
+                                    ,std::mt19937_64 & p_generator
+                                    )
+    {
+        typedef typename quicky_utils::fract<T>::t_coef_den t_coef_den;
+        typedef typename quicky_utils::fract<T>::t_coef_num t_coef_num;
+        typedef typename quicky_utils::fract<T> t_fract;
+        bool l_ok = true;
+        std::string l_type = quicky_utils::type_string<T>::name();
+
+        // Operands on a quarter of width so that products of previous
+        // implementation do not overflow
+        unsigned int l_quarter_bits = 2 * sizeof(t_coef_den);
+        std::vector<t_coef_num> l_nums(2 * p_nb_operations);
+        std::vector<t_coef_num> l_dens(2 * p_nb_operations);
+        std::vector<t_fract> l_fracts(2 * p_nb_operations);
+        for(size_t l_index = 0; l_index < l_nums.size(); ++l_index)
+        {
+            // Small common factors make cross reduction useful
+            t_coef_num l_factor = (t_coef_num)(1 + p_generator() % 6);
+            l_nums[l_index] = (t_coef_num)((t_coef_num)(p_generator() % (1u << l_quarter_bits)) * l_factor) * (p_generator() & 1 ? 1 : -1);
+            l_dens[l_index] = (t_coef_num)((t_coef_num)(1 + p_generator() % ((1u << l_quarter_bits) - 1)) * l_factor);
+            l_fracts[l_index] = t_fract(l_nums[l_index], l_dens[l_index]);
+        }
+        std::vector<t_fract> l_results(p_nb_operations);
+        std::vector<t_fract> l_references(p_nb_operations);
+        auto l_time = [&](auto p_function, std::vector<t_fract> & p_results)
+        {
+            auto l_start = std::chrono::steady_clock::now();
+            for(size_t l_index = 0; l_index < p_nb_operations; ++l_index)
+            {
+                p_results[l_index] = p_function(2 * l_index, 2 * l_index + 1);
+            }
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+        };
+        auto l_mul_time = l_time([&](size_t p_1, size_t p_2){return l_fracts[p_1] * l_fracts[p_2];}, l_results);
+        auto l_reference_mul_time = l_time([&](size_t p_1, size_t p_2){return t_fract((t_coef_num)(l_nums[p_1] * l_nums[p_2]), (t_coef_num)(l_dens[p_1] * l_dens[p_2]));}, l_references);
+        l_ok &= quicky_test::check_expected(l_results == l_references, true, "cross reduced multiplication " + l_type);
+        // Null divisors are replaced by one
+        auto l_divisor = [&](size_t p_index)
+        {
+            return l_nums[p_index] ? l_nums[p_index] : (t_coef_num)1;
+        };
+        for(size_t l_index = 1; l_index < l_fracts.size(); l_index += 2)
+        {
+            l_fracts[l_index] = t_fract(l_divisor(l_index), l_dens[l_index]);
+        }
+        auto l_div_time = l_time([&](size_t p_1, size_t p_2){return l_fracts[p_1] / l_fracts[p_2];}, l_results);
+        auto l_reference_div_time = l_time([&](size_t p_1, size_t p_2){return t_fract((t_coef_num)(l_nums[p_1] * l_dens[p_2]), (t_coef_num)(l_dens[p_1] * l_divisor(p_2)));}, l_references);
+        l_ok &= quicky_test::check_expected(l_results == l_references, true, "cross reduced division " + l_type);
+        quicky_test::get_bench_ostream() << p_nb_operations << " " << l_type << " fractions: multiplication " << l_mul_time << " us (reduction of products " << l_reference_mul_time << " us), division " << l_div_time << " us (reduction of products " << l_reference_div_time << " us)" << std::endl;
+
+        // Representable results of operands whose products overflow
+        bool l_range_ok = true;
+        unsigned int l_half_bits = 4 * sizeof(t_coef_den) - 1;
+        for(size_t l_index = 0; l_index < 1000; ++l_index)
+        {
+            t_coef_num l_num = (t_coef_num)((p_generator() >> (64 - l_half_bits)) | ((uint64_t)1 << (l_half_bits - 1)));
+            t_coef_num l_den = (t_coef_num)((p_generator() >> (64 - l_half_bits)) | ((uint64_t)1 << (l_half_bits - 1)));
+            t_fract l_fract(l_num, l_den);
+            t_fract l_inverse(l_den, l_num);
+            l_range_ok &= l_fract * l_inverse == t_fract((t_coef_num)1);
+            l_range_ok &= l_fract / l_fract == t_fract((t_coef_num)1);
+            l_range_ok &= (l_fract * t_fract((t_coef_num)-2)) / l_fract == t_fract((t_coef_num)-2);
+            l_range_ok &= (l_fract / l_inverse) * (l_inverse / l_fract) == t_fract((t_coef_num)1);
+        }
+        l_ok &= quicky_test::check_expected(l_range_ok, true, "cross reduction range " + l_type);
+        l_ok &= quicky_test::check_expected(t_fract() * t_fract((t_coef_num)3, (t_coef_num)7), t_fract(), "0 * 3/7 " + l_type);
+        l_ok &= quicky_test::check_expected(t_fract() / t_fract((t_coef_num)-3, (t_coef_num)7), t_fract(), "0 / -3/7 " + l_type);
+        l_ok &= quicky_test::check_expected(t_fract((t_coef_num)2, (t_coef_num)9) / t_fract((t_coef_num)-4, (t_coef_num)3), t_fract((t_coef_num)-1, (t_coef_num)6), "2/9 / -4/3 " + l_type);
+        return l_ok;
+    }
+
+    /**
+     * Check comparison by cross multiplication of built-in coefficients
+     * against continued fraction comparison of generic coefficients and
+     * compare sort speed of both
+     * @tparam T built-in coefficient type
+     * @tparam T_GENERIC generic coefficient type with same range
+     * @param p_nb_fracts number of random fractions
+     * @param p_generator random generator
+     * @return true if test is successfull
+     */
+    template <typename T, typename T_GENERIC>
+    bool bench_fract_compare(size_t p_nb_fracts
+                            ,std::mt19937_64 & p_generator
+                            )
+    {
+        typedef typename quicky_utils::fract<T>::t_coef_den t_coef_den;
+        typedef typename quicky_utils::fract<T>::t_coef_num t_coef_num;
+        typedef typename quicky_utils::fract<T> t_fract;
+        typedef typename quicky_utils::fract<T_GENERIC> t_generic_fract;
+        typedef typename t_generic_fract::t_coef_num t_generic_num;
+        typedef typename t_generic_fract::t_coef_den t_generic_den;
+        bool l_ok = true;
+        std::string l_type = quicky_utils::type_string<T>::name();
+        unsigned int l_bits = 8 * sizeof(t_coef_den);
+
+        std::vector<t_fract> l_fracts(p_nb_fracts);
+        std::vector<t_generic_fract> l_generic_fracts(p_nb_fracts);
+        for(size_t l_index = 0; l_index < p_nb_fracts; ++l_index)
+        {
+            t_coef_num l_num;
+            t_coef_den l_den;
+            if(l_index % 8 == 7)
+            {
+                // Ratios of consecutive Fibonacci numbers have the longest
+                // continued fraction expansions
+                t_coef_den l_previous = 1;
+                l_den = 1;
+                unsigned int l_nb_steps = 1 + (unsigned int)(p_generator() % (l_bits * 23 / 16 - 1));
+                for(unsigned int l_step = 0; l_step < l_nb_steps; ++l_step)
+                {
+                    t_coef_den l_next = (t_coef_den)(l_den + l_previous);
+                    l_previous = l_den;
+                    l_den = l_next;
+                }
+                l_num = (t_coef_num)l_previous;
+            }
+            else
+            {
+                // Random sizes so that numerators and denominators have
+                // various magnitudes
+                l_num = (t_coef_num)(p_generator() >> (65 - l_bits + p_generator() % (l_bits - 1)));
+                l_den = (t_coef_den)((p_generator() >> (64 - l_bits + p_generator() % l_bits)) | 1u);
+            }
+            l_num = p_generator() & 1 ? l_num : (t_coef_num)-l_num;
+            // Some fractions are repeated so that equality is exercised
+            l_fracts[l_index] = l_index % 16 == 15 ? l_fracts[l_index - 1] : t_fract(l_num, l_den);
+            l_generic_fracts[l_index] = l_index % 16 == 15 ? l_generic_fracts[l_index - 1] : t_generic_fract((t_generic_num)l_num, (t_generic_den)l_den);
+        }
+
+        bool l_compare_ok = true;
+        for(size_t l_index = 1; l_index < p_nb_fracts; ++l_index)
+        {
+            for(size_t l_other: {l_index - 1, l_index / 2, l_index & ~(size_t)15})
+            {
+                const t_fract & l_x = l_fracts[l_index];
+                const t_fract & l_y = l_fracts[l_other];
+                int l_result = l_x.compare(l_y);
+                l_compare_ok &= l_result == l_generic_fracts[l_index].compare(l_generic_fracts[l_other]);
+                l_compare_ok &= l_result == -l_y.compare(l_x);
+                l_compare_ok &= (l_result == 0) == (l_x == l_y);
+                l_compare_ok &= (l_x < l_y) == (l_result < 0) && (l_x <= l_y) == (l_result <= 0);
+                l_compare_ok &= (l_x > l_y) == (l_result > 0) && (l_x >= l_y) == (l_result >= 0);
+            }
+        }
+        l_ok &= quicky_test::check_expected(l_compare_ok, true, "compare " + l_type);
+
+        auto l_sort = [&](auto & p_fracts, std::vector<size_t> & p_order)
+        {
+            p_order.resize(p_fracts.size());
+            for(size_t l_index = 0; l_index < p_order.size(); ++l_index)
+            {
+                p_order[l_index] = l_index;
+            }
+            auto l_start = std::chrono::steady_clock::now();
+            std::sort(p_order.begin(), p_order.end(), [&](size_t p_1, size_t p_2){return p_fracts[p_1] < p_fracts[p_2];});
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+        };
+        std::vector<size_t> l_order;
+        std::vector<size_t> l_generic_order;
+        auto l_sort_time = l_sort(l_fracts, l_order);
+        auto l_generic_sort_time = l_sort(l_generic_fracts, l_generic_order);
+        bool l_sorted_ok = true;
+        for(size_t l_index = 1; l_index < p_nb_fracts; ++l_index)
+        {
+            l_sorted_ok &= l_fracts[l_order[l_index - 1]] <= l_fracts[l_order[l_index]];
+            l_sorted_ok &= l_generic_fracts[l_order[l_index - 1]] <= l_generic_fracts[l_order[l_index]];
+            l_sorted_ok &= l_fracts[l_generic_order[l_index - 1]] <= l_fracts[l_generic_order[l_index]];
+        }
+        l_ok &= quicky_test::check_expected(l_sorted_ok, true, "sort " + l_type);
+        l_ok &= quicky_test::check_expected(t_fract((t_coef_num)-1, (t_coef_num)3) < t_fract((t_coef_num)-1, (t_coef_num)4), true, "-1/3 < -1/4 " + l_type);
+        l_ok &= quicky_test::check_expected(t_fract(std::numeric_limits<t_coef_num>::max()).compare(t_fract(std::numeric_limits<t_coef_num>::min())), 1, "max > min " + l_type);
+        l_ok &= quicky_test::check_expected(t_fract((t_coef_num)1, std::numeric_limits<t_coef_den>::max()).compare(t_fract((t_coef_num)1, (t_coef_den)(std::numeric_limits<t_coef_den>::max() - 1u))), -1, "1/max < 1/(max - 1) " + l_type);
+        quicky_test::get_bench_ostream() << "Sort of " << p_nb_fracts << " " << l_type << " fractions: cross multiplication " << l_sort_time << " us, continued fractions on " << quicky_utils::type_string<T_GENERIC>::name() << " " << l_generic_sort_time << " us" << std::endl;
+        return l_ok;
+    }
+
+    /**
+     * Check that conversion of a fraction to double is correctly rounded by
+     * comparing exact value with double and its neighbours, for values in
+     * [2 ^ -10, 2 ^ 10] so that comparisons fit in 128 bits
+     * @param p_num numerator
+     * @param p_den denominator
+     * @param p_value converted value
+     * @return true if value is nearest double, even one in case of tie
+     */
+    inline
+    bool is_nearest_double(uint64_t p_num
+                          ,uint64_t p_den
+                          ,double p_value
+                          )
+    {
+        int l_exponent = 0;
+        double l_mantissa = std::frexp(p_value, &l_exponent);
+        // value = mantissa * 2 ^ -shift with 53 bits mantissa
+        uint64_t l_integer_mantissa = (uint64_t)std::ldexp(l_mantissa, 53);
+        int l_shift = 53 - l_exponent;
+        unsigned __int128 l_scaled_num = (unsigned __int128)p_num << l_shift;
+        unsigned __int128 l_product = (unsigned __int128)l_integer_mantissa * p_den;
+        unsigned __int128 l_error = l_scaled_num > l_product ? l_scaled_num - l_product : l_product - l_scaled_num;
+        // Error must not exceed half an ulp that is den / 2 once scaled
+        unsigned __int128 l_twice_error = 2 * l_error;
+        return l_twice_error < p_den || (l_twice_error == p_den && !(l_integer_mantissa & 1u));
+    }
+
+    /**
+     * Find closest fraction with bounded denominator by exhaustive search
+     * @param p_value value to approximate
+     * @param p_max_den maximum denominator
+     * @return closest fraction, the one with lowest denominator in case of
+     * tie
+     */
+    inline
+    fract<uint32_t> brute_force_approximation(double p_value
+                                             ,uint32_t p_max_den
+                                             )
+    {
+        typedef fract<uint32_t> t_fract;
+        long double l_best_error = std::numeric_limits<long double>::max();
+        t_fract l_best;
+        for(uint32_t l_den = 1; l_den <= p_max_den; ++l_den)
+        {
+            int32_t l_num = (int32_t)std::lround((long double)p_value * l_den);
+            long double l_error = std::fabs((long double)p_value - (long double)l_num / l_den);
+            if(l_error < l_best_error)
+            {
+                l_best_error = l_error;
+                l_best = t_fract(l_num, l_den);
+            }
+        }
+        return l_best;
+    }
+
+    /**
+     * Test and benchmark of conversions between fractions and doubles
+     * @param p_nb_values number of random values
+     * @param p_generator random generator
+     * @return true if test is successfull
+     */
+    inline
+    bool test_fract_double(size_t p_nb_values
+                          ,std::mt19937_64 & p_generator
+                          )
+    {
+        bool l_ok = true;
+        typedef fract<uint64_t> t_fract64;
+        typedef fract<uint32_t> t_fract32;
+        static_assert(t_fract64(std::numeric_limits<int64_t>::max(), std::numeric_limits<uint64_t>::max()).to_double() == 0.5, "constexpr correctly rounded to_double");
+        static_assert(t_fract64((int64_t)1, ((uint64_t)1u << 40) + 1).to_float() == 1.0f / 1099511627776.0f, "constexpr correctly rounded to_float");
+
+        // Random 64 bits fractions in [2 ^ -10, 2 ^ 10]
+        std::vector<t_fract64> l_fracts64(p_nb_values);
+        std::vector<std::pair<uint64_t, uint64_t>> l_coefs(p_nb_values);
+        for(size_t l_index = 0; l_index < p_nb_values; ++l_index)
+        {
+            uint64_t l_den = (p_generator() >> 2) | (1ull << 61);
+            uint64_t l_num = l_den >> (p_generator() % 10);
+            l_num += p_generator() % l_num;
+            t_fract64 l_fract((int64_t)l_num, l_den);
+            l_fracts64[l_index] = l_fract;
+            std::stringstream l_stream;
+            l_stream << l_fract;
+            uint64_t l_reduced_num = 0;
+            uint64_t l_reduced_den = 1;
+            char l_separator = '/';
+            l_stream >> l_reduced_num >> l_separator >> l_reduced_den;
+            l_coefs[l_index] = std::make_pair(l_reduced_num, l_reduced_den);
+        }
+        std::vector<double> l_doubles(p_nb_values);
+        auto l_start = std::chrono::steady_clock::now();
+        for(size_t l_index = 0; l_index < p_nb_values; ++l_index)
+        {
+            l_doubles[l_index] = l_fracts64[l_index].to_double();
+        }
+        auto l_rounded_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+        std::vector<double> l_plain_doubles(p_nb_values);
+        l_start = std::chrono::steady_clock::now();
+        for(size_t l_index = 0; l_index < p_nb_values; ++l_index)
+        {
+            l_plain_doubles[l_index] = (double)l_coefs[l_index].first / (double)l_coefs[l_index].second;
+        }
+        auto l_plain_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+        bool l_nearest_ok = true;
+        size_t l_nb_plain_errors = 0;
+        for(size_t l_index = 0; l_index < p_nb_values; ++l_index)
+        {
+            l_nearest_ok &= is_nearest_double(l_coefs[l_index].first, l_coefs[l_index].second, l_doubles[l_index]);
+            l_nb_plain_errors += !is_nearest_double(l_coefs[l_index].first, l_coefs[l_index].second, l_plain_doubles[l_index]);
+        }
+        l_ok &= quicky_test::check_expected(l_nearest_ok, true, "correctly rounded to_double");
+        l_ok &= quicky_test::check_expected(t_fract64((int64_t)-1, (uint64_t)3u).to_double(), -1.0 / 3, "-1/3 to double");
+        l_ok &= quicky_test::check_expected(t_fract64(std::numeric_limits<int64_t>::max(), std::numeric_limits<uint64_t>::max()).to_double(), 0.5, "(2^63 - 1) / (2^64 - 1) to double");
+        l_ok &= quicky_test::check_expected(t_fract64((int64_t)1, std::numeric_limits<uint64_t>::max()).to_double(), std::ldexp(1.0, -64), "1 / (2^64 - 1) to double");
+        l_ok &= quicky_test::check_expected(t_fract32((int32_t)16777217).to_float(), 16777216.0f, "2^24 + 1 to float");
+        l_ok &= quicky_test::check_expected(t_fract32((int32_t)16777219, (uint32_t)2u).to_float(), 8388610.0f, "(2^24 + 3) / 2 to float");
+
+        // Best rational approximations
+        const double l_pi = 3.14159265358979323846;
+        l_ok &= quicky_test::check_expected(t_fract32::from_double(l_pi, 7), t_fract32((int32_t)22, (uint32_t)7), "pi with denominator up to 7");
+        l_ok &= quicky_test::check_expected(t_fract32::from_double(l_pi, 100), t_fract32((int32_t)311, (uint32_t)99), "pi with denominator up to 100");
+        l_ok &= quicky_test::check_expected(t_fract32::from_double(l_pi, 1000), t_fract32((int32_t)355, (uint32_t)113), "pi with denominator up to 1000");
+        l_ok &= quicky_test::check_expected(t_fract32::from_double(-l_pi, 1000), t_fract32((int32_t)-355, (uint32_t)113), "-pi with denominator up to 1000");
+        l_ok &= quicky_test::check_expected(t_fract32::from_double(0.1), t_fract32((int32_t)1, (uint32_t)10), "0.1");
+        l_ok &= quicky_test::check_expected(t_fract32::from_double(0.375), t_fract32((int32_t)3, (uint32_t)8), "0.375");
+        l_ok &= quicky_test::check_expected(t_fract32::from_double(0.375, 4), t_fract32((int32_t)1, (uint32_t)3), "0.375 with denominator up to 4");
+        l_ok &= quicky_test::check_expected(t_fract32::from_double(-1e9), t_fract32((int32_t)-1000000000), "-1e9");
+        l_ok &= quicky_test::check_expected(t_fract32::from_double(1e9 + 0.4), t_fract32((int32_t)2000000001, (uint32_t)2), "1e9 + 0.4");
+        l_ok &= quicky_test::check_expected(t_fract32::from_double(2147483647.4), t_fract32(std::numeric_limits<int32_t>::max()), "2^31 - 0.6 with numerator up to 2^31 - 1");
+        l_ok &= quicky_test::check_expected(t_fract32::from_double(1e-12), t_fract32(), "1e-12");
+        l_ok &= quicky_test::check_expected(t_fract32::from_double(1e-300), t_fract32(), "1e-300");
+        l_ok &= quicky_test::check_expected(t_fract32::from_double(0.75, 1), t_fract32((int32_t)1), "0.75 with denominator up to 1");
+        l_ok &= quicky_test::check_expected(t_fract64::from_double(std::ldexp(1.0, -63)), t_fract64((int64_t)1, (uint64_t)1u << 63), "2 ^ -63");
+        l_ok &= quicky_test::check_expected(t_fract64::from_double(1.0 / 3), t_fract64((int64_t)6004799503160661, (uint64_t)18014398509481984u), "exact 1/3 double");
+        l_ok &= quicky_test::check_expected(t_fract64::from_double(1.0 / 3, 1000000), t_fract64((int64_t)1, (uint64_t)3u), "1/3 with denominator up to 10^6");
+        bool l_exception = false;
+        try
+        {
+            static_cast<void>(t_fract32::from_double(std::numeric_limits<double>::quiet_NaN()));
+        }
+        catch(const quicky_exception::quicky_logic_exception & e)
+        {
+            l_exception = true;
+        }
+        l_ok &= quicky_test::check_expected(l_exception, true, "NaN to fract");
+        l_exception = false;
+        try
+        {
+            static_cast<void>(t_fract32::from_double(4294967296.0));
+        }
+        catch(const quicky_exception::quicky_logic_exception & e)
+        {
+            l_exception = true;
+        }
+        l_ok &= quicky_test::check_expected(l_exception, true, "2^32 to fract<uint32_t>");
+
+        bool l_brute_force_ok = true;
+        for(unsigned int l_index = 0; l_index < 2000; ++l_index)
+        {
+            double l_value = std::ldexp((double)(p_generator() >> 11), -53 + (int)(p_generator() % 8)) - 4;
+            uint32_t l_max_den = 1 + (uint32_t)(p_generator() % 200);
+            l_brute_force_ok &= t_fract32::from_double(l_value, l_max_den) == brute_force_approximation(l_value, l_max_den);
+        }
+        l_ok &= quicky_test::check_expected(l_brute_force_ok, true, "best approximations");
+
+        // Round trip of fractions with 16 bits denominators whose distinct
+        // values differ by more than double precision
+        std::vector<t_fract32> l_fracts32(p_nb_values);
+        for(size_t l_index = 0; l_index < p_nb_values; ++l_index)
+        {
+            l_fracts32[l_index] = t_fract32((int32_t)(p_generator() % 2000001) - 1000000, (uint32_t)(1 + p_generator() % 65535));
+        }
+        std::vector<t_fract32> l_round_trip(p_nb_values);
+        l_start = std::chrono::steady_clock::now();
+        for(size_t l_index = 0; l_index < p_nb_values; ++l_index)
+        {
+            l_round_trip[l_index] = t_fract32::from_double(l_fracts32[l_index].to_double(), 65535);
+        }
+        auto l_round_trip_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+        l_ok &= quicky_test::check_expected(l_round_trip == l_fracts32, true, "round trip through double");
+
+        quicky_test::get_bench_ostream() << p_nb_values << " fract<uint64_t> to double: correctly rounded " << l_rounded_time << " us, plain division " << l_plain_time << " us with " << l_nb_plain_errors << " wrongly rounded. Round trip of fract<uint32_t> through double: " << l_round_trip_time << " us" << std::endl;
+        return l_ok;
+    }
+
+    /**
+     * Check fractions computed at compile time
+     * @return true if test is successfull
+     */
+    bool test_fract_constexpr();
+
     bool test_fract()
     {
         bool l_ok = true;
@@ -417,6 +863,19 @@ namespace quicky_utils
         l_ok &= test_fract_generic<uint32_t>();
         l_ok &= test_fract_generic<quicky_utils::safe_int<int32_t>>();
         l_ok &= test_fract_generic<quicky_utils::ext_int<int32_t>>();
+        l_ok &= test_fract_constexpr();
+        std::mt19937_64 l_generator(41);
+        l_ok &= bench_fract_PGCD<uint8_t>(quicky_test::get_bench_size(10000, 1000000), l_generator);
+        l_ok &= bench_fract_PGCD<uint16_t>(quicky_test::get_bench_size(10000, 1000000), l_generator);
+        l_ok &= bench_fract_PGCD<uint32_t>(quicky_test::get_bench_size(10000, 1000000), l_generator);
+        l_ok &= bench_fract_PGCD<uint64_t>(quicky_test::get_bench_size(10000, 1000000), l_generator);
+        l_ok &= bench_fract_cross_reduction<uint16_t>(quicky_test::get_bench_size(10000, 1000000), l_generator);
+        l_ok &= bench_fract_cross_reduction<uint32_t>(quicky_test::get_bench_size(10000, 1000000), l_generator);
+        l_ok &= bench_fract_cross_reduction<uint64_t>(quicky_test::get_bench_size(10000, 1000000), l_generator);
+        l_ok &= bench_fract_compare<uint16_t, quicky_utils::safe_int<int16_t>>(quicky_test::get_bench_size(10000, 1000000), l_generator);
+        l_ok &= bench_fract_compare<uint32_t, quicky_utils::safe_int<int32_t>>(quicky_test::get_bench_size(10000, 1000000), l_generator);
+        l_ok &= bench_fract_compare<uint64_t, quicky_utils::safe_int<int64_t>>(quicky_test::get_bench_size(10000, 1000000), l_generator);
+        l_ok &= test_fract_double(quicky_test::get_bench_size(10000, 1000000), l_generator);
         return l_ok;
     }
 }
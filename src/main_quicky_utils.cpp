@@ -21,7 +21,25 @@
 #include "safe_types.h"
 #include "ext_uint.h"
 #include "ext_int.h"
+#include "modular_context.h"
+#include "ext_gcd.h"
+#include "bignum_workspace.h"
+#include "ext_int_expr.h"
+#include "bignum_array.h"
+#include "fixed_uint.h"
+#include "fixed_int.h"
+#include "ntt_multiplier.h"
+#include "bignum_thread_pool.h"
+#include "ext_uint_sort.h"
+#include "ext_binary_format.h"
+#include "ext_power.h"
+#include "hybrid_int.h"
+#include "ext_fract.h"
 #include "test_fract.h"
+#include "fract_accumulator.h"
+#include "fract_array.h"
+#include "fract_verifier.h"
+#include "hybrid_fract.h"
 #include "quicky_test.h"
 #include "ansi_colors.h"
 #include "multi_thread_signal_handler.h"
@@ -29,6 +47,7 @@
 #include <iostream>
 #include <functional>
 #include <sstream>
+#include <string>
 
 #define GCC_VERSION (__GNUC__ * 10000 \
                      + __GNUC_MINOR__ * 100 \
@@ -56,13 +75,45 @@ int main(int argc,char ** argv)
         }
         quicky_test::set_ostream(l_report_file);
 
+        // Benchmarks run on large data only when requested
+        for(int l_index = 1; l_index < argc; ++l_index)
+        {
+            if(std::string("--bench") == argv[l_index])
+            {
+                quicky_test::set_benchmark(true);
+            }
+            else
+            {
+                throw quicky_exception::quicky_runtime_exception("Unknown option " + std::string(argv[l_index]) + ", usage: " + argv[0] + " [--bench]", __LINE__, __FILE__);
+            }
+        }
+
         l_ok &= test_multi_thread_signal_handler();
         l_ok &= test_quicky_bitfield();
         l_ok &= check_test_utilities();
         l_ok &= test_ext_uint();
         l_ok &= test_ext_int();
+        l_ok &= test_modular_context();
+        l_ok &= test_ext_gcd();
+        l_ok &= test_bignum_workspace();
+        l_ok &= test_ext_int_expr();
+        l_ok &= test_bignum_array();
+        l_ok &= test_fixed_uint();
+        l_ok &= test_fixed_int();
+        l_ok &= test_ntt_multiplier();
+        l_ok &= test_bignum_thread_pool();
+        l_ok &= test_ext_floating();
+        l_ok &= test_ext_uint_sort();
+        l_ok &= test_ext_binary_format();
+        l_ok &= test_ext_power();
+        l_ok &= test_hybrid_int();
         l_ok &= test_type_string();
         l_ok &= test_fract();
+        l_ok &= test_fract_accumulator();
+        l_ok &= test_fract_array();
+        l_ok &= test_fract_verifier();
+        l_ok &= test_hybrid_fract();
+        l_ok &= test_ext_fract();
         l_ok &= test_safe_types();
         test_ansi_colors();
         l_report_file.close();
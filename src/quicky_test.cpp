@@ -21,5 +21,6 @@ namespace quicky_utils
 {
     quicky_test quicky_test::m_unique_instance(std::cout);
     quicky_test::test_verbosity_t quicky_test::m_verbosity = quicky_test::test_verbosity::FAILED_ONLY;
+    bool quicky_test::m_benchmark = false;
 }
 //EOF
\ No newline at end of file
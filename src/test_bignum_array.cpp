@@ -0,0 +1,192 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include "bignum_array.h"
+#include "quicky_test.h"
+#include "type_string.h"
+#include <iostream>
+#include <chrono>
+#include <random>
+
+namespace quicky_utils
+{
+    /**
+     * Compare element wise operations of bignum_array with ext_uint ones
+     * @tparam T limb type
+     * @param p_values values used to fill operands
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool check_bignum_array(const std::vector<std::string> & p_values)
+    {
+        bool l_ok = true;
+        std::string l_type = type_string<T>::name();
+        size_t l_nb_limbs = 0;
+        std::vector<ext_uint<T>> l_values;
+        for(const auto & l_iter: p_values)
+        {
+            l_values.push_back(ext_uint<T>::from_string(l_iter));
+            l_nb_limbs = std::max(l_nb_limbs, l_values.back().get_nb_words());
+        }
+        // Each element of first operand meets each element of second one
+        size_t l_size = l_values.size() * l_values.size();
+        bignum_array<T> l_op1(l_size, l_nb_limbs);
+        bignum_array<T> l_op2(l_size, l_nb_limbs);
+        for(size_t l_index = 0; l_index < l_size; ++l_index)
+        {
+            l_op1.set(l_index, l_values[l_index / l_values.size()]);
+            l_op2.set(l_index, l_values[l_index % l_values.size()]);
+        }
+
+        bignum_array<T> l_sum(l_size, l_nb_limbs + 1);
+        bignum_array<T>::add(l_sum, l_op1, l_op2);
+        bignum_array<T> l_product(l_size, 2 * l_nb_limbs);
+        bignum_array<T>::mul(l_product, l_op1, l_op2);
+        bignum_array<T> l_difference(l_size, l_nb_limbs + 1);
+        bignum_array<T>::sub(l_difference, l_sum, l_op2);
+        std::vector<int> l_comparison;
+        bignum_array<T>::compare(l_op1, l_op2, l_comparison);
+
+        for(size_t l_index = 0; l_index < l_size; ++l_index)
+        {
+            const ext_uint<T> & l_value1 = l_values[l_index / l_values.size()];
+            const ext_uint<T> & l_value2 = l_values[l_index % l_values.size()];
+            std::string l_message = l_type + " " + l_value1.to_string() + " " + l_value2.to_string();
+            l_ok &= quicky_test::check_expected(l_op1.get(l_index), l_value1, "get " + l_message);
+            l_ok &= quicky_test::check_expected(l_sum.get(l_index), l_value1 + l_value2, "add " + l_message);
+            l_ok &= quicky_test::check_expected(l_product.get(l_index), l_value1 * l_value2, "mul " + l_message);
+            l_ok &= quicky_test::check_expected(l_difference.get(l_index), l_value1, "sub " + l_message);
+            l_ok &= quicky_test::check_expected(l_comparison[l_index], l_value1 < l_value2 ? -1 : (l_value1 == l_value2 ? 0 : 1), "compare " + l_message);
+        }
+
+        // Results wrap modulo result width and can be aliased with operands
+        bignum_array<T>::sub(l_op1, l_op1, l_op2);
+        for(size_t l_index = 0; l_index < l_size; ++l_index)
+        {
+            const ext_uint<T> & l_value1 = l_values[l_index / l_values.size()];
+            const ext_uint<T> & l_value2 = l_values[l_index % l_values.size()];
+            ext_uint<T> l_expected = l_value1 >= l_value2 ? l_value1 - l_value2 : (ext_uint<T>({1}).shl(l_nb_limbs * limb_kernel<T>::m_nb_bits) + l_value1) - l_value2;
+            l_ok &= quicky_test::check_expected(l_op1.get(l_index), l_expected, "wrapping sub " + l_type + " " + l_value1.to_string() + " " + l_value2.to_string());
+        }
+        return l_ok;
+    }
+
+    /**
+     * Report time per element of add, mul and compare of bignum_array and
+     * of std::vector<ext_uint> for 4 limbs numbers
+     * @param p_size number of elements
+     * @param p_generator random generator
+     * @return true if both containers give same results
+     */
+    bool bench_bignum_array(size_t p_size
+                           ,std::mt19937_64 & p_generator
+                           )
+    {
+        const size_t l_nb_limbs = 4;
+        bignum_array<uint32_t> l_op1(p_size, l_nb_limbs);
+        bignum_array<uint32_t> l_op2(p_size, l_nb_limbs);
+        std::vector<ext_uint<uint32_t>> l_values1(p_size);
+        std::vector<ext_uint<uint32_t>> l_values2(p_size);
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            l_values1[l_index] = ext_uint<uint32_t>({(uint32_t)p_generator(), (uint32_t)p_generator(), (uint32_t)p_generator(), (uint32_t)p_generator() | 1u});
+            l_values2[l_index] = ext_uint<uint32_t>({(uint32_t)p_generator(), (uint32_t)p_generator(), (uint32_t)p_generator(), (uint32_t)p_generator() | 1u});
+            l_op1.set(l_index, l_values1[l_index]);
+            l_op2.set(l_index, l_values2[l_index]);
+        }
+        auto l_time = [&](auto p_function)
+        {
+            auto l_start = std::chrono::steady_clock::now();
+            p_function();
+            return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - l_start).count() / (double)p_size;
+        };
+        bignum_array<uint32_t> l_sum(p_size, l_nb_limbs + 1);
+        bignum_array<uint32_t> l_product(p_size, 2 * l_nb_limbs);
+        std::vector<int> l_comparison;
+        std::vector<ext_uint<uint32_t>> l_sums(p_size);
+        std::vector<ext_uint<uint32_t>> l_products(p_size);
+        std::vector<int> l_comparisons(p_size);
+        auto l_array_add = l_time([&]{bignum_array<uint32_t>::add(l_sum, l_op1, l_op2);});
+        auto l_array_mul = l_time([&]{bignum_array<uint32_t>::mul(l_product, l_op1, l_op2);});
+        auto l_array_compare = l_time([&]{bignum_array<uint32_t>::compare(l_op1, l_op2, l_comparison);});
+        auto l_vector_add = l_time([&]
+                                   {
+                                       for(size_t l_index = 0; l_index < p_size; ++l_index)
+                                       {
+                                           l_sums[l_index] = l_values1[l_index] + l_values2[l_index];
+                                       }
+                                   }
+                                  );
+        auto l_vector_mul = l_time([&]
+                                   {
+                                       for(size_t l_index = 0; l_index < p_size; ++l_index)
+                                       {
+                                           l_products[l_index] = l_values1[l_index] * l_values2[l_index];
+                                       }
+                                   }
+                                  );
+        auto l_vector_compare = l_time([&]
+                                       {
+                                           for(size_t l_index = 0; l_index < p_size; ++l_index)
+                                           {
+                                               l_comparisons[l_index] = l_values1[l_index] < l_values2[l_index] ? -1 : (l_values1[l_index] == l_values2[l_index] ? 0 : 1);
+                                           }
+                                       }
+                                      );
+        quicky_test::get_bench_ostream() << p_size << " elements of " << l_nb_limbs << " x uint32_t limbs: add " << l_array_add << " ns/element (std::vector<ext_uint> " << l_vector_add << "), mul " << l_array_mul << " ns/element (" << l_vector_mul << "), compare " << l_array_compare << " ns/element (" << l_vector_compare << ")" << std::endl;
+        bool l_ok = true;
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            l_ok &= quicky_test::check_expected_quiet(l_sum.get(l_index), l_sums[l_index]);
+            l_ok &= quicky_test::check_expected_quiet(l_product.get(l_index), l_products[l_index]);
+            l_ok &= quicky_test::check_expected_quiet(l_comparison[l_index], l_comparisons[l_index]);
+        }
+        return quicky_test::check_expected(l_ok, true, "bench bignum_array " + std::to_string(p_size) + " elements");
+    }
+
+    //-------------------------------------------------------------------------
+    bool test_bignum_array()
+    {
+        bool l_ok = true;
+        std::cout << "Check bignum_array" << std::endl;
+        std::vector<std::string> l_values = {"0"
+                                            ,"1"
+                                            ,"255"
+                                            ,"18446744073709551615"
+                                            ,"18446744073709551616"
+                                            ,"98765432109876543210987654321"
+                                            ,"123456789012345678901234567890123456789"
+                                            ,"340282366920938463463374607431768211455"
+                                            };
+        l_ok &= check_bignum_array<uint8_t>(l_values);
+        l_ok &= check_bignum_array<uint16_t>(l_values);
+        l_ok &= check_bignum_array<uint32_t>(l_values);
+        l_ok &= check_bignum_array<uint64_t>(l_values);
+
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([]{bignum_array<uint32_t> l_array(2, 1); l_array.set(0, ext_uint<uint32_t>({0, 1}));}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([]{bignum_array<uint32_t> l_array(2, 1); bignum_array<uint32_t> l_op(3, 1); bignum_array<uint32_t>::add(l_array, l_array, l_op);}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([]{bignum_array<uint32_t> l_array(2, 2); bignum_array<uint32_t>::mul(l_array, l_array, l_array);}, true, quicky_test::auto_message(__FILE__, __LINE__));
+
+        std::mt19937_64 l_generator(32);
+        l_ok &= bench_bignum_array(quicky_test::get_bench_size(10000, 1000000), l_generator);
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF
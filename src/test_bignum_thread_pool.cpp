@@ -0,0 +1,221 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include <random>
+#include <chrono>
+#include "bignum_thread_pool.h"
+#include "ext_uint.h"
+#include "quicky_test.h"
+#include "quicky_exception.h"
+#include "type_string.h"
+#include <iostream>
+
+namespace quicky_utils
+{
+    /**
+     * Check that ranges of parallel_for cover items exactly once
+     * @param p_nb_items number of items
+     * @param p_nb_tasks number of tasks
+     * @return true if test is successfull
+     */
+    bool check_parallel_for(size_t p_nb_items
+                           ,size_t p_nb_tasks
+                           )
+    {
+        std::vector<unsigned int> l_counts(p_nb_items, 0);
+        bignum_thread_pool::parallel_for(p_nb_items, p_nb_tasks, [&](size_t p_begin, size_t p_end)
+        {
+            for(size_t l_index = p_begin; l_index < p_end; ++l_index)
+            {
+                ++l_counts[l_index];
+            }
+        });
+        return quicky_test::check_expected(std::count(l_counts.begin(), l_counts.end(), 1u) == (long)p_nb_items, true, "parallel_for coverage " + std::to_string(p_nb_items) + " items " + std::to_string(p_nb_tasks) + " tasks");
+    }
+
+    /**
+     * Random number of given number of limbs
+     * @tparam T limb type
+     * @param p_nb_limbs number of limbs
+     * @param p_generator random generator
+     * @return random number with non null upper limb
+     */
+    template <typename T>
+    ext_uint<T> random_ext_uint(size_t p_nb_limbs
+                               ,std::mt19937_64 & p_generator
+                               )
+    {
+        std::vector<T> l_limbs(p_nb_limbs);
+        for(auto & l_iter: l_limbs)
+        {
+            l_iter = (T)p_generator();
+        }
+        l_limbs.back() |= 1;
+        return ext_uint<T>::from_limbs(l_limbs.data(), l_limbs.size());
+    }
+
+    /**
+     * Check that operations give same results whatever number of threads
+     * @tparam T limb type
+     * @param p_generator random generator
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool check_parallel_operations(std::mt19937_64 & p_generator)
+    {
+        bool l_ok = true;
+        std::string l_type = type_string<T>::name();
+        ext_uint<T> l_op1 = random_ext_uint<T>(700, p_generator);
+        ext_uint<T> l_op2 = random_ext_uint<T>(300, p_generator);
+        ext_uint<T> l_op3 = random_ext_uint<T>(1, p_generator);
+
+        bignum_thread_pool::set_max_threads(1);
+        ext_uint<T> l_product = l_op1 * l_op2;
+        ext_uint<T> l_quotient = l_op1 / l_op2;
+        ext_uint<T> l_remainder = l_op1 % l_op2;
+        std::string l_string = l_op1.to_string();
+        std::string l_string_36 = l_op2.to_string(36);
+
+        // Small grain forces splitting of these moderate size operations
+        bignum_thread_pool::set_grain(8);
+        for(unsigned int l_nb_threads: {2u, 3u, 8u})
+        {
+            bignum_thread_pool::set_max_threads(l_nb_threads);
+            std::string l_message = l_type + " " + std::to_string(l_nb_threads) + " threads";
+            l_ok &= quicky_test::check_expected(l_op1 * l_op2, l_product, "parallel product " + l_message);
+            l_ok &= quicky_test::check_expected(l_op1 / l_op2, l_quotient, "parallel quotient " + l_message);
+            l_ok &= quicky_test::check_expected(l_op1 % l_op2, l_remainder, "parallel remainder " + l_message);
+            l_ok &= quicky_test::check_expected(l_quotient * l_op2 + l_remainder, l_op1, "parallel division identity " + l_message);
+            l_ok &= quicky_test::check_expected((l_op1 / l_op3) * l_op3 + l_op1 % l_op3, l_op1, "parallel single limb division " + l_message);
+            l_ok &= quicky_test::check_expected(l_op1.to_string(), l_string, "parallel to_string " + l_message);
+            l_ok &= quicky_test::check_expected(l_op2.to_string(36), l_string_36, "parallel to_string base 36 " + l_message);
+            l_ok &= quicky_test::check_expected(ext_uint<T>::from_string(l_string), l_op1, "parallel from_string " + l_message);
+            l_ok &= quicky_test::check_expected(ext_uint<T>::from_string(l_string_36, 36), l_op2, "parallel from_string base 36 " + l_message);
+            // Invalid digit is detected inside a task and reported to caller
+            std::string l_invalid = l_string;
+            l_invalid[l_invalid.size() / 3] = '#';
+            l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([&]{ext_uint<T>::from_string(l_invalid);}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        }
+        bignum_thread_pool::set_max_threads(1);
+        bignum_thread_pool::set_grain(4096);
+        return l_ok;
+    }
+
+    /**
+     * Report time of big number operations for 1 to N threads
+     * @param p_nb_limbs number of 64 bits limbs of product operands
+     * @param p_generator random generator
+     */
+    void bench_bignum_thread_pool(size_t p_nb_limbs
+                                 ,std::mt19937_64 & p_generator
+                                 )
+    {
+        ext_uint<uint64_t> l_op1 = random_ext_uint<uint64_t>(p_nb_limbs, p_generator);
+        ext_uint<uint64_t> l_op2 = random_ext_uint<uint64_t>(p_nb_limbs, p_generator);
+        ext_uint<uint64_t> l_num = random_ext_uint<uint64_t>(p_nb_limbs / 2, p_generator);
+        ext_uint<uint64_t> l_den = random_ext_uint<uint64_t>(p_nb_limbs / 4, p_generator);
+        auto l_time = [&](auto p_function)
+        {
+            auto l_start = std::chrono::steady_clock::now();
+            p_function();
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+        };
+        unsigned int l_max_threads = std::max(4u, std::thread::hardware_concurrency());
+        // Grain is lowered so that these sizes are split
+        bignum_thread_pool::set_grain(256);
+        for(unsigned int l_nb_threads = 1; l_nb_threads <= l_max_threads; l_nb_threads *= 2)
+        {
+            bignum_thread_pool::set_max_threads(l_nb_threads);
+            ext_uint<uint64_t> l_result;
+            std::string l_string;
+            auto l_mul = l_time([&]{l_result = l_op1 * l_op2;});
+            auto l_div = l_time([&]{l_result = l_num / l_den;});
+            auto l_to_string = l_time([&]{l_string = l_op1.to_string();});
+            quicky_test::get_bench_ostream() << l_nb_threads << " threads: " << 64 * p_nb_limbs << " bits product " << l_mul << " us, " << 32 * p_nb_limbs << "/" << 16 * p_nb_limbs << " bits division " << l_div << " us, " << 64 * p_nb_limbs << " bits to_string " << l_to_string << " us" << std::endl;
+        }
+        bignum_thread_pool::set_max_threads(1);
+        bignum_thread_pool::set_grain(4096);
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    test_bignum_thread_pool()
+    {
+        bool l_ok = true;
+        unsigned int l_max_threads = bignum_thread_pool::get_max_threads();
+        l_ok &= quicky_test::check_expected(l_max_threads, 1u, "default number of threads");
+        bignum_thread_pool::set_max_threads(0);
+        l_ok &= quicky_test::check_expected(bignum_thread_pool::get_max_threads() >= 1, true, "hardware number of threads");
+        bignum_thread_pool::set_max_threads(4);
+        l_ok &= check_parallel_for(0, 4);
+        l_ok &= check_parallel_for(3, 4);
+        l_ok &= check_parallel_for(1000, 4);
+        l_ok &= check_parallel_for(1001, 7);
+        bignum_thread_pool::set_grain(100);
+        l_ok &= quicky_test::check_expected(bignum_thread_pool::get_nb_tasks(50), (size_t)1, "tasks below grain");
+        l_ok &= quicky_test::check_expected(bignum_thread_pool::get_nb_tasks(250), (size_t)2, "tasks above grain");
+        l_ok &= quicky_test::check_expected(bignum_thread_pool::get_nb_tasks(100000), (size_t)4, "tasks capped by threads");
+
+        // Nested region is executed by calling task
+        std::vector<size_t> l_sums(4, 0);
+        bignum_thread_pool::parallel_for(4, 4, [&](size_t p_begin, size_t p_end)
+        {
+            for(size_t l_index = p_begin; l_index < p_end; ++l_index)
+            {
+                bignum_thread_pool::parallel_for(10, 4, [&](size_t p_inner_begin, size_t p_inner_end)
+                {
+                    for(size_t l_inner = p_inner_begin; l_inner < p_inner_end; ++l_inner)
+                    {
+                        l_sums[l_index] += l_inner;
+                    }
+                });
+            }
+        });
+        l_ok &= quicky_test::check_expected(l_sums == std::vector<size_t>(4, 45), true, "nested parallel_for");
+
+        // Exception of lowest failing task is rethrown
+        try
+        {
+            bignum_thread_pool::parallel_for(8, 8, [&](size_t p_begin, size_t)
+            {
+                if(p_begin >= 3)
+                {
+                    throw std::runtime_error(std::to_string(p_begin));
+                }
+            });
+            l_ok &= quicky_test::check_expected(false, true, "parallel_for exception");
+        }
+        catch(const std::runtime_error & p_error)
+        {
+            l_ok &= quicky_test::check_expected(std::string(p_error.what()), std::string("3"), "parallel_for exception task");
+        }
+        bignum_thread_pool::set_max_threads(l_max_threads);
+        bignum_thread_pool::set_grain(4096);
+
+        std::mt19937_64 l_generator(35);
+        l_ok &= check_parallel_operations<uint8_t>(l_generator);
+        l_ok &= check_parallel_operations<uint16_t>(l_generator);
+        l_ok &= check_parallel_operations<uint32_t>(l_generator);
+        l_ok &= check_parallel_operations<uint64_t>(l_generator);
+        bench_bignum_thread_pool(quicky_test::get_bench_size(1 << 10, 1 << 14), l_generator);
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF
@@ -0,0 +1,210 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include "bignum_workspace.h"
+#include "ext_uint.h"
+#include "ext_int.h"
+#include "quicky_test.h"
+#include "type_string.h"
+#include <iostream>
+#include <chrono>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+/**
+ * Number of calls to global operator new, used to report allocations per
+ * operation in benchmark
+ */
+static std::atomic<size_t> g_nb_new(0);
+
+//-----------------------------------------------------------------------------
+void * operator new(size_t p_size)
+{
+    g_nb_new.fetch_add(1, std::memory_order_relaxed);
+    void * l_pointer = std::malloc(p_size ? p_size : 1);
+    if(!l_pointer)
+    {
+        throw std::bad_alloc();
+    }
+    return l_pointer;
+}
+
+//-----------------------------------------------------------------------------
+void operator delete(void * p_pointer) noexcept
+{
+    std::free(p_pointer);
+}
+
+namespace quicky_utils
+{
+    //-------------------------------------------------------------------------
+    size_t
+    get_nb_heap_allocations()
+    {
+        return g_nb_new.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Check signed multiplication, division and modulo of all sign
+     * combinations of two numbers against unsigned results
+     * @tparam T signed limb type
+     * @param p_op1 magnitude of first operand
+     * @param p_op2 magnitude of second non null operand
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool check_signed_operators(const std::string & p_op1
+                               ,const std::string & p_op2
+                               )
+    {
+        typedef typename std::make_unsigned<T>::type t_limb;
+        bool l_ok = true;
+        ext_uint<t_limb> l_abs1 = ext_uint<t_limb>::from_string(p_op1);
+        ext_uint<t_limb> l_abs2 = ext_uint<t_limb>::from_string(p_op2);
+        std::string l_product = (l_abs1 * l_abs2).to_string();
+        std::string l_quotient = (l_abs1 / l_abs2).to_string();
+        std::string l_remainder = (l_abs1 % l_abs2).to_string();
+        for(unsigned int l_case = 0; l_case < 4; ++l_case)
+        {
+            bool l_negative1 = l_case & 1;
+            bool l_negative2 = l_case & 2;
+            ext_int<T> l_op1 = ext_int<T>::from_string((l_negative1 ? "-" : "") + p_op1);
+            ext_int<T> l_op2 = ext_int<T>::from_string((l_negative2 ? "-" : "") + p_op2);
+            std::string l_message = type_string<T>::name() + " " + l_op1.to_string() + " " + l_op2.to_string();
+            bool l_negative = l_negative1 != l_negative2;
+            l_ok &= quicky_test::check_expected(l_op1 * l_op2, ext_int<T>::from_string((l_negative && "0" != l_product ? "-" : "") + l_product), "* " + l_message);
+            l_ok &= quicky_test::check_expected(l_op1 / l_op2, ext_int<T>::from_string((l_negative && "0" != l_quotient ? "-" : "") + l_quotient), "/ " + l_message);
+            l_ok &= quicky_test::check_expected(l_op1 % l_op2, ext_int<T>::from_string((l_negative1 && "0" != l_remainder ? "-" : "") + l_remainder), "% " + l_message);
+        }
+        l_ok &= quicky_test::check_expected(bignum_workspace<t_limb>::get().is_idle(), true, "Idle workspace " + type_string<T>::name());
+        return l_ok;
+    }
+
+    /**
+     * Report allocations and time per operation of an operator and of its
+     * reference computation
+     * @param p_name name of operation
+     * @param p_nb_iterations number of operations
+     * @param p_operator operation relying on workspace
+     * @param p_reference same operation through ext_uint copies and
+     * division by dichotomy as done before workspace
+     * @return true if both give same result
+     */
+    template <typename T, typename OPERATOR, typename REFERENCE>
+    bool bench_bignum_workspace(const std::string & p_name
+                               ,size_t p_nb_iterations
+                               ,OPERATOR p_operator
+                               ,REFERENCE p_reference
+                               )
+    {
+        T l_result = p_operator();
+        T l_reference = p_reference();
+        auto l_measure = [&](auto p_function, T & p_result)
+        {
+            size_t l_nb_new = get_nb_heap_allocations();
+            auto l_start = std::chrono::steady_clock::now();
+            for(size_t l_index = 0; l_index < p_nb_iterations; ++l_index)
+            {
+                p_result = p_function();
+            }
+            auto l_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - l_start).count();
+            return std::make_pair((double)(get_nb_heap_allocations() - l_nb_new) / (double)p_nb_iterations, (double)l_duration / (double)p_nb_iterations);
+        };
+        auto l_operator_measure = l_measure(p_operator, l_result);
+        auto l_reference_measure = l_measure(p_reference, l_reference);
+        quicky_test::get_bench_ostream() << p_name << ": " << l_reference_measure.first << " -> " << l_operator_measure.first << " allocations/op, " << l_reference_measure.second << " -> " << l_operator_measure.second << " ns/op" << std::endl;
+        return quicky_test::check_expected(l_result, l_reference, "bench " + p_name);
+    }
+
+    //-------------------------------------------------------------------------
+    bool test_bignum_workspace()
+    {
+        bool l_ok = true;
+        std::cout << "Check bignum_workspace" << std::endl;
+
+        bignum_workspace<uint32_t> & l_workspace = bignum_workspace<uint32_t>::get();
+        l_ok &= quicky_test::check_expected(l_workspace.is_idle(), true, quicky_test::auto_message(__FILE__, __LINE__));
+        {
+            bignum_workspace<uint32_t>::buffer l_buffer1 = l_workspace.acquire(10);
+            bignum_workspace<uint32_t>::buffer l_buffer2 = l_workspace.acquire(5000);
+            bignum_workspace<uint32_t>::buffer l_buffer3 = l_workspace.acquire(3);
+            l_ok &= quicky_test::check_expected(l_buffer2.size(), (size_t)5000, quicky_test::auto_message(__FILE__, __LINE__));
+            l_ok &= quicky_test::check_expected(l_buffer1.data() + 10 <= l_buffer2.data() || l_buffer2.data() + 5000 <= l_buffer1.data(), true, quicky_test::auto_message(__FILE__, __LINE__));
+            l_ok &= quicky_test::check_expected(l_buffer2.data() + 5000 <= l_buffer3.data() || l_buffer3.data() + 3 <= l_buffer2.data(), true, quicky_test::auto_message(__FILE__, __LINE__));
+            l_ok &= quicky_test::check_expected(l_workspace.is_idle(), false, quicky_test::auto_message(__FILE__, __LINE__));
+        }
+        l_ok &= quicky_test::check_expected(l_workspace.is_idle(), true, quicky_test::auto_message(__FILE__, __LINE__));
+
+        // Once working size is reached operators no longer allocate blocks
+        ext_int<int32_t> l_op1 = ext_int<int32_t>::from_string("-123456789012345678901234567890123456789");
+        ext_int<int32_t> l_op2 = ext_int<int32_t>::from_string("98765432109876543210987654321");
+        ext_int<int32_t> l_result = l_op1 * l_op2 + l_op1 / l_op2 + l_op1 % l_op2;
+        size_t l_nb_allocations = l_workspace.get_nb_allocations();
+        for(unsigned int l_index = 0; l_index < 100; ++l_index)
+        {
+            l_ok &= quicky_test::check_expected(l_op1 * l_op2 + l_op1 / l_op2 + l_op1 % l_op2, l_result, quicky_test::auto_message(__FILE__, __LINE__));
+        }
+        l_ok &= quicky_test::check_expected(l_workspace.get_nb_allocations(), l_nb_allocations, quicky_test::auto_message(__FILE__, __LINE__));
+
+        std::string l_big = "123456789012345678901234567890123456789";
+        std::string l_medium = "98765432109876543210987654321";
+        l_ok &= check_signed_operators<int8_t>(l_big, l_medium);
+        l_ok &= check_signed_operators<int16_t>(l_medium, "65536");
+        l_ok &= check_signed_operators<int32_t>(l_big, "4294967296");
+        l_ok &= check_signed_operators<int32_t>(l_medium, l_big);
+        l_ok &= check_signed_operators<int64_t>(l_big, l_medium);
+        l_ok &= check_signed_operators<int64_t>(l_big, l_big);
+        l_ok &= check_signed_operators<int64_t>("340282366920938463463374607431768211456", "18446744073709551616");
+
+        // Operands of 39 and 29 digits, previous behaviour is reproduced
+        // with magnitudes copied in ext_uint and division by dichotomy
+        typedef ext_int<int32_t> t_int;
+        typedef ext_uint<uint32_t> t_uint;
+        ext_int<int32_t> l_op3 = -l_op2;
+        t_uint l_abs1 = t_uint(-l_op1);
+        t_uint l_abs2 = t_uint(l_op2);
+        size_t l_nb_iterations = quicky_test::get_bench_size(100, 10000);
+        t_uint l_mult;
+        l_ok &= bench_bignum_workspace<t_int>("ext_int<int32_t> mul neg*pos", l_nb_iterations
+                                             ,[&]{return l_op1 * l_op2;}
+                                             ,[&]{return -t_int(t_uint(-l_op1) * t_uint(l_op2));}
+                                             );
+        l_ok &= bench_bignum_workspace<t_int>("ext_int<int32_t> div neg/pos", l_nb_iterations
+                                             ,[&]{return l_op1 / l_op2;}
+                                             ,[&]{return -t_int(t_uint(-l_op1).div(t_uint(l_op2), false, l_mult));}
+                                             );
+        l_ok &= bench_bignum_workspace<t_int>("ext_int<int32_t> mod neg%neg", l_nb_iterations
+                                             ,[&]{return l_op1 % l_op3;}
+                                             ,[&]
+                                              {
+                                                  t_uint l_abs = t_uint(-l_op1);
+                                                  l_abs.div(t_uint(-l_op3), true, l_mult);
+                                                  return -t_int(l_abs - l_mult);
+                                              }
+                                             );
+        l_ok &= bench_bignum_workspace<t_uint>("ext_uint<uint32_t> div", l_nb_iterations
+                                              ,[&]{return l_abs1 / l_abs2;}
+                                              ,[&]{return l_abs1.div(l_abs2, false, l_mult);}
+                                              );
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF
@@ -0,0 +1,261 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include <random>
+#include <chrono>
+#include "ext_binary_format.h"
+#include "mapped_file.h"
+#include "ext_uint.h"
+#include "ext_int.h"
+#include "quicky_test.h"
+#include "quicky_exception.h"
+#include "type_string.h"
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <memory>
+
+namespace quicky_utils
+{
+    /**
+     * Copy binary data in a buffer aligned on limb size
+     * @tparam T limb type
+     * @param p_data binary data
+     * @return aligned buffer
+     */
+    template <typename T>
+    std::vector<T> align_binary_data(const std::string & p_data)
+    {
+        std::vector<T> l_buffer((p_data.size() + sizeof(T) - 1) / sizeof(T));
+        std::memcpy(l_buffer.data(), p_data.data(), p_data.size());
+        return l_buffer;
+    }
+
+    /**
+     * Check that numbers written in binary format are read back by stream
+     * reader and by view
+     * @tparam T limb type
+     * @param p_generator random generator
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool check_ext_binary_format(std::mt19937_64 & p_generator)
+    {
+        typedef typename std::make_signed<T>::type t_signed;
+        bool l_ok = true;
+        std::string l_type = type_string<T>::name();
+
+        std::vector<ext_uint<T>> l_values{ext_uint<T>(), ext_uint<T>({1}), ext_uint<T>({std::numeric_limits<T>::max()})};
+        for(unsigned int l_index = 0; l_index < 200; ++l_index)
+        {
+            // Up to 70 limbs so that varint needs two bytes
+            std::vector<T> l_limbs(1 + p_generator() % 70);
+            for(auto & l_iter: l_limbs)
+            {
+                l_iter = (T)p_generator();
+            }
+            l_values.push_back(ext_uint<T>::from_limbs(l_limbs.data(), l_limbs.size()));
+        }
+
+        std::ostringstream l_stream;
+        ext_binary_writer<T> l_writer(l_stream);
+        for(const auto & l_iter: l_values)
+        {
+            l_writer.write(l_iter);
+            l_writer.write(-ext_int<t_signed>(l_iter));
+        }
+        std::string l_data = l_stream.str();
+        l_ok &= quicky_test::check_expected(l_writer.get_nb_values(), (uint64_t)(2 * l_values.size()), "number of written values " + l_type);
+        l_ok &= quicky_test::check_expected(l_writer.get_size(), (uint64_t)l_data.size(), "written size " + l_type);
+
+        // Stream reader
+        {
+            std::istringstream l_input(l_data);
+            ext_binary_reader<T> l_reader(l_input);
+            bool l_read_ok = true;
+            for(const auto & l_iter: l_values)
+            {
+                ext_uint<T> l_value;
+                ext_int<t_signed> l_signed_value;
+                l_read_ok &= l_reader.read(l_value) && l_value == l_iter;
+                l_read_ok &= l_reader.read(l_signed_value) && l_signed_value == -ext_int<t_signed>(l_iter);
+            }
+            ext_uint<T> l_value;
+            l_read_ok &= !l_reader.read(l_value);
+            l_ok &= quicky_test::check_expected(l_read_ok, true, "stream reader " + l_type);
+        }
+
+        // Zero copy view
+        {
+            std::vector<T> l_buffer = align_binary_data<T>(l_data);
+            ext_binary_view<T> l_view(l_buffer.data(), l_data.size());
+            bool l_view_ok = true;
+            bool l_in_place = true;
+            auto l_iter = l_view.begin();
+            for(const auto & l_value: l_values)
+            {
+                l_view_ok &= l_iter != l_view.end() && !l_iter.is_negative() && *l_iter == l_value && l_iter.to_ext_uint() == l_value;
+                l_in_place &= !l_iter->get_nb_words() || (l_iter->data() >= l_buffer.data() && l_iter->data() < l_buffer.data() + l_buffer.size());
+                ++l_iter;
+                l_view_ok &= l_iter != l_view.end() && l_iter.is_negative() == (l_value != ext_uint<T>()) && *l_iter == l_value && l_iter.to_ext_int() == -ext_int<t_signed>(l_value);
+                ++l_iter;
+            }
+            l_view_ok &= l_iter == l_view.end();
+            l_ok &= quicky_test::check_expected(l_view_ok, true, "view " + l_type);
+            l_ok &= quicky_test::check_expected(l_in_place, true, "view limbs in place " + l_type);
+            l_ok &= quicky_test::check_expected((size_t)std::distance(l_view.begin(), l_view.end()), 2 * l_values.size(), "view distance " + l_type);
+        }
+
+        // Corrupted data
+        std::string l_other_limb = l_data;
+        l_other_limb[9] = (char)(sizeof(T) + 1);
+        std::vector<T> l_other_buffer = align_binary_data<T>(l_other_limb);
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_runtime_exception>([&]{ext_binary_view<T>(l_other_buffer.data(), l_other_limb.size());}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        std::string l_bad_magic = l_data;
+        l_bad_magic[0] = 'X';
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_runtime_exception>([&]{std::istringstream l_input(l_bad_magic); ext_binary_reader<T> l_reader(l_input);}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        std::string l_truncated = l_data.substr(0, l_data.size() - 1);
+        std::vector<T> l_truncated_buffer = align_binary_data<T>(l_truncated);
+        ext_binary_view<T> l_truncated_view(l_truncated_buffer.data(), l_truncated.size());
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_runtime_exception>([&]{for(auto l_iter = l_truncated_view.begin(); l_iter != l_truncated_view.end(); ++l_iter){}}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_runtime_exception>([&]{std::istringstream l_input(l_truncated); ext_binary_reader<T> l_reader(l_input); ext_uint<T> l_value; ext_int<t_signed> l_signed_value; while(l_reader.read(l_value) && l_reader.read(l_signed_value)){}}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        // Huge limb count must fail on truncated data without allocating it
+        std::string l_huge_count = l_data.substr(0, ext_binary_format<T>::m_header_size);
+        l_huge_count += std::string(7, (char)0xFF) + std::string(1, (char)0x7E);
+        l_huge_count += std::string(ext_binary_format<T>::get_padding(l_huge_count.size()), '\0') + std::string(4 * sizeof(T), (char)1);
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_runtime_exception>([&]{std::istringstream l_input(l_huge_count); ext_binary_reader<T> l_reader(l_input); ext_uint<T> l_value; l_reader.read(l_value);}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        // Non canonical varints: null last byte and bits above 64 in tenth
+        // byte, followed by a valid null number
+        std::string l_header = l_data.substr(0, ext_binary_format<T>::m_header_size);
+        std::vector<std::string> l_bad_varints = {std::string("\x80\x00", 2)
+                                                 ,std::string(9, (char)0xFF) + std::string(1, (char)0x02)
+                                                 ,std::string(9, (char)0x80) + std::string(1, (char)0x7E)
+                                                 };
+        for(const auto & l_bad_varint: l_bad_varints)
+        {
+            std::string l_bad = l_header + l_bad_varint;
+            l_bad += std::string(ext_binary_format<T>::get_padding(l_bad.size()), '\0') + std::string(1, '\0');
+            std::vector<T> l_bad_buffer = align_binary_data<T>(l_bad);
+            ext_binary_view<T> l_bad_view(l_bad_buffer.data(), l_bad.size());
+            l_ok &= quicky_test::check_exception<quicky_exception::quicky_runtime_exception>([&]{for(auto l_iter = l_bad_view.begin(); l_iter != l_bad_view.end(); ++l_iter){}}, true, quicky_test::auto_message(__FILE__, __LINE__));
+            l_ok &= quicky_test::check_exception<quicky_exception::quicky_runtime_exception>([&]{std::istringstream l_input(l_bad); ext_binary_reader<T> l_reader(l_input); ext_uint<T> l_value; while(l_reader.read(l_value)){}}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        }
+        // Largest canonical varint is accepted
+        uint64_t l_varint = 0;
+        for(unsigned int l_index = 0; l_index < 9; ++l_index)
+        {
+            ext_binary_format<T>::decode_varint_byte(l_varint, l_index, 0xFF);
+        }
+        l_ok &= quicky_test::check_expected(ext_binary_format<T>::decode_varint_byte(l_varint, 9, 0x01), false, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected(l_varint, std::numeric_limits<uint64_t>::max(), quicky_test::auto_message(__FILE__, __LINE__));
+        if(sizeof(T) > 1)
+        {
+            // First number is null: one byte varint followed by padding
+            std::string l_bad_padding = l_data;
+            l_bad_padding[ext_binary_format<T>::m_header_size + 1] = 1;
+            std::vector<T> l_bad_padding_buffer = align_binary_data<T>(l_bad_padding);
+            ext_binary_view<T> l_bad_padding_view(l_bad_padding_buffer.data(), l_bad_padding.size());
+            l_ok &= quicky_test::check_exception<quicky_exception::quicky_runtime_exception>([&]{for(auto l_iter = l_bad_padding_view.begin(); l_iter != l_bad_padding_view.end(); ++l_iter){}}, true, quicky_test::auto_message(__FILE__, __LINE__));
+            l_ok &= quicky_test::check_exception<quicky_exception::quicky_runtime_exception>([&]{std::istringstream l_input(l_bad_padding); ext_binary_reader<T> l_reader(l_input); ext_uint<T> l_value; while(l_reader.read(l_value)){}}, true, quicky_test::auto_message(__FILE__, __LINE__));
+            const char * l_misaligned = reinterpret_cast<const char *>(l_truncated_buffer.data()) + 1;
+            l_ok &= quicky_test::check_exception<quicky_exception::quicky_runtime_exception>([&]{ext_binary_view<T>(l_misaligned, l_truncated.size() - 1);}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        }
+        return l_ok;
+    }
+
+    /**
+     * Write numbers in a file, map it and iterate on its content
+     * @param p_nb_values number of numbers
+     * @param p_generator random generator
+     * @return true if test is successfull
+     */
+    bool check_mapped_ext_binary_format(size_t p_nb_values
+                                       ,std::mt19937_64 & p_generator
+                                       )
+    {
+        bool l_ok = true;
+        std::string l_file_name = "test_ext_binary_format.bin";
+        std::vector<ext_uint<uint64_t>> l_values;
+        for(size_t l_index = 0; l_index < p_nb_values; ++l_index)
+        {
+            std::vector<uint64_t> l_limbs(1 + p_generator() % 4);
+            for(auto & l_iter: l_limbs)
+            {
+                l_iter = p_generator();
+            }
+            l_values.push_back(ext_uint<uint64_t>::from_limbs(l_limbs.data(), l_limbs.size()));
+        }
+        auto l_time = [&](auto p_function)
+        {
+            auto l_start = std::chrono::steady_clock::now();
+            p_function();
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+        };
+
+        auto l_write_time = l_time([&]
+        {
+            std::ofstream l_file(l_file_name, std::ios::binary);
+            ext_binary_writer<uint64_t> l_writer(l_file);
+            for(const auto & l_iter: l_values)
+            {
+                l_writer.write(l_iter);
+            }
+        });
+        {
+            std::unique_ptr<mapped_file> l_file;
+            std::unique_ptr<ext_binary_view<uint64_t>> l_view;
+            auto l_open_time = l_time([&]
+            {
+                l_file = std::make_unique<mapped_file>(l_file_name);
+                l_view = std::make_unique<ext_binary_view<uint64_t>>(l_file->get_data(), l_file->get_size());
+            });
+            size_t l_index = 0;
+            bool l_mapped_ok = true;
+            auto l_iterate_time = l_time([&]
+            {
+                for(const auto & l_iter: *l_view)
+                {
+                    l_mapped_ok &= l_index < l_values.size() && l_iter == l_values[l_index];
+                    ++l_index;
+                }
+            });
+            l_ok &= quicky_test::check_expected(l_mapped_ok && l_index == l_values.size(), true, "mapped file content");
+            quicky_test::get_bench_ostream() << p_nb_values << " numbers of 1 to 4 limbs in " << l_file->get_size() << " bytes: write " << l_write_time << " us, map " << l_open_time << " us, iterate and compare " << l_iterate_time << " us" << std::endl;
+        }
+        std::remove(l_file_name.c_str());
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_runtime_exception>([&]{mapped_file l_file(l_file_name);}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        return l_ok;
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    test_ext_binary_format()
+    {
+        bool l_ok = true;
+        std::mt19937_64 l_generator(38);
+        l_ok &= check_ext_binary_format<uint8_t>(l_generator);
+        l_ok &= check_ext_binary_format<uint16_t>(l_generator);
+        l_ok &= check_ext_binary_format<uint32_t>(l_generator);
+        l_ok &= check_ext_binary_format<uint64_t>(l_generator);
+        l_ok &= check_mapped_ext_binary_format(quicky_test::get_bench_size(10000, 1000000), l_generator);
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF
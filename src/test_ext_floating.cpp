@@ -0,0 +1,207 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include <random>
+#include "ext_uint.h"
+#include "ext_int.h"
+#include "quicky_test.h"
+#include "quicky_exception.h"
+#include "type_string.h"
+#include <iostream>
+
+namespace quicky_utils
+{
+    /**
+     * Reference rounding to nearest, ties to even, computed with integer
+     * operations on whole number
+     * @tparam FLOATING_TYPE float or double
+     * @tparam T limb type
+     * @param p_value number to round
+     * @return rounded value
+     */
+    template <typename FLOATING_TYPE, typename T>
+    FLOATING_TYPE reference_floating(const ext_uint<T> & p_value)
+    {
+        constexpr size_t l_digits = std::numeric_limits<FLOATING_TYPE>::digits;
+        size_t l_bit_length = p_value.bit_length();
+        size_t l_shift = l_bit_length > l_digits ? l_bit_length - l_digits : 0;
+        ext_uint<T> l_kept = p_value;
+        l_kept.shr(l_shift);
+        uint64_t l_mantissa = 0;
+        for(size_t l_index = l_kept.get_nb_words(); l_index > 0;)
+        {
+            --l_index;
+            l_mantissa = (l_mantissa << (4 * sizeof(T))) << (4 * sizeof(T)) | l_kept.get_word(l_index);
+        }
+        if(l_shift && p_value.test_bit(l_shift - 1))
+        {
+            bool l_sticky = p_value.ctz() < l_shift - 1;
+            if(l_sticky || (l_mantissa & 1))
+            {
+                ++l_mantissa;
+            }
+        }
+        return std::ldexp((FLOATING_TYPE)l_mantissa, (int)std::min(l_shift, (size_t)4096));
+    }
+
+    /**
+     * Compare conversions of a number and of its opposite with reference
+     * @tparam T limb type
+     * @param p_value number to convert
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool check_floating_rounding(const ext_uint<T> & p_value)
+    {
+        typedef typename std::make_signed<T>::type signed_type;
+        bool l_ok = true;
+        std::string l_message = type_string<T>::name() + " " + p_value.to_string(16);
+        double l_double = reference_floating<double>(p_value);
+        float l_float = reference_floating<float>(p_value);
+        l_ok &= quicky_test::check_expected((double)p_value, l_double, "ext_uint to double " + l_message);
+        l_ok &= quicky_test::check_expected((float)p_value, l_float, "ext_uint to float " + l_message);
+        ext_int<signed_type> l_positive(p_value);
+        ext_int<signed_type> l_negative = -l_positive;
+        l_ok &= quicky_test::check_expected((double)l_positive, l_double, "ext_int to double " + l_message);
+        l_ok &= quicky_test::check_expected((double)l_negative, -l_double, "negative ext_int to double " + l_message);
+        l_ok &= quicky_test::check_expected((float)l_negative, -l_float, "negative ext_int to float " + l_message);
+        int64_t l_exponent;
+        double l_mantissa = p_value.to_mantissa_exp(l_exponent);
+        if(std::isfinite(l_double))
+        {
+            int l_reference_exponent;
+            double l_reference_mantissa = std::frexp(l_double, &l_reference_exponent);
+            l_ok &= quicky_test::check_expected(l_mantissa, l_reference_mantissa, "ext_uint mantissa " + l_message);
+            l_ok &= quicky_test::check_expected(l_exponent, (int64_t)l_reference_exponent, "ext_uint exponent " + l_message);
+            int64_t l_negative_exponent;
+            l_ok &= quicky_test::check_expected(l_negative.to_mantissa_exp(l_negative_exponent), -l_reference_mantissa, "ext_int mantissa " + l_message);
+            l_ok &= quicky_test::check_expected(l_negative_exponent, (int64_t)l_reference_exponent, "ext_int exponent " + l_message);
+        }
+        return l_ok;
+    }
+
+    /**
+     * Check rounding of random numbers and of numbers close to ties
+     * @tparam T limb type
+     * @param p_generator random generator
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool check_floating_conversions(std::mt19937_64 & p_generator)
+    {
+        bool l_ok = true;
+        l_ok &= check_floating_rounding(ext_uint<T>());
+        std::uniform_int_distribution<size_t> l_size_distribution(1, 160 / sizeof(T));
+        for(unsigned int l_iteration = 0; l_iteration < 200; ++l_iteration)
+        {
+            std::vector<T> l_limbs(l_size_distribution(p_generator));
+            for(auto & l_iter: l_limbs)
+            {
+                l_iter = (T)p_generator();
+            }
+            l_ok &= check_floating_rounding(ext_uint<T>::from_limbs(l_limbs.data(), l_limbs.size()));
+        }
+        // Mantissa followed by an exact half, a half with sticky bits and
+        // a value just below half, at various shifts
+        for(size_t l_shift: {1, 7, 8, 31, 64, 65, 200})
+        {
+            for(uint64_t l_mantissa: {(uint64_t)0x1FFFFFFFFFFFFF, (uint64_t)0x10000000000000, (uint64_t)0x10000000000001, (uint64_t)0xFFFFFF, (uint64_t)0xFFFFFE})
+            {
+                ext_uint<T> l_base = ext_uint<T>(l_mantissa);
+                l_base.shl(l_shift);
+                ext_uint<T> l_half = ext_uint<T>((uint32_t)1);
+                l_half.shl(l_shift - 1);
+                l_ok &= check_floating_rounding(l_base);
+                l_ok &= check_floating_rounding(l_base + l_half);
+                l_ok &= check_floating_rounding(l_base + l_half + ext_uint<T>((uint32_t)1));
+                l_ok &= check_floating_rounding(l_base + l_half - ext_uint<T>((uint32_t)1));
+            }
+        }
+        // Powers of two whose negation stops at a high limb
+        for(size_t l_shift: {0, 63, 64, 127, 128, 1000, 1023, 1024, 5000})
+        {
+            ext_uint<T> l_power = ext_uint<T>((uint32_t)1);
+            l_ok &= check_floating_rounding(l_power.shl(l_shift));
+        }
+        return l_ok;
+    }
+
+    /**
+     * Check construction of extensible integers from floating values
+     * @tparam T limb type
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool check_from_floating()
+    {
+        typedef typename std::make_signed<T>::type signed_type;
+        bool l_ok = true;
+        std::string l_type = type_string<T>::name();
+        l_ok &= quicky_test::check_expected(ext_uint<T>(0.0), ext_uint<T>(), "ext_uint from 0.0 " + l_type);
+        l_ok &= quicky_test::check_expected(ext_uint<T>(0.99), ext_uint<T>(), "ext_uint from 0.99 " + l_type);
+        l_ok &= quicky_test::check_expected(ext_uint<T>(-0.5), ext_uint<T>(), "ext_uint from -0.5 " + l_type);
+        l_ok &= quicky_test::check_expected(ext_uint<T>(1.5), ext_uint<T>((uint32_t)1), "ext_uint from 1.5 " + l_type);
+        l_ok &= quicky_test::check_expected(ext_uint<T>(1e20), ext_uint<T>::from_string("100000000000000000000"), "ext_uint from 1e20 " + l_type);
+        l_ok &= quicky_test::check_expected(ext_uint<T>(1e20f).to_string(), std::string("100000002004087734272"), "ext_uint from 1e20f " + l_type);
+        l_ok &= quicky_test::check_expected(ext_uint<T>(std::ldexp(1.0, 100)), ext_uint<T>::from_string("1267650600228229401496703205376"), "ext_uint from 2^100 " + l_type);
+        l_ok &= quicky_test::check_expected(ext_uint<T>(9007199254740993.0 * 4), ext_uint<T>::from_string("36028797018963968"), "ext_uint from rounded literal " + l_type);
+        l_ok &= quicky_test::check_expected(ext_int<signed_type>(-3.7), ext_int<signed_type>((int32_t)-3), "ext_int from -3.7 " + l_type);
+        l_ok &= quicky_test::check_expected(ext_int<signed_type>(-1e20), -ext_int<signed_type>(ext_uint<T>::from_string("100000000000000000000")), "ext_int from -1e20 " + l_type);
+        l_ok &= quicky_test::check_expected(ext_int<signed_type>(-0.0f), ext_int<signed_type>(), "ext_int from -0.0f " + l_type);
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([]{ext_uint<T> l_value(-1.0);}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([]{ext_uint<T> l_value(std::numeric_limits<double>::infinity());}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([]{ext_int<signed_type> l_value(std::numeric_limits<float>::quiet_NaN());}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        // Integral doubles survive round trip
+        for(double l_value = 1.0; std::isfinite(l_value); l_value *= -1.7)
+        {
+            std::string l_message = l_type + " " + std::to_string(l_value);
+            l_ok &= quicky_test::check_expected((double)ext_int<signed_type>(std::trunc(l_value)), std::trunc(l_value), "double round trip " + l_message);
+            l_ok &= quicky_test::check_expected((double)ext_uint<T>(std::fabs(std::trunc(l_value))), std::fabs(std::trunc(l_value)), "ext_uint double round trip " + l_message);
+        }
+        // Magnitude above floating range
+        ext_uint<T> l_huge = ext_uint<T>((uint32_t)3);
+        l_huge.shl(5000);
+        int64_t l_exponent;
+        l_ok &= quicky_test::check_expected((double)l_huge, std::numeric_limits<double>::infinity(), "ext_uint overflow " + l_type);
+        l_ok &= quicky_test::check_expected((double)-ext_int<signed_type>(l_huge), -std::numeric_limits<double>::infinity(), "ext_int overflow " + l_type);
+        l_ok &= quicky_test::check_expected(l_huge.to_mantissa_exp(l_exponent), 0.75, "huge mantissa " + l_type);
+        l_ok &= quicky_test::check_expected(l_exponent, (int64_t)5002, "huge exponent " + l_type);
+        l_ok &= quicky_test::check_expected(l_huge.template to_mantissa_exp<float>(l_exponent), 0.75f, "huge float mantissa " + l_type);
+        return l_ok;
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    test_ext_floating()
+    {
+        bool l_ok = true;
+        std::mt19937_64 l_generator(36);
+        l_ok &= check_floating_conversions<uint8_t>(l_generator);
+        l_ok &= check_floating_conversions<uint16_t>(l_generator);
+        l_ok &= check_floating_conversions<uint32_t>(l_generator);
+        l_ok &= check_floating_conversions<uint64_t>(l_generator);
+        l_ok &= check_from_floating<uint8_t>();
+        l_ok &= check_from_floating<uint16_t>();
+        l_ok &= check_from_floating<uint32_t>();
+        l_ok &= check_from_floating<uint64_t>();
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF
@@ -0,0 +1,187 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include <chrono>
+#include "ext_fract.h"
+#include "quicky_test.h"
+#include "type_string.h"
+#include <type_traits>
+
+namespace quicky_utils
+{
+    /**
+     * Rational made of numerator and denominator reduced after each
+     * operation by PGCD of plain products, as done by mpq style libraries
+     * without cross reduction
+     * @tparam T limb type
+     */
+    template <typename T>
+    struct ext_fract_baseline
+    {
+        typedef typename fract<ext_int<T>>::t_coef_num t_num;
+        typedef typename fract<ext_int<T>>::t_coef_den t_den;
+
+        ext_fract_baseline(const t_num & p_num
+                          ,const t_den & p_den
+                          )
+        :m_num(p_num)
+        ,m_den(p_den)
+        {
+            reduce();
+        }
+
+        void reduce()
+        {
+            t_den l_gcd = gcd(fract_coef_traits<ext_int<T>>::abs(m_num), m_den);
+            m_num = m_num / t_num(l_gcd);
+            m_den = m_den / l_gcd;
+        }
+
+        ext_fract_baseline operator+(const ext_fract_baseline & p_op) const
+        {
+            return ext_fract_baseline(m_num * t_num(p_op.m_den) + p_op.m_num * t_num(m_den), m_den * p_op.m_den);
+        }
+
+        ext_fract_baseline operator*(const ext_fract_baseline & p_op) const
+        {
+            return ext_fract_baseline(m_num * p_op.m_num, m_den * p_op.m_den);
+        }
+
+        bool operator==(const fract<ext_int<T>> & p_op) const
+        {
+            return fract<ext_int<T>>(m_num, m_den) == p_op;
+        }
+
+        t_num m_num;
+        t_den m_den;
+    };
+
+    /**
+     * Compute harmonic number and a telescoping product with fract and with
+     * baseline, check them and compare their speed
+     * @tparam T limb type
+     * @param p_nb_terms number of terms
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool bench_ext_fract(unsigned int p_nb_terms)
+    {
+        typedef fract<ext_int<T>> t_fract;
+        typedef typename t_fract::t_coef_num t_num;
+        typedef typename t_fract::t_coef_den t_den;
+        bool l_ok = true;
+        std::string l_type = type_string<t_fract>::name();
+        auto l_time = [&](auto p_function)
+        {
+            auto l_start = std::chrono::steady_clock::now();
+            auto l_result = p_function();
+            return std::make_pair(l_result, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count());
+        };
+
+        // Harmonic number H(n) = sum of 1 / k
+        auto l_harmonic = l_time([&]
+        {
+            t_fract l_sum;
+            for(unsigned int l_index = 1; l_index <= p_nb_terms; ++l_index)
+            {
+                l_sum += t_fract(t_num((int64_t)1), t_den((uint64_t)l_index));
+            }
+            return l_sum;
+        });
+        auto l_harmonic_baseline = l_time([&]
+        {
+            ext_fract_baseline<T> l_sum(t_num((int64_t)0), t_den((uint64_t)1));
+            for(unsigned int l_index = 1; l_index <= p_nb_terms; ++l_index)
+            {
+                l_sum = l_sum + ext_fract_baseline<T>(t_num((int64_t)1), t_den((uint64_t)l_index));
+            }
+            return l_sum;
+        });
+        l_ok &= quicky_test::check_expected(l_harmonic_baseline.first == l_harmonic.first, true, "harmonic number " + l_type);
+
+        // Product of (1 - 1 / k^2) for k in [2, n] = (n + 1) / (2 * n)
+        auto l_product = l_time([&]
+        {
+            t_fract l_product(t_num((int64_t)1));
+            for(unsigned int l_index = 2; l_index <= p_nb_terms; ++l_index)
+            {
+                uint64_t l_square = (uint64_t)l_index * l_index;
+                l_product *= t_fract(t_num((int64_t)(l_square - 1)), t_den(l_square));
+            }
+            return l_product;
+        });
+        auto l_product_baseline = l_time([&]
+        {
+            ext_fract_baseline<T> l_product(t_num((int64_t)1), t_den((uint64_t)1));
+            for(unsigned int l_index = 2; l_index <= p_nb_terms; ++l_index)
+            {
+                uint64_t l_square = (uint64_t)l_index * l_index;
+                l_product = l_product * ext_fract_baseline<T>(t_num((int64_t)(l_square - 1)), t_den(l_square));
+            }
+            return l_product;
+        });
+        l_ok &= quicky_test::check_expected(l_product.first, t_fract(t_num((int64_t)p_nb_terms + 1), t_den(2 * (uint64_t)p_nb_terms)), "telescoping product " + l_type);
+        l_ok &= quicky_test::check_expected(l_product_baseline.first == l_product.first, true, "telescoping product baseline " + l_type);
+
+        quicky_test::get_bench_ostream() << l_type << " H(" << p_nb_terms << "): fract " << l_harmonic.second << " us, baseline " << l_harmonic_baseline.second << " us. Telescoping product: fract " << l_product.second << " us, baseline " << l_product_baseline.second << " us" << std::endl;
+        return l_ok;
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    test_ext_fract()
+    {
+        bool l_ok = true;
+        typedef fract<ext_int<int32_t>> t_fract;
+        typedef t_fract::t_coef_num t_num;
+        typedef t_fract::t_coef_den t_den;
+        static_assert(std::is_nothrow_move_constructible<t_fract>::value, "fract must be moved without copy");
+
+        // H(30) = 9304682830147 / 2329089562800
+        t_fract l_sum;
+        std::vector<t_fract> l_partial_sums;
+        for(unsigned int l_index = 1; l_index <= 30; ++l_index)
+        {
+            l_sum += t_fract(t_num((int64_t)1), t_den((uint64_t)l_index));
+            l_partial_sums.push_back(l_sum);
+        }
+        l_ok &= quicky_test::check_expected(l_sum, t_fract(t_num((int64_t)9304682830147), t_den((uint64_t)2329089562800)), "H(30)");
+        bool l_order_ok = true;
+        for(size_t l_index = 1; l_index < l_partial_sums.size(); ++l_index)
+        {
+            l_order_ok &= l_partial_sums[l_index - 1] < l_partial_sums[l_index] && -l_partial_sums[l_index] < -l_partial_sums[l_index - 1];
+            l_order_ok &= l_partial_sums[l_index].compare(l_partial_sums[l_index]) == 0;
+        }
+        l_ok &= quicky_test::check_expected(l_order_ok, true, "order of harmonic numbers");
+        l_ok &= quicky_test::check_expected(l_sum - l_sum, t_fract(), "H(30) - H(30)");
+        l_ok &= quicky_test::check_expected(l_sum / l_sum, t_fract(t_num((int64_t)1)), "H(30) / H(30)");
+        l_ok &= quicky_test::check_expected((-l_sum).abs(), l_sum, "abs(-H(30))");
+
+        // Moved fraction keeps its value
+        t_fract l_moved(std::move(l_sum));
+        l_ok &= quicky_test::check_expected(l_moved, l_partial_sums.back(), "moved H(30)");
+
+        unsigned int l_nb_terms = (unsigned int)quicky_test::get_bench_size(200, 2000);
+        l_ok &= bench_ext_fract<int32_t>(l_nb_terms);
+        l_ok &= bench_ext_fract<int64_t>(l_nb_terms);
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF
@@ -0,0 +1,192 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include "ext_gcd.h"
+#include "quicky_test.h"
+#include "type_string.h"
+#include <iostream>
+#include <chrono>
+#include <random>
+
+namespace quicky_utils
+{
+    /**
+     * Check gcd, lcm and extended_gcd of two numbers sharing a known factor
+     * @tparam T limb type
+     * @param p_op1 first operand divided by common factor
+     * @param p_op2 second operand divided by common factor
+     * @param p_factor common factor
+     * @param p_coprime true if p_op1 and p_op2 are coprime
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool check_gcd(const std::string & p_op1
+                  ,const std::string & p_op2
+                  ,const std::string & p_factor
+                  ,bool p_coprime
+                  )
+    {
+        typedef ext_int<typename std::make_signed<T>::type> t_coef;
+        bool l_ok = true;
+        ext_uint<T> l_factor = ext_uint<T>::from_string(p_factor);
+        ext_uint<T> l_op1 = ext_uint<T>::from_string(p_op1) * l_factor;
+        ext_uint<T> l_op2 = ext_uint<T>::from_string(p_op2) * l_factor;
+        std::string l_message = type_string<T>::name() + " (" + p_op1 + ", " + p_op2 + ") * " + p_factor;
+
+        ext_uint<T> l_gcd = gcd(l_op1, l_op2);
+        ext_uint<T> l_quotient;
+        ext_uint<T> l_remainder;
+        ext_uint<T>::divrem(l_gcd, l_factor, l_quotient, l_remainder);
+        l_ok &= quicky_test::check_expected(l_remainder, ext_uint<T>(), "gcd multiple of factor " + l_message);
+        if(p_coprime)
+        {
+            l_ok &= quicky_test::check_expected(l_gcd, l_factor, "gcd " + l_message);
+        }
+        l_ok &= quicky_test::check_expected(gcd(l_op2, l_op1), l_gcd, "gcd symmetry " + l_message);
+
+        t_coef l_coef1;
+        t_coef l_coef2;
+        l_ok &= quicky_test::check_expected(extended_gcd(l_op1, l_op2, l_coef1, l_coef2), l_gcd, "extended_gcd " + l_message);
+        l_ok &= quicky_test::check_expected(l_coef1 * t_coef(l_op1) + l_coef2 * t_coef(l_op2), t_coef(l_gcd), "Bezout identity " + l_message);
+
+        ext_uint<T> l_lcm = lcm(l_op1, l_op2);
+        l_ok &= quicky_test::check_expected(l_lcm * l_gcd, l_op1 * l_op2, "lcm " + l_message);
+
+        t_coef l_signed1 = -t_coef(l_op1);
+        t_coef l_signed2 = t_coef(l_op2);
+        l_ok &= quicky_test::check_expected(gcd(l_signed1, l_signed2), t_coef(l_gcd), "signed gcd " + l_message);
+        l_ok &= quicky_test::check_expected(lcm(l_signed1, l_signed2), t_coef(l_lcm), "signed lcm " + l_message);
+        l_ok &= quicky_test::check_expected(extended_gcd(l_signed1, l_signed2, l_coef1, l_coef2), t_coef(l_gcd), "signed extended_gcd " + l_message);
+        l_ok &= quicky_test::check_expected(l_coef1 * l_signed1 + l_coef2 * l_signed2, t_coef(l_gcd), "signed Bezout identity " + l_message);
+        return l_ok;
+    }
+
+    //-------------------------------------------------------------------------
+    template <typename T>
+    bool check_gcd_type()
+    {
+        bool l_ok = true;
+        // Consecutive Fibonacci numbers are coprime and maximize Euclid steps
+        std::string l_fib1 = "280571172992510140037611932413038677189525";
+        std::string l_fib2 = "453973694165307953197296969697410619233826";
+        std::string l_big1 = "1";
+        std::string l_big2 = "9";
+        for(unsigned int l_index = 0; l_index < 150; ++l_index)
+        {
+            l_big1.push_back((char)('0' + (l_index * 7 + 3) % 10));
+            l_big2.push_back((char)('0' + (l_index * 3 + 1) % 10));
+        }
+        l_ok &= check_gcd<T>("0", "0", "1", false);
+        l_ok &= check_gcd<T>("0", "12", "1", false);
+        l_ok &= check_gcd<T>("12", "0", "1", false);
+        l_ok &= check_gcd<T>("1", "1", "1", true);
+        l_ok &= check_gcd<T>("12", "18", "1", false);
+        l_ok &= check_gcd<T>("7", "5", "1024", true);
+        l_ok &= check_gcd<T>("4294967291", "65537", "257", true);
+        l_ok &= check_gcd<T>(l_fib1, l_fib2, "1", true);
+        l_ok &= check_gcd<T>(l_fib2, l_fib1, "98765432109876543210", true);
+        l_ok &= check_gcd<T>(l_big1, l_big2, "123456789123456789123456789", false);
+        l_ok &= check_gcd<T>(l_big1, "3", l_fib1, false);
+        l_ok &= check_gcd<T>(l_big1 + l_big2, l_big2, "18446744073709551615", false);
+        return l_ok;
+    }
+
+    /**
+     * Report time of gcd and extended_gcd against Euclid algorithm using
+     * ext_uint operators for operands of a given size
+     * @param p_nb_bits size in bits of operands before multiplication by
+     * a 64 bits common factor
+     * @param p_generator random generator
+     * @return true if gcd and Euclid algorithm give same result
+     */
+    bool bench_ext_gcd(size_t p_nb_bits
+                      ,std::mt19937_64 & p_generator
+                      )
+    {
+        std::vector<uint64_t> l_limbs(p_nb_bits / 64);
+        auto l_random = [&]()
+        {
+            for(auto & l_iter: l_limbs)
+            {
+                l_iter = p_generator();
+            }
+            l_limbs.back() |= ((uint64_t)1) << 63;
+            return ext_uint<uint64_t>::from_limbs(l_limbs.data(), l_limbs.size());
+        };
+        // Common factor makes result different from 1
+        ext_uint<uint64_t> l_factor({p_generator() | 1});
+        ext_uint<uint64_t> l_op1 = l_random() * l_factor;
+        ext_uint<uint64_t> l_op2 = l_random() * l_factor;
+        auto l_time = [&](auto p_function)
+        {
+            auto l_start = std::chrono::steady_clock::now();
+            p_function();
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+        };
+        ext_uint<uint64_t> l_gcd;
+        ext_uint<uint64_t> l_extended_gcd;
+        ext_uint<uint64_t> l_euclid;
+        ext_int<int64_t> l_coef1;
+        ext_int<int64_t> l_coef2;
+        auto l_gcd_time = l_time([&]{l_gcd = gcd(l_op1, l_op2);});
+        auto l_extended_gcd_time = l_time([&]{l_extended_gcd = extended_gcd(l_op1, l_op2, l_coef1, l_coef2);});
+        auto l_euclid_time = l_time([&]
+                                    {
+                                        ext_uint<uint64_t> l_a = l_op1;
+                                        ext_uint<uint64_t> l_b = l_op2;
+                                        while(l_b != ext_uint<uint64_t>())
+                                        {
+                                            ext_uint<uint64_t> l_remainder = l_a % l_b;
+                                            l_a = std::move(l_b);
+                                            l_b = std::move(l_remainder);
+                                        }
+                                        l_euclid = l_a;
+                                    }
+                                   );
+        quicky_test::get_bench_ostream() << l_op1.bit_length() << " bits gcd: " << (l_op1.get_nb_words() <= 2 ? "binary " : "Lehmer ") << l_gcd_time << " us, extended " << l_extended_gcd_time << " us, Euclid with ext_uint operators " << l_euclid_time << " us" << std::endl;
+        bool l_ok = quicky_test::check_expected(l_gcd, l_euclid, "bench gcd " + std::to_string(p_nb_bits) + " bits");
+        l_ok &= quicky_test::check_expected(l_extended_gcd, l_euclid, "bench extended_gcd " + std::to_string(p_nb_bits) + " bits");
+        return l_ok;
+    }
+
+    //-------------------------------------------------------------------------
+    bool test_ext_gcd()
+    {
+        bool l_ok = true;
+        std::cout << "Check gcd/lcm/extended_gcd" << std::endl;
+        l_ok &= check_gcd_type<uint8_t>();
+        l_ok &= check_gcd_type<uint16_t>();
+        l_ok &= check_gcd_type<uint32_t>();
+        l_ok &= check_gcd_type<uint64_t>();
+        l_ok &= quicky_test::check_expected(gcd_kernel<uint32_t>::binary_gcd(0xC0000000ull * 6, 0xC0000000ull * 9), (uint64_t)0xC0000000ull * 3, quicky_test::auto_message(__FILE__, __LINE__));
+
+        std::mt19937_64 l_generator(29);
+        for(size_t l_nb_bits: {64, 1024, 4096, 16384, 65536})
+        {
+            if(l_nb_bits > quicky_test::get_bench_size(1024, 65536))
+            {
+                break;
+            }
+            l_ok &= bench_ext_gcd(l_nb_bits, l_generator);
+        }
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF
@@ -0,0 +1,158 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include "ext_int_expr.h"
+#include "quicky_test.h"
+#include "type_string.h"
+#include <iostream>
+#include <chrono>
+
+namespace quicky_utils
+{
+    /**
+     * Compare lazy evaluation of multiply-accumulate expressions with
+     * eager operators
+     * @tparam T ext_int base type
+     * @param p_a first operand
+     * @param p_b second operand
+     * @param p_c third operand
+     * @param p_d fourth operand
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool check_ext_int_expr(const std::string & p_a
+                           ,const std::string & p_b
+                           ,const std::string & p_c
+                           ,const std::string & p_d
+                           )
+    {
+        bool l_ok = true;
+        ext_int<T> l_a = ext_int<T>::from_string(p_a);
+        ext_int<T> l_b = ext_int<T>::from_string(p_b);
+        ext_int<T> l_c = ext_int<T>::from_string(p_c);
+        ext_int<T> l_d = ext_int<T>::from_string(p_d);
+        std::string l_message = type_string<T>::name() + " " + p_a + " " + p_b + " " + p_c + " " + p_d;
+
+        ext_int<T> l_result;
+        l_result = lazy(l_a) * l_b + lazy(l_c) * l_d - l_a;
+        l_ok &= quicky_test::check_expected(l_result, l_a * l_b + l_c * l_d - l_a, "a * b + c * d - a " + l_message);
+        l_result = l_d - lazy(l_a) * lazy(l_c) - l_b;
+        l_ok &= quicky_test::check_expected(l_result, l_d - l_a * l_c - l_b, "d - a * c - b " + l_message);
+        l_result = -(lazy(l_b) * l_b) + l_c;
+        l_ok &= quicky_test::check_expected(l_result, l_c - l_b * l_b, "-(b * b) + c " + l_message);
+        l_result = lazy(l_a) * l_b - lazy(l_a) * l_b;
+        l_ok &= quicky_test::check_expected(l_result, ext_int<T>(), "a * b - a * b " + l_message);
+        l_result = lazy(l_a) + l_b + l_c + l_d;
+        l_ok &= quicky_test::check_expected(l_result, l_a + l_b + l_c + l_d, "a + b + c + d " + l_message);
+
+        // Destination used as operand
+        ext_int<T> l_reference = l_a * l_a + l_b * l_c;
+        l_a = lazy(l_a) * l_a + lazy(l_b) * l_c;
+        l_ok &= quicky_test::check_expected(l_a, l_reference, "a = a * a + b * c " + l_message);
+        return l_ok;
+    }
+
+    /**
+     * Report heap allocations and time of Horner evaluation of a degree 7
+     * polynomial with lazy expressions and with eager operators
+     * @param p_nb_iterations number of evaluations
+     * @return true if both evaluations give same result
+     */
+    bool bench_ext_int_expr(size_t p_nb_iterations)
+    {
+        ext_int<int32_t> l_x = ext_int<int32_t>::from_string("-98765432109876543210987654321");
+        const ext_int<int32_t> l_coefs[] = {ext_int<int32_t>(3), ext_int<int32_t>(-5), ext_int<int32_t>(7), ext_int<int32_t>(-11)
+                                           ,ext_int<int32_t>(13), ext_int<int32_t>(-17), ext_int<int32_t>(19), ext_int<int32_t>(-23)
+                                           };
+        ext_int<int32_t> l_lazy;
+        ext_int<int32_t> l_eager;
+        auto l_measure = [&](auto p_function)
+        {
+            // First evaluation sizes workspace and destination
+            p_function();
+            size_t l_nb_allocations = get_nb_heap_allocations();
+            auto l_start = std::chrono::steady_clock::now();
+            for(size_t l_iteration = 0; l_iteration < p_nb_iterations; ++l_iteration)
+            {
+                p_function();
+            }
+            auto l_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - l_start).count();
+            return std::make_pair((double)(get_nb_heap_allocations() - l_nb_allocations) / (double)p_nb_iterations, (double)l_duration / (double)p_nb_iterations);
+        };
+        auto l_lazy_measure = l_measure([&]
+                                        {
+                                            l_lazy = l_coefs[0];
+                                            for(unsigned int l_index = 1; l_index < 8; ++l_index)
+                                            {
+                                                l_lazy = lazy(l_lazy) * l_x + l_coefs[l_index];
+                                            }
+                                        }
+                                       );
+        auto l_eager_measure = l_measure([&]
+                                         {
+                                             l_eager = l_coefs[0];
+                                             for(unsigned int l_index = 1; l_index < 8; ++l_index)
+                                             {
+                                                 l_eager = l_eager * l_x + l_coefs[l_index];
+                                             }
+                                         }
+                                        );
+        quicky_test::get_bench_ostream() << "Horner degree 7 on 29 digits ext_int<int32_t>: eager " << l_eager_measure.first << " allocations " << l_eager_measure.second << " ns, lazy " << l_lazy_measure.first << " allocations " << l_lazy_measure.second << " ns" << std::endl;
+        return quicky_test::check_expected(l_lazy, l_eager, "bench Horner evaluation");
+    }
+
+    //-------------------------------------------------------------------------
+    bool test_ext_int_expr()
+    {
+        bool l_ok = true;
+        std::cout << "Check ext_int_expr" << std::endl;
+        std::string l_big = "123456789012345678901234567890123456789";
+        std::string l_medium = "-98765432109876543210987654321";
+        l_ok &= check_ext_int_expr<int8_t>("0", "-1", "127", "-128");
+        l_ok &= check_ext_int_expr<int8_t>(l_big, l_medium, "-" + l_big, "255");
+        l_ok &= check_ext_int_expr<int16_t>(l_medium, l_medium, l_big, "-65536");
+        l_ok &= check_ext_int_expr<int32_t>(l_big, "-4294967296", l_medium, "0");
+        l_ok &= check_ext_int_expr<int32_t>("-2147483648", "-2147483648", "2147483647", l_big);
+        l_ok &= check_ext_int_expr<int64_t>(l_big, l_medium, l_medium, l_big);
+        l_ok &= check_ext_int_expr<int64_t>("-9223372036854775808", "9223372036854775807", "-1", "-9223372036854775808");
+
+        // Horner evaluation of 3 x^3 - 5 x^2 + 7 x - 11 reuses destination
+        ext_int<int32_t> l_x = ext_int<int32_t>::from_string(l_medium);
+        const ext_int<int32_t> l_coefs[] = {ext_int<int32_t>(3), ext_int<int32_t>(-5), ext_int<int32_t>(7), ext_int<int32_t>(-11)};
+        ext_int<int32_t> l_result;
+        size_t l_nb_allocations = 0;
+        for(unsigned int l_iteration = 0; l_iteration < 2; ++l_iteration)
+        {
+            l_nb_allocations = bignum_workspace<uint32_t>::get().get_nb_allocations();
+            l_result = l_coefs[0];
+            for(unsigned int l_index = 1; l_index < 4; ++l_index)
+            {
+                l_result = lazy(l_result) * l_x + l_coefs[l_index];
+            }
+        }
+        l_ok &= quicky_test::check_expected(bignum_workspace<uint32_t>::get().get_nb_allocations(), l_nb_allocations, quicky_test::auto_message(__FILE__, __LINE__));
+        ext_int<int32_t> l_reference = ((l_coefs[0] * l_x + l_coefs[1]) * l_x + l_coefs[2]) * l_x + l_coefs[3];
+        l_ok &= quicky_test::check_expected(l_result, l_reference, quicky_test::auto_message(__FILE__, __LINE__));
+
+        l_ok &= bench_ext_int_expr(quicky_test::get_bench_size(100, 1000000));
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF
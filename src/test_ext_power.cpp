@@ -0,0 +1,256 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include <random>
+#include <chrono>
+#include "ext_power.h"
+#include "limb_kernel.h"
+#include "quicky_test.h"
+#include "quicky_exception.h"
+#include "type_string.h"
+
+namespace quicky_utils
+{
+    /**
+     * Random number
+     * @tparam T limb type
+     * @param p_nb_limbs number of limbs
+     * @param p_generator random generator
+     * @return number whose most significant limb is not null
+     */
+    template <typename T>
+    ext_uint<T> random_power_operand(size_t p_nb_limbs
+                                    ,std::mt19937_64 & p_generator
+                                    )
+    {
+        std::vector<T> l_limbs(p_nb_limbs);
+        for(auto & l_iter: l_limbs)
+        {
+            l_iter = (T)p_generator();
+        }
+        l_limbs.back() |= (T)1;
+        return ext_uint<T>::from_limbs(l_limbs.data(), l_limbs.size());
+    }
+
+    /**
+     * Check squaring, powers, roots and perfect power detection
+     * @tparam T limb type
+     * @param p_generator random generator
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool check_ext_power(std::mt19937_64 & p_generator)
+    {
+        typedef typename std::make_signed<T>::type t_signed;
+        bool l_ok = true;
+        std::string l_type = type_string<T>::name();
+        ext_uint<T> l_one({1});
+
+        // Squaring against multiplication
+        bool l_sqr_ok = true;
+        for(size_t l_size = 1; l_size < 60; ++l_size)
+        {
+            ext_uint<T> l_op = random_power_operand<T>(l_size, p_generator);
+            std::vector<T> l_square(2 * l_size);
+            std::vector<T> l_product(2 * l_size);
+            limb_kernel<T>::sqr(l_square.data(), l_op.get_extension().data(), l_size);
+            limb_kernel<T>::mul(l_product.data(), l_op.get_extension().data(), l_size, l_op.get_extension().data(), l_size);
+            l_sqr_ok &= l_square == l_product;
+        }
+        std::vector<T> l_max(20, std::numeric_limits<T>::max());
+        std::vector<T> l_square(40);
+        std::vector<T> l_product(40);
+        limb_kernel<T>::sqr(l_square.data(), l_max.data(), l_max.size());
+        limb_kernel<T>::mul(l_product.data(), l_max.data(), l_max.size(), l_max.data(), l_max.size());
+        l_sqr_ok &= l_square == l_product;
+        l_ok &= quicky_test::check_expected(l_sqr_ok, true, "sqr " + l_type);
+
+        // Powers against repeated multiplication
+        bool l_pow_ok = true;
+        for(unsigned int l_index = 0; l_index < 50; ++l_index)
+        {
+            ext_uint<T> l_base = random_power_operand<T>(1 + p_generator() % 4, p_generator);
+            l_base.shl(p_generator() % 20);
+            ext_uint<T> l_expected({1});
+            for(unsigned int l_exponent = 0; l_exponent < 40; ++l_exponent)
+            {
+                l_pow_ok &= pow(l_base, l_exponent) == l_expected;
+                l_expected = l_expected * l_base;
+            }
+        }
+        l_pow_ok &= pow(ext_uint<T>(), 0) == l_one && pow(ext_uint<T>(), 5) == ext_uint<T>();
+        l_ok &= quicky_test::check_expected(l_pow_ok, true, "pow " + l_type);
+        l_ok &= quicky_test::check_expected(pow(ext_int<t_signed>(-3), 3), ext_int<t_signed>(-27), "signed pow odd " + l_type);
+        l_ok &= quicky_test::check_expected(pow(ext_int<t_signed>(-3), 4), ext_int<t_signed>(81), "signed pow even " + l_type);
+
+        // Roots of small numbers against exhaustive search
+        bool l_small_root_ok = true;
+        for(uint32_t l_value = 0; l_value < 600; ++l_value)
+        {
+            for(unsigned int l_degree = 1; l_degree < 11; ++l_degree)
+            {
+                uint32_t l_root = 0;
+                while(std::pow((double)(l_root + 1), (double)l_degree) <= l_value)
+                {
+                    ++l_root;
+                }
+                l_small_root_ok &= iroot(ext_uint<T>(l_value), l_degree) == ext_uint<T>(l_root);
+            }
+        }
+        l_ok &= quicky_test::check_expected(l_small_root_ok, true, "small roots " + l_type);
+
+        // Roots of random numbers bound by powers
+        bool l_root_ok = true;
+        for(unsigned int l_index = 0; l_index < 60; ++l_index)
+        {
+            ext_uint<T> l_value = random_power_operand<T>(1 + p_generator() % (512 / sizeof(T)), p_generator);
+            for(unsigned int l_degree: {2u, 3u, 5u, 7u, 64u, 1000u})
+            {
+                ext_uint<T> l_root = iroot(l_value, l_degree);
+                l_root_ok &= pow(l_root, l_degree) <= l_value && pow(l_root + l_one, l_degree) > l_value;
+            }
+            l_root_ok &= isqrt(l_value) == iroot(l_value, 2);
+        }
+        l_ok &= quicky_test::check_expected(l_root_ok, true, "roots " + l_type);
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([&]{iroot(l_one, 0);}, true, quicky_test::auto_message(__FILE__, __LINE__));
+
+        // Perfect squares
+        bool l_square_ok = is_perfect_square(ext_uint<T>()) && is_perfect_square(l_one);
+        for(unsigned int l_index = 0; l_index < 100; ++l_index)
+        {
+            ext_uint<T> l_root = random_power_operand<T>(1 + p_generator() % 20, p_generator) + l_one;
+            ext_uint<T> l_value = l_root * l_root;
+            l_square_ok &= is_perfect_square(l_value) && !is_perfect_square(l_value + l_one) && !is_perfect_square(l_value - l_one);
+        }
+        l_ok &= quicky_test::check_expected(l_square_ok, true, "perfect squares " + l_type);
+
+        // Perfect powers
+        bool l_power_ok = true;
+        ext_uint<T> l_root;
+        unsigned int l_exponent;
+        for(unsigned int l_index = 0; l_index < 40; ++l_index)
+        {
+            ext_uint<T> l_base = random_power_operand<T>(1 + p_generator() % (8 / sizeof(T) + 1), p_generator) + l_one;
+            unsigned int l_degree = 2 + (unsigned int)(p_generator() % 30);
+            ext_uint<T> l_value = pow(l_base, l_degree);
+            l_power_ok &= is_perfect_power(l_value, l_root, l_exponent) && !(l_exponent % l_degree) && pow(l_root, l_exponent) == l_value;
+            l_power_ok &= !is_perfect_power(l_value + l_one, l_root, l_exponent) && l_root == l_value + l_one && 1 == l_exponent;
+        }
+        l_ok &= quicky_test::check_expected(l_power_ok, true, "perfect powers " + l_type);
+        l_ok &= quicky_test::check_expected(is_perfect_power(pow(ext_uint<T>(6u), 35), l_root, l_exponent) && ext_uint<T>(6u) == l_root && 35 == l_exponent, true, "perfect power 6 ^ 35 " + l_type);
+        l_ok &= quicky_test::check_expected(is_perfect_power(pow(ext_uint<T>(3u), 30), l_root, l_exponent) && ext_uint<T>(3u) == l_root && 30 == l_exponent, true, "perfect power 3 ^ 30 " + l_type);
+        l_ok &= quicky_test::check_expected(is_perfect_power(pow(ext_uint<T>(2u), 1000), l_root, l_exponent) && ext_uint<T>(2u) == l_root && 1000 == l_exponent, true, "perfect power 2 ^ 1000 " + l_type);
+        l_ok &= quicky_test::check_expected(is_perfect_power(pow(ext_uint<T>(1000003u), 97), l_root, l_exponent) && ext_uint<T>(1000003u) == l_root && 97 == l_exponent, true, "perfect power 1000003 ^ 97 " + l_type);
+        return l_ok;
+    }
+
+    /**
+     * Compare powers and roots with naive algorithms on big numbers
+     * @param p_nb_bits size of numbers in bits
+     * @param p_generator random generator
+     * @return true if test is successfull
+     */
+    bool bench_ext_power(size_t p_nb_bits
+                        ,std::mt19937_64 & p_generator
+                        )
+    {
+        bool l_ok = true;
+        auto l_time = [&](auto p_function)
+        {
+            auto l_start = std::chrono::steady_clock::now();
+            p_function();
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+        };
+        ext_uint<uint64_t> l_one({1});
+
+        // Power of a 64 bits number
+        ext_uint<uint64_t> l_base = random_power_operand<uint64_t>(1, p_generator);
+        uint64_t l_exponent = p_nb_bits / 64;
+        ext_uint<uint64_t> l_power;
+        ext_uint<uint64_t> l_naive_power({1});
+        auto l_pow_time = l_time([&]{l_power = pow(l_base, l_exponent);});
+        auto l_naive_pow_time = l_time([&]
+        {
+            for(uint64_t l_index = 0; l_index < l_exponent; ++l_index)
+            {
+                l_naive_power = l_naive_power * l_base;
+            }
+        });
+        l_ok &= quicky_test::check_expected(l_power, l_naive_power, "bench pow " + std::to_string(p_nb_bits));
+
+        // Square root compared with Newton iteration at full precision
+        ext_uint<uint64_t> l_value = random_power_operand<uint64_t>(p_nb_bits / 64, p_generator);
+        ext_uint<uint64_t> l_sqrt;
+        ext_uint<uint64_t> l_naive_sqrt;
+        auto l_sqrt_time = l_time([&]{l_sqrt = isqrt(l_value);});
+        auto l_naive_sqrt_time = l_time([&]
+        {
+            l_naive_sqrt = l_one;
+            l_naive_sqrt.shl((l_value.bit_length() + 1) / 2);
+            while(true)
+            {
+                ext_uint<uint64_t> l_next = (l_naive_sqrt + l_value / l_naive_sqrt).shr(1);
+                if(l_next >= l_naive_sqrt)
+                {
+                    break;
+                }
+                l_naive_sqrt = l_next;
+            }
+        });
+        l_ok &= quicky_test::check_expected(l_sqrt, l_naive_sqrt, "bench isqrt " + std::to_string(p_nb_bits));
+
+        ext_uint<uint64_t> l_cube_root;
+        auto l_cube_root_time = l_time([&]{l_cube_root = iroot(l_value, 3);});
+        l_ok &= quicky_test::check_expected(pow(l_cube_root, 3) <= l_value && pow(l_cube_root + l_one, 3) > l_value, true, "bench iroot " + std::to_string(p_nb_bits));
+
+        ext_uint<uint64_t> l_root;
+        unsigned int l_root_exponent;
+        bool l_is_power = true;
+        auto l_not_power_time = l_time([&]{l_is_power = is_perfect_power(l_value, l_root, l_root_exponent);});
+        l_ok &= quicky_test::check_expected(l_is_power, false, "bench is_perfect_power " + std::to_string(p_nb_bits));
+        auto l_power_time = l_time([&]{l_is_power = is_perfect_power(l_power, l_root, l_root_exponent);});
+        l_ok &= quicky_test::check_expected(l_is_power && !(l_exponent % l_root_exponent), true, "bench is_perfect_power of power " + std::to_string(p_nb_bits));
+
+        quicky_test::get_bench_ostream() << p_nb_bits << " bits: pow " << l_pow_time << " us (repeated multiplication " << l_naive_pow_time << " us), isqrt " << l_sqrt_time << " us (full precision Newton " << l_naive_sqrt_time << " us), cube root " << l_cube_root_time << " us, is_perfect_power " << l_not_power_time << " us (" << l_power_time << " us for a power)" << std::endl;
+        return l_ok;
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    test_ext_power()
+    {
+        bool l_ok = true;
+        std::mt19937_64 l_generator(39);
+        l_ok &= check_ext_power<uint8_t>(l_generator);
+        l_ok &= check_ext_power<uint16_t>(l_generator);
+        l_ok &= check_ext_power<uint32_t>(l_generator);
+        l_ok &= check_ext_power<uint64_t>(l_generator);
+        for(size_t l_nb_bits: {1000, 10000, 100000})
+        {
+            if(l_nb_bits > quicky_test::get_bench_size(1000, 100000))
+            {
+                break;
+            }
+            l_ok &= bench_ext_power(l_nb_bits, l_generator);
+        }
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF
@@ -18,6 +18,8 @@
 #ifdef QUICKY_UTILS_SELF_TEST
 #include <cstdlib>
 #include <cmath>
+#include <chrono>
+#include <random>
 #include "ext_uint.h"
 #include "ext_int.h"
 #include "quicky_test.h"
@@ -226,6 +228,39 @@ namespace quicky_utils
         }
     }
 
+    /**
+     * Report time of decimal conversions of numbers of a given number of
+     * digits and check that they round trip
+     * @tparam T limb type
+     * @param p_nb_digits number of decimal digits
+     * @param p_generator random generator
+     * @return true if conversions round trip
+     */
+    template <typename T>
+    bool bench_ext_uint_conversion(size_t p_nb_digits
+                                  ,std::mt19937_64 & p_generator
+                                  )
+    {
+        std::string l_decimal(p_nb_digits, '0');
+        for(auto & l_digit: l_decimal)
+        {
+            l_digit = (char)('0' + p_generator() % 10);
+        }
+        l_decimal[0] = (char)('1' + p_generator() % 9);
+        auto l_time = [&](auto p_function)
+        {
+            auto l_start = std::chrono::steady_clock::now();
+            p_function();
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+        };
+        ext_uint<T> l_value;
+        std::string l_string;
+        auto l_from_string_time = l_time([&]{l_value = ext_uint<T>::from_string(l_decimal);});
+        auto l_to_string_time = l_time([&]{l_string = l_value.to_string();});
+        quicky_test::get_bench_ostream() << p_nb_digits << " digits " << type_string<ext_uint<T>>::name() << ": from_string " << l_from_string_time << " us, to_string " << l_to_string_time << " us" << std::endl;
+        return quicky_test::check_expected(l_string == l_decimal, true, "decimal round trip of " + std::to_string(p_nb_digits) + " digits " + type_string<ext_uint<T>>::name());
+    }
+
     //------------------------------------------------------------------------------
     bool
     test_ext_uint()
@@ -253,6 +288,20 @@ namespace quicky_utils
         l_ok &= check_convert<uint32_t,quicky_utils::ext_uint<uint8_t>>(l_un, 1);
         l_ok &= check_convert<uint32_t,quicky_utils::ext_uint<uint8_t>>(l_max, std::numeric_limits<uint32_t>::max());
 
+        quicky_test::get_ostream() << std::endl << "Test " << l_type_name << " move" << std::endl;
+        {
+            quicky_utils::ext_uint<uint8_t> l_source(l_max);
+            quicky_utils::ext_uint<uint8_t> l_moved(std::move(l_source));
+            l_ok &= quicky_test::check_expected(l_moved, l_max, quicky_test::auto_message(__FILE__, __LINE__));
+            l_ok &= quicky_test::check_expected(l_source, l_zero, quicky_test::auto_message(__FILE__, __LINE__));
+            l_ok &= quicky_test::check_ostream_operator(l_source, "0x00");
+            l_ok &= quicky_test::check_expected(quicky_utils::ext_int<int8_t>(l_source), quicky_utils::ext_int<int8_t>(), quicky_test::auto_message(__FILE__, __LINE__));
+            l_source = std::move(l_moved);
+            l_ok &= quicky_test::check_expected(l_source, l_max, quicky_test::auto_message(__FILE__, __LINE__));
+            l_ok &= quicky_test::check_expected(l_moved, l_zero, quicky_test::auto_message(__FILE__, __LINE__));
+            l_ok &= quicky_test::check_expected(l_moved + l_un, l_un, quicky_test::auto_message(__FILE__, __LINE__));
+        }
+
         quicky_test::get_ostream() << std::endl << "Test " << l_type_name << " == operator" << std::endl;
         l_ok &= quicky_test::check_expected(l_zero == l_zero_bis, true, quicky_test::auto_message(__FILE__, __LINE__));
         l_ok &= quicky_test::check_expected(l_zero_list_init == l_zero_list_init_bis, true, quicky_test::auto_message(__FILE__, __LINE__));
@@ -493,6 +542,39 @@ namespace quicky_utils
             }
         }
 
+        std::cout << "Check " << l_type_name << " shl()/shr()/bit helpers" << std::endl;
+        for(const auto & l_iter1: l_test_values)
+        {
+            for(unsigned int l_i = 0; l_i < 8 * sizeof(uint32_t); ++l_i)
+            {
+                ext_uint<uint8_t> l_shifted(l_iter1.second);
+                l_ok &= quicky_test::check_expected(l_shifted.shl(l_i), quicky_utils::ext_uint<uint8_t>(((uint64_t) l_iter1.first) << l_i), (std::string) l_iter1.second + " shl " + std::to_string(l_i));
+                l_ok &= quicky_test::check_expected(l_shifted.shr(l_i), l_iter1.second, (std::string) l_iter1.second + " shr " + std::to_string(l_i));
+                l_ok &= quicky_test::check_expected(l_iter1.second.test_bit(l_i), (bool)((l_iter1.first >> l_i) & 1u), (std::string) l_iter1.second + " test_bit " + std::to_string(l_i));
+            }
+            size_t l_bit_length = 0;
+            while(l_bit_length < 8 * sizeof(uint32_t) && (l_iter1.first >> l_bit_length))
+            {
+                ++l_bit_length;
+            }
+            l_ok &= quicky_test::check_expected(l_iter1.second.bit_length(), l_bit_length, (std::string) l_iter1.second + " bit_length");
+            if(l_iter1.first)
+            {
+                l_ok &= quicky_test::check_expected(l_iter1.second.ctz(), (size_t)__builtin_ctz(l_iter1.first), (std::string) l_iter1.second + " ctz");
+            }
+        }
+        l_result = l_un;
+        l_ok &= quicky_test::check_expected(l_result.shl(1000).bit_length(), (size_t)1001, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected(l_result.ctz(), (size_t)1000, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected(l_un << ext_uint<uint8_t>({0xE8, 0x3}), l_result, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected(l_result >> ext_uint<uint8_t>({0xE7, 0x3}), ext_uint<uint8_t>({2}), quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected(l_result.shr(1001), ext_uint<uint8_t>(), quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected(l_result.set_bit(17), ext_uint<uint8_t>({0x0, 0x0, 0x2}), quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected(l_result.set_bit(3), ext_uint<uint8_t>({0x8, 0x0, 0x2}), quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected(l_result.set_bit(17, false), ext_uint<uint8_t>({0x8}), quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected(ext_uint<uint8_t>({1}) >> ext_uint<uint8_t>({0, 0, 0, 0, 0, 0, 0, 0, 1}), ext_uint<uint8_t>(), quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([]{(void)ext_uint<uint8_t>().ctz();}, true, quicky_test::auto_message(__FILE__, __LINE__));
+
         std::cout << "Check " << l_type_name << " << float()/double() operator" << std::endl;
         for(const auto & l_iter: l_test_values)
         {
@@ -506,6 +588,47 @@ namespace quicky_utils
             l_ok &= check_floating_conversion<uint32_t, ext_uint<uint64_t>, double>(l_iter.first);
         }
 
+        std::cout << "Check " << l_type_name << " to_string()/from_string() methods" << std::endl;
+        for(const auto & l_iter: l_test_values)
+        {
+            l_ok &= quicky_test::check_expected(l_iter.second.to_string(), std::to_string(l_iter.first), (std::string)l_iter.second + " to_string()");
+            l_ok &= quicky_test::check_expected(ext_uint<uint8_t>::from_string(std::to_string(l_iter.first)), l_iter.second, std::to_string(l_iter.first) + " from_string()");
+            for(unsigned int l_base = 2; l_base <= 36; ++l_base)
+            {
+                l_ok &= quicky_test::check_expected(ext_uint<uint8_t>::from_string(l_iter.second.to_string(l_base), l_base), l_iter.second, (std::string)l_iter.second + " base " + std::to_string(l_base) + " round trip");
+            }
+        }
+        l_ok &= quicky_test::check_expected(ext_uint<uint8_t>({0xAB, 0xCD}).to_string(16), std::string("cdab"), quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected(ext_uint<uint8_t>::from_string("CdAb", 16), ext_uint<uint8_t>({0xAB, 0xCD}), quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected(ext_uint<uint8_t>({35}).to_string(36), std::string("z"), quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected(ext_uint<uint8_t>({5}).to_string(2), std::string("101"), quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([]{ext_uint<uint8_t>::from_string("12a");}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([]{(void)ext_uint<uint8_t>({1}).to_string(37);}, true, quicky_test::auto_message(__FILE__, __LINE__));
+
+        // Numbers big enough to be split recursively
+        std::string l_big_decimal = "1";
+        for(unsigned int l_index = 0; l_index < 400; ++l_index)
+        {
+            l_big_decimal.push_back((char)('0' + (7 * l_index) % 10));
+        }
+        auto l_big_uint8 = ext_uint<uint8_t>::from_string(l_big_decimal);
+        auto l_big_uint64 = ext_uint<uint64_t>::from_string(l_big_decimal);
+        l_ok &= quicky_test::check_expected(l_big_uint8.to_string(), l_big_decimal, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected(l_big_uint64.to_string(), l_big_decimal, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected(ext_uint<uint8_t>::from_string(l_big_uint8.to_string(16), 16), l_big_uint8, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected(ext_uint<uint16_t>::from_string(l_big_decimal + "000000000000000000000000000000").to_string(), l_big_decimal + "000000000000000000000000000000", quicky_test::auto_message(__FILE__, __LINE__));
+
+        std::mt19937_64 l_generator(26);
+        for(size_t l_nb_digits: {1000, 10000, 100000, 1000000})
+        {
+            if(l_nb_digits > quicky_test::get_bench_size(10000, 1000000))
+            {
+                break;
+            }
+            l_ok &= bench_ext_uint_conversion<uint32_t>(l_nb_digits, l_generator);
+            l_ok &= bench_ext_uint_conversion<uint64_t>(l_nb_digits, l_generator);
+        }
+
         return l_ok;
     }
 
@@ -828,6 +951,15 @@ namespace quicky_utils
             }
         }
 
+        std::cout << "Check " << l_type_name << " to_string()/from_string() methods" << std::endl;
+        for(const auto & l_iter: l_test_values)
+        {
+            l_ok &= quicky_test::check_expected(l_iter.second.to_string(), std::to_string(l_iter.first), (std::string)l_iter.second + " to_string()");
+            l_ok &= quicky_test::check_expected(ext_int<int8_t>::from_string(std::to_string(l_iter.first)), l_iter.second, std::to_string(l_iter.first) + " from_string()");
+            l_ok &= quicky_test::check_expected(ext_int<int8_t>::from_string(l_iter.second.to_string(7), 7), l_iter.second, (std::string)l_iter.second + " base 7 round trip");
+        }
+        l_ok &= quicky_test::check_expected(ext_int<int8_t>::from_string("+42"), ext_int<int8_t>(42, {}), quicky_test::auto_message(__FILE__, __LINE__));
+
         //------------------------------------------------------------------
         //    |  0 |  0 |  0 |  0 |  0 |  0 |
         //    |0000|0000|0000|0000|0000|0000|
@@ -0,0 +1,240 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include <random>
+#include <chrono>
+#include <unordered_set>
+#include "ext_uint_sort.h"
+#include "ext_uint.h"
+#include "ext_int.h"
+#include "quicky_test.h"
+#include "type_string.h"
+#include <iostream>
+
+namespace quicky_utils
+{
+    /**
+     * Random number with a random number of limbs
+     * @tparam T limb type
+     * @param p_max_nb_limbs maximum number of limbs
+     * @param p_generator random generator
+     * @return random number
+     */
+    template <typename T>
+    ext_uint<T> random_sort_value(size_t p_max_nb_limbs
+                                 ,std::mt19937_64 & p_generator
+                                 )
+    {
+        std::vector<T> l_limbs(1 + p_generator() % p_max_nb_limbs);
+        for(auto & l_iter: l_limbs)
+        {
+            // Small limbs produce duplicates and equal bytes
+            l_iter = (T)(p_generator() % 4 ? p_generator() : p_generator() % 3);
+        }
+        return ext_uint<T>::from_limbs(l_limbs.data(), l_limbs.size());
+    }
+
+    /**
+     * Check that relational operators are consistent with three-way
+     * comparison and with sign of difference
+     * @tparam T limb type
+     * @param p_op1 first operand
+     * @param p_op2 second operand
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool check_ext_uint_compare(const ext_uint<T> & p_op1
+                               ,const ext_uint<T> & p_op2
+                               )
+    {
+        int l_expected = p_op1 == p_op2 ? 0 : (ext_int<typename std::make_signed<T>::type>(p_op1) - ext_int<typename std::make_signed<T>::type>(p_op2)).get_root() < 0 ? -1 : 1;
+        bool l_ok = quicky_test::check_expected_quiet(p_op1.compare(p_op2), l_expected);
+        l_ok &= quicky_test::check_expected_quiet(p_op2.compare(p_op1), -l_expected);
+        l_ok &= quicky_test::check_expected_quiet(p_op1 < p_op2, l_expected < 0);
+        l_ok &= quicky_test::check_expected_quiet(p_op1 > p_op2, l_expected > 0);
+        l_ok &= quicky_test::check_expected_quiet(p_op1 <= p_op2, l_expected <= 0);
+        l_ok &= quicky_test::check_expected_quiet(p_op1 >= p_op2, l_expected >= 0);
+        l_ok &= quicky_test::check_expected_quiet(p_op1 != p_op2, l_expected != 0);
+        return l_ok;
+    }
+
+    /**
+     * Check that relational operators of ext_int are consistent with
+     * three-way comparison and with sign of difference
+     * @tparam T signed limb type
+     * @param p_op1 first operand
+     * @param p_op2 second operand
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool check_ext_int_compare(const ext_int<T> & p_op1
+                              ,const ext_int<T> & p_op2
+                              )
+    {
+        ext_int<T> l_difference = p_op1 - p_op2;
+        int l_expected = l_difference.get_root() < 0 ? -1 : (l_difference == ext_int<T>(0) ? 0 : 1);
+        bool l_ok = quicky_test::check_expected_quiet(p_op1.compare(p_op2), l_expected);
+        l_ok &= quicky_test::check_expected_quiet(p_op2.compare(p_op1), -l_expected);
+        l_ok &= quicky_test::check_expected_quiet(p_op1 < p_op2, l_expected < 0);
+        l_ok &= quicky_test::check_expected_quiet(p_op1 > p_op2, l_expected > 0);
+        l_ok &= quicky_test::check_expected_quiet(p_op1 <= p_op2, l_expected <= 0);
+        l_ok &= quicky_test::check_expected_quiet(p_op1 >= p_op2, l_expected >= 0);
+        l_ok &= quicky_test::check_expected_quiet(p_op1 == p_op2, l_expected == 0);
+        return l_ok;
+    }
+
+    /**
+     * Check comparisons, hash and sort for a limb type
+     * @tparam T limb type
+     * @param p_generator random generator
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool check_ext_uint_sort(std::mt19937_64 & p_generator)
+    {
+        typedef typename std::make_signed<T>::type t_signed;
+        bool l_ok = true;
+        std::string l_type = type_string<T>::name();
+
+        // Long numbers differing in a single limb exercise block scan
+        for(size_t l_nb_limbs: {1, 3, 4, 31, 32, 33, 100})
+        {
+            std::vector<T> l_limbs(l_nb_limbs);
+            for(auto & l_iter: l_limbs)
+            {
+                l_iter = (T)p_generator();
+            }
+            l_limbs.back() |= 1;
+            ext_uint<T> l_reference = ext_uint<T>::from_limbs(l_limbs.data(), l_limbs.size());
+            bool l_compare_ok = check_ext_uint_compare(l_reference, l_reference);
+            for(size_t l_index = 0; l_index < l_nb_limbs; ++l_index)
+            {
+                std::vector<T> l_modified(l_limbs);
+                l_modified[l_index] ^= (T)(1 + p_generator() % 255);
+                if(l_modified.back())
+                {
+                    l_compare_ok &= check_ext_uint_compare(l_reference, ext_uint<T>::from_limbs(l_modified.data(), l_modified.size()));
+                }
+            }
+            l_ok &= quicky_test::check_expected(l_compare_ok, true, "compare single limb difference " + l_type + " " + std::to_string(l_nb_limbs) + " limbs");
+        }
+
+        std::vector<ext_uint<T>> l_values;
+        for(unsigned int l_index = 0; l_index < 2000; ++l_index)
+        {
+            l_values.push_back(random_sort_value<T>(l_index % 2 ? 3 : 12, p_generator));
+        }
+        bool l_compare_ok = true;
+        bool l_int_compare_ok = true;
+        for(size_t l_index = 0; l_index + 1 < l_values.size(); ++l_index)
+        {
+            l_compare_ok &= check_ext_uint_compare(l_values[l_index], l_values[l_index + 1]);
+            ext_int<t_signed> l_op1(l_values[l_index]);
+            ext_int<t_signed> l_op2(l_values[l_index + 1]);
+            l_int_compare_ok &= check_ext_int_compare(l_op1, l_op2);
+            l_int_compare_ok &= check_ext_int_compare(-l_op1, l_op2);
+            l_int_compare_ok &= check_ext_int_compare(l_op1, -l_op2);
+            l_int_compare_ok &= check_ext_int_compare(-l_op1, -l_op2);
+        }
+        l_ok &= quicky_test::check_expected(l_compare_ok, true, "ext_uint compare " + l_type);
+        l_ok &= quicky_test::check_expected(l_int_compare_ok, true, "ext_int compare " + l_type);
+
+        // Equal values built differently share hash
+        std::unordered_set<ext_uint<T>> l_uint_set;
+        std::unordered_set<ext_int<t_signed>> l_int_set;
+        bool l_hash_ok = true;
+        for(const auto & l_iter: l_values)
+        {
+            ext_uint<T> l_rebuilt = ext_uint<T>::from_string(l_iter.to_string());
+            l_hash_ok &= std::hash<ext_uint<T>>()(l_iter) == std::hash<ext_uint<T>>()(l_rebuilt);
+            l_hash_ok &= std::hash<ext_int<t_signed>>()(-ext_int<t_signed>(l_iter)) == std::hash<ext_int<t_signed>>()(ext_int<t_signed>(0) - ext_int<t_signed>(l_rebuilt));
+            l_uint_set.insert(l_iter);
+            l_uint_set.insert(l_rebuilt);
+            l_int_set.insert(ext_int<t_signed>(l_iter));
+            l_int_set.insert(-ext_int<t_signed>(l_rebuilt));
+        }
+        std::vector<ext_uint<T>> l_sorted(l_values);
+        std::sort(l_sorted.begin(), l_sorted.end());
+        size_t l_nb_distinct = std::unique(l_sorted.begin(), l_sorted.end()) - l_sorted.begin();
+        l_ok &= quicky_test::check_expected(l_hash_ok, true, "hash of equal values " + l_type);
+        l_ok &= quicky_test::check_expected(l_uint_set.size(), l_nb_distinct, "ext_uint unordered_set " + l_type);
+        // Zero is its own opposite
+        size_t l_nb_zero = std::count(l_values.begin(), l_values.end(), ext_uint<T>());
+        l_ok &= quicky_test::check_expected(l_int_set.size(), 2 * l_nb_distinct - (l_nb_zero ? 1 : 0), "ext_int unordered_set " + l_type);
+
+        // Radix sort compared to comparison sort
+        for(size_t l_size: {0, 1, 2, 100, 2000})
+        {
+            std::vector<ext_uint<T>> l_radix(l_values.begin(), l_values.begin() + l_size);
+            std::vector<ext_uint<T>> l_reference(l_radix);
+            std::sort(l_reference.begin(), l_reference.end());
+            ext_uint_sort<T>::radix_sort(l_radix);
+            l_ok &= quicky_test::check_expected(l_radix == l_reference, true, "radix_sort " + l_type + " " + std::to_string(l_size) + " values");
+        }
+        return l_ok;
+    }
+
+    /**
+     * Report time of std::sort and radix_sort. Big groups are sorted with
+     * wide digits so results are also compared
+     * @param p_nb_values number of values to sort
+     * @param p_max_nb_limbs maximum number of 64 bits limbs of values
+     * @param p_generator random generator
+     * @return true if both sorts give same result
+     */
+    bool bench_ext_uint_sort(size_t p_nb_values
+                            ,size_t p_max_nb_limbs
+                            ,std::mt19937_64 & p_generator
+                            )
+    {
+        std::vector<ext_uint<uint64_t>> l_values;
+        l_values.reserve(p_nb_values);
+        for(size_t l_index = 0; l_index < p_nb_values; ++l_index)
+        {
+            l_values.push_back(random_sort_value<uint64_t>(p_max_nb_limbs, p_generator));
+        }
+        std::vector<ext_uint<uint64_t>> l_std(l_values);
+        auto l_start = std::chrono::steady_clock::now();
+        std::sort(l_std.begin(), l_std.end());
+        auto l_std_time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - l_start).count();
+        l_start = std::chrono::steady_clock::now();
+        ext_uint_sort<uint64_t>::radix_sort(l_values);
+        auto l_radix_time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - l_start).count();
+        quicky_test::get_bench_ostream() << "Sort of " << p_nb_values << " values of 1 to " << p_max_nb_limbs << " limbs: std::sort " << l_std_time << " ms, radix_sort " << l_radix_time << " ms" << std::endl;
+        return quicky_test::check_expected(l_values == l_std, true, "radix_sort " + std::to_string(p_nb_values) + " values");
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    test_ext_uint_sort()
+    {
+        bool l_ok = true;
+        std::mt19937_64 l_generator(37);
+        l_ok &= check_ext_uint_sort<uint8_t>(l_generator);
+        l_ok &= check_ext_uint_sort<uint16_t>(l_generator);
+        l_ok &= check_ext_uint_sort<uint32_t>(l_generator);
+        l_ok &= check_ext_uint_sort<uint64_t>(l_generator);
+        size_t l_nb_values = quicky_test::get_bench_size(10000, 1000000);
+        l_ok &= bench_ext_uint_sort(l_nb_values, 1, l_generator);
+        l_ok &= bench_ext_uint_sort(l_nb_values, 2, l_generator);
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF
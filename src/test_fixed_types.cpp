@@ -0,0 +1,192 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include "fixed_uint.h"
+#include "fixed_int.h"
+#include "quicky_test.h"
+#include "type_string.h"
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+
+namespace quicky_utils
+{
+    // Carry chains are usable at compile time
+    static_assert(uint128_fixed_t(0xFFFFFFFFFFFFFFFFULL) + uint128_fixed_t(1) == uint128_fixed_t(1) << 64, "constexpr fixed_uint addition");
+    static_assert((uint256_fixed_t(1) << 200) * uint256_fixed_t(1 << 20) == uint256_fixed_t(1) << 220, "constexpr fixed_uint multiplication");
+    static_assert(int128_fixed_t(-5) * int128_fixed_t(7) == int128_fixed_t(-35), "constexpr fixed_int multiplication");
+    static_assert((int128_fixed_t(-1) << 100 >> 99) == int128_fixed_t(-2), "constexpr fixed_int arithmetic shift");
+
+    /**
+     * Compare fixed_uint operators with ext_uint ones
+     * @tparam FIXED fixed_uint type
+     * @param p_op1 first operand
+     * @param p_op2 second operand, non null
+     * @return true if test is successfull
+     */
+    template <typename FIXED>
+    bool check_fixed_uint(const std::string & p_op1
+                         ,const std::string & p_op2
+                         )
+    {
+        typedef ext_uint<typename FIXED::limb_type> t_ext;
+        bool l_ok = true;
+        std::string l_message = type_string<FIXED>::name() + " " + p_op1 + " " + p_op2;
+        FIXED l_op1 = FIXED::from_string(p_op1);
+        FIXED l_op2 = FIXED::from_string(p_op2);
+        t_ext l_ext1 = t_ext::from_string(p_op1);
+        t_ext l_ext2 = t_ext::from_string(p_op2);
+        size_t l_nb_bits = FIXED::m_nb_limbs * 8 * sizeof(typename FIXED::limb_type);
+        t_ext l_modulo = t_ext({1}).shl(l_nb_bits);
+
+        l_ok &= quicky_test::check_expected(l_op1.to_string(), p_op1, "round trip " + l_message);
+        l_ok &= quicky_test::check_expected(l_op1 < l_op2, l_ext1 < l_ext2, "< " + l_message);
+        l_ok &= quicky_test::check_expected(l_op1 >= l_op2, l_ext1 >= l_ext2, ">= " + l_message);
+        l_ok &= quicky_test::check_expected(l_op1 == l_op2, l_ext1 == l_ext2, "== " + l_message);
+        l_ok &= quicky_test::check_expected((l_op1 + l_op2).to_ext_uint(), (l_ext1 + l_ext2) % l_modulo, "+ " + l_message);
+        l_ok &= quicky_test::check_expected((l_op1 - l_op2).to_ext_uint(), (l_ext1 + l_modulo - l_ext2) % l_modulo, "- " + l_message);
+        l_ok &= quicky_test::check_expected((l_op1 * l_op2).to_ext_uint(), (l_ext1 * l_ext2) % l_modulo, "* " + l_message);
+        l_ok &= quicky_test::check_expected((l_op1 / l_op2).to_ext_uint(), l_ext1 / l_ext2, "/ " + l_message);
+        l_ok &= quicky_test::check_expected((l_op1 % l_op2).to_ext_uint(), l_ext1 % l_ext2, "% " + l_message);
+        for(unsigned int l_shift: {0u, 1u, 7u, 63u, 64u, 65u, (unsigned int)l_nb_bits - 1})
+        {
+            l_ok &= quicky_test::check_expected((l_op1 << l_shift).to_ext_uint(), t_ext(l_ext1).shl(l_shift) % l_modulo, "<< " + std::to_string(l_shift) + " " + l_message);
+            l_ok &= quicky_test::check_expected((l_op1 >> l_shift).to_ext_uint(), t_ext(l_ext1).shr(l_shift), ">> " + std::to_string(l_shift) + " " + l_message);
+        }
+        l_ok &= quicky_test::check_expected(l_op1.bit_length(), l_ext1.bit_length(), "bit_length " + l_message);
+
+        bool l_overflow = false;
+        FIXED::check_add(l_op1, l_op2, l_overflow);
+        l_ok &= quicky_test::check_expected(l_overflow, l_ext1 + l_ext2 >= l_modulo, "check_add " + l_message);
+        FIXED::check_sub(l_op1, l_op2, l_overflow);
+        l_ok &= quicky_test::check_expected(l_overflow, l_ext1 < l_ext2, "check_sub " + l_message);
+        FIXED::check_mul(l_op1, l_op2, l_overflow);
+        l_ok &= quicky_test::check_expected(l_overflow, l_ext1 * l_ext2 >= l_modulo, "check_mul " + l_message);
+        l_ok &= quicky_test::check_expected(FIXED::promote_add(l_op1, l_op2), l_ext1 + l_ext2, "promote_add " + l_message);
+        l_ok &= quicky_test::check_expected(FIXED::promote_mul(l_op1, l_op2), l_ext1 * l_ext2, "promote_mul " + l_message);
+        return l_ok;
+    }
+
+    /**
+     * Compare fixed_int operators with ext_int ones for all sign
+     * combinations of operands
+     * @tparam FIXED fixed_int type
+     * @param p_op1 magnitude of first operand
+     * @param p_op2 magnitude of second operand, non null
+     * @return true if test is successfull
+     */
+    template <typename FIXED>
+    bool check_fixed_int(const std::string & p_op1
+                        ,const std::string & p_op2
+                        )
+    {
+        typedef typename FIXED::ext_type t_ext;
+        bool l_ok = true;
+        for(unsigned int l_case = 0; l_case < 4; ++l_case)
+        {
+            std::string l_string1 = (l_case & 1 ? "-" : "") + p_op1;
+            std::string l_string2 = (l_case & 2 ? "-" : "") + p_op2;
+            std::string l_message = type_string<FIXED>::name() + " " + l_string1 + " " + l_string2;
+            FIXED l_op1 = FIXED::from_string(l_string1);
+            FIXED l_op2 = FIXED::from_string(l_string2);
+            t_ext l_ext1 = t_ext::from_string(l_string1);
+            t_ext l_ext2 = t_ext::from_string(l_string2);
+
+            l_ok &= quicky_test::check_expected(l_op1.to_ext_int(), l_ext1, "round trip " + l_message);
+            l_ok &= quicky_test::check_expected(l_op1 < l_op2, l_ext1 < l_ext2, "< " + l_message);
+            l_ok &= quicky_test::check_expected(l_op1 > l_op2, l_ext1 > l_ext2, "> " + l_message);
+            l_ok &= quicky_test::check_expected((l_op1 / l_op2).to_ext_int(), l_ext1 / l_ext2, "/ " + l_message);
+            l_ok &= quicky_test::check_expected((l_op1 % l_op2).to_ext_int(), l_ext1 % l_ext2, "% " + l_message);
+            l_ok &= quicky_test::check_expected(FIXED::promote_add(l_op1, l_op2), l_ext1 + l_ext2, "promote_add " + l_message);
+            l_ok &= quicky_test::check_expected(FIXED::promote_mul(l_op1, l_op2), l_ext1 * l_ext2, "promote_mul " + l_message);
+
+            bool l_overflow = false;
+            FIXED l_result = FIXED::check_add(l_op1, l_op2, l_overflow);
+            if(!l_overflow)
+            {
+                l_ok &= quicky_test::check_expected(l_result.to_ext_int(), l_ext1 + l_ext2, "check_add " + l_message);
+            }
+            l_result = FIXED::check_sub(l_op1, l_op2, l_overflow);
+            if(!l_overflow)
+            {
+                l_ok &= quicky_test::check_expected(l_result.to_ext_int(), l_ext1 - l_ext2, "check_sub " + l_message);
+            }
+            l_result = FIXED::check_mul(l_op1, l_op2, l_overflow);
+            if(!l_overflow)
+            {
+                l_ok &= quicky_test::check_expected(l_result.to_ext_int(), l_ext1 * l_ext2, "check_mul " + l_message);
+            }
+        }
+        return l_ok;
+    }
+
+    //-------------------------------------------------------------------------
+    bool test_fixed_uint()
+    {
+        bool l_ok = true;
+        std::cout << "Check fixed_uint" << std::endl;
+        std::string l_max128 = "340282366920938463463374607431768211455";
+        std::string l_big = "123456789012345678901234567890123456789";
+        std::string l_medium = "98765432109876543210987654321";
+        l_ok &= check_fixed_uint<uint128_fixed_t>(l_big, l_medium);
+        l_ok &= check_fixed_uint<uint128_fixed_t>(l_medium, l_big);
+        l_ok &= check_fixed_uint<uint128_fixed_t>(l_max128, "1");
+        l_ok &= check_fixed_uint<uint128_fixed_t>(l_max128, l_max128);
+        l_ok &= check_fixed_uint<uint128_fixed_t>("0", "18446744073709551616");
+        l_ok &= check_fixed_uint<fixed_uint<128, uint8_t>>(l_big, "255");
+        l_ok &= check_fixed_uint<fixed_uint<256, uint32_t>>(l_big, l_medium);
+        l_ok &= check_fixed_uint<uint256_fixed_t>(l_max128, l_big);
+        l_ok &= check_fixed_uint<uint512_fixed_t>(l_big + l_big, l_medium);
+
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([]{uint128_fixed_t::from_string("340282366920938463463374607431768211456");}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([]{(void)(uint128_fixed_t(1) / uint128_fixed_t());}, true, quicky_test::auto_message(__FILE__, __LINE__));
+
+        // Display does not change format of stream
+        std::ostringstream l_stream;
+        l_stream << std::setfill('*') << std::setw(4) << fixed_uint<64, uint32_t>(0xABULL) << " " << 255 << " " << std::setw(4) << 7;
+        l_ok &= quicky_test::check_expected(l_stream.str(), std::string("0x00000000000000ab 255 ***7"), quicky_test::auto_message(__FILE__, __LINE__));
+        return l_ok;
+    }
+
+    //-------------------------------------------------------------------------
+    bool test_fixed_int()
+    {
+        bool l_ok = true;
+        std::cout << "Check fixed_int" << std::endl;
+        std::string l_max127 = "170141183460469231731687303715884105727";
+        std::string l_big = "123456789012345678901234567890123456789";
+        std::string l_medium = "98765432109876543210987654321";
+        l_ok &= check_fixed_int<int128_fixed_t>(l_big, l_medium);
+        l_ok &= check_fixed_int<int128_fixed_t>(l_medium, l_big);
+        l_ok &= check_fixed_int<int128_fixed_t>(l_max127, l_max127);
+        l_ok &= check_fixed_int<int128_fixed_t>(l_max127, "1");
+        l_ok &= check_fixed_int<int128_fixed_t>("0", "3");
+        l_ok &= check_fixed_int<fixed_int<128, uint16_t>>(l_big, "65535");
+        l_ok &= check_fixed_int<int256_fixed_t>(l_big, l_medium);
+
+        l_ok &= quicky_test::check_expected(int128_fixed_t::from_string("-" + l_max127) - int128_fixed_t(1), int128_fixed_t::from_string("-170141183460469231731687303715884105728"), quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected((int128_fixed_t(-1000) >> 3).to_string(), std::string("-125"), quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected((int128_fixed_t(-1001) >> 3).to_string(), std::string("-126"), quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([=]{int128_fixed_t::from_string("170141183460469231731687303715884105728");}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([]{(void)(int128_fixed_t(1) % int128_fixed_t());}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF
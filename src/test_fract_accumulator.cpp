@@ -0,0 +1,170 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include <random>
+#include <chrono>
+#include "safe_types.h"
+#include "fract_accumulator.h"
+#include "quicky_test.h"
+#include "type_string.h"
+#include <vector>
+
+namespace quicky_utils
+{
+    /**
+     * Accumulate random terms with fract operators and with accumulator,
+     * check that normalized values are identical and compare speed
+     * @tparam T coefficient type
+     * @param p_nb_terms number of terms
+     * @param p_denominators denominators of terms
+     * @param p_name workload name
+     * @param p_generator random generator
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool check_fract_accumulator(size_t p_nb_terms
+                                ,const std::vector<unsigned int> & p_denominators
+                                ,const std::string & p_name
+                                ,std::mt19937_64 & p_generator
+                                )
+    {
+        typedef fract<T> t_fract;
+        typedef typename t_fract::t_coef_num t_coef_num;
+        typedef typename t_fract::t_coef_den t_coef_den;
+        bool l_ok = true;
+        std::string l_type = type_string<T>::name();
+
+        std::vector<t_fract> l_terms(p_nb_terms);
+        std::vector<bool> l_subs(p_nb_terms);
+        for(size_t l_index = 0; l_index < p_nb_terms; ++l_index)
+        {
+            t_coef_num l_num = (t_coef_num)(int)(p_generator() % 19) - (t_coef_num)9;
+            t_coef_den l_den = (t_coef_den)p_denominators[p_generator() % p_denominators.size()];
+            l_terms[l_index] = t_fract(l_num, l_den);
+            l_subs[l_index] = p_generator() & 1;
+        }
+
+        // Intermediate values are compared on checkpoints
+        const size_t l_checkpoint = 4096;
+        std::vector<t_fract> l_fract_values;
+        std::vector<t_fract> l_accumulator_values;
+        auto l_start = std::chrono::steady_clock::now();
+        t_fract l_sum;
+        for(size_t l_index = 0; l_index < p_nb_terms; ++l_index)
+        {
+            if(l_subs[l_index])
+            {
+                l_sum -= l_terms[l_index];
+            }
+            else
+            {
+                l_sum += l_terms[l_index];
+            }
+            if(l_index % l_checkpoint == l_checkpoint - 1)
+            {
+                l_fract_values.push_back(l_sum);
+            }
+        }
+        l_fract_values.push_back(l_sum);
+        auto l_fract_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+
+        l_start = std::chrono::steady_clock::now();
+        fract_accumulator<T> l_accumulator;
+        for(size_t l_index = 0; l_index < p_nb_terms; ++l_index)
+        {
+            if(l_subs[l_index])
+            {
+                l_accumulator -= l_terms[l_index];
+            }
+            else
+            {
+                l_accumulator += l_terms[l_index];
+            }
+            if(l_index % l_checkpoint == l_checkpoint - 1)
+            {
+                l_accumulator_values.push_back(l_accumulator.normalize());
+            }
+        }
+        l_accumulator_values.push_back(l_accumulator.normalize());
+        auto l_accumulator_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+
+        l_ok &= quicky_test::check_expected(l_accumulator_values == l_fract_values, true, "accumulated values " + p_name + " " + l_type);
+        quicky_test::get_bench_ostream() << "Sum of " << p_nb_terms << " " << l_type << " fractions with " << p_name << ": fract " << l_fract_time << " us, accumulator " << l_accumulator_time << " us, " << l_accumulator.get_nb_overflow_reductions() << " overflow reductions" << std::endl;
+        return l_ok;
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    test_fract_accumulator()
+    {
+        bool l_ok = true;
+        std::mt19937_64 l_generator(44);
+        std::vector<unsigned int> l_cents{1, 2, 4, 5, 10, 20, 25, 50, 100};
+        std::vector<unsigned int> l_small{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+        std::vector<unsigned int> l_medium;
+        for(unsigned int l_index = 1; l_index <= 24; ++l_index)
+        {
+            l_medium.push_back(l_index);
+        }
+        size_t l_nb_terms = quicky_test::get_bench_size(20000, 1000000);
+        l_ok &= check_fract_accumulator<uint32_t>(l_nb_terms, l_cents, "divisors of 100", l_generator);
+        l_ok &= check_fract_accumulator<uint32_t>(l_nb_terms, l_small, "denominators up to 12", l_generator);
+        l_ok &= check_fract_accumulator<uint64_t>(l_nb_terms, l_cents, "divisors of 100", l_generator);
+        l_ok &= check_fract_accumulator<uint64_t>(l_nb_terms, l_medium, "denominators up to 24", l_generator);
+        l_ok &= check_fract_accumulator<safe_int<int32_t>>(l_nb_terms / 10, l_small, "denominators up to 12", l_generator);
+
+        // Reduction forced by overflow
+        typedef fract<uint8_t> t_fract8;
+        fract_accumulator<uint8_t> l_accumulator(t_fract8((int8_t)1, (int8_t)3));
+        l_accumulator += t_fract8((int8_t)1, (int8_t)5);
+        l_accumulator -= t_fract8((int8_t)1, (int8_t)5);
+        l_ok &= quicky_test::check_expected(l_accumulator.get_fract(), t_fract8((int8_t)1, (int8_t)3), "1/3 + 1/5 - 1/5");
+        l_accumulator += t_fract8((int8_t)1, (int8_t)7);
+        l_ok &= quicky_test::check_expected(l_accumulator.get_nb_overflow_reductions(), (uint64_t)0, "no reduction for 5/15 + 1/7");
+        // 50/105 - 1/11 needs 1155 as denominator so it is reduced to 10/21
+        l_accumulator -= t_fract8((int8_t)1, (int8_t)11);
+        l_ok &= quicky_test::check_expected(l_accumulator.get_nb_overflow_reductions(), (uint64_t)1, "reduction for 50/105 - 1/11");
+        l_ok &= quicky_test::check_expected(l_accumulator.normalize(), t_fract8((int8_t)89, (uint8_t)231), "1/3 + 1/5 - 1/5 + 1/7 - 1/11");
+        l_ok &= quicky_test::check_expected(fract_accumulator<uint8_t>().normalize(), t_fract8(), "empty accumulator");
+
+        // Unreduced common denominator of 1/6, 1/10 and 1/14 is 840 so that
+        // 8 bits accumulators are reduced before third term
+        const int8_t l_denominators[4] = {6, 10, 14, 15};
+        bool l_small_ok = true;
+        uint64_t l_nb_reductions = 0;
+        for(unsigned int l_index = 0; l_index < 10000; ++l_index)
+        {
+            t_fract8 l_sum;
+            fract_accumulator<uint8_t> l_small_accumulator;
+            for(unsigned int l_term_index = 0; l_term_index < 3; ++l_term_index)
+            {
+                t_fract8 l_term((int8_t)(l_generator() & 1 ? 1 : -1), l_denominators[l_generator() % 4]);
+                l_sum += l_term;
+                l_small_accumulator += l_term;
+            }
+            l_small_ok &= l_small_accumulator.normalize() == l_sum;
+            l_nb_reductions += l_small_accumulator.get_nb_overflow_reductions();
+        }
+        l_ok &= quicky_test::check_expected(l_small_ok, true, "8 bits accumulators");
+        l_ok &= quicky_test::check_expected(l_nb_reductions > 0, true, "8 bits accumulators overflow reductions");
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF
@@ -0,0 +1,219 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include <random>
+#include <chrono>
+#include "fract_array.h"
+#include "quicky_test.h"
+#include "type_string.h"
+#include <vector>
+#include <algorithm>
+#include <limits>
+
+namespace quicky_utils
+{
+    /**
+     * Apply operations to arrays of random fractions with fract operators
+     * and with fract_array kernels, check that results are identical and
+     * compare speed
+     * @tparam T coefficient type
+     * @param p_size number of fractions
+     * @param p_generator random generator
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool check_fract_array(size_t p_size
+                          ,std::mt19937_64 & p_generator
+                          )
+    {
+        typedef fract<T> t_fract;
+        typedef typename t_fract::t_coef_num t_coef_num;
+        typedef typename t_fract::t_coef_den t_coef_den;
+        bool l_ok = true;
+        std::string l_type = type_string<T>::name();
+        auto l_elapsed = [](std::chrono::steady_clock::time_point p_start)
+        {
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - p_start).count();
+        };
+        // Lanes are compared with those of reduced fractions
+        auto l_same_lanes = [](const fract_array<T> & p_array
+                              ,const std::vector<t_fract> & p_fracts
+                              )
+        {
+            fract_array<T> l_reduced(p_fracts);
+            return std::equal(p_array.get_nums(), p_array.get_nums() + p_array.size(), l_reduced.get_nums()) && std::equal(p_array.get_dens(), p_array.get_dens() + p_array.size(), l_reduced.get_dens());
+        };
+
+        // Coefficients use a quarter of available bits so that sums and
+        // products never overflow
+        constexpr unsigned int l_bits = 8 * sizeof(t_coef_den) / 4;
+        std::vector<t_fract> l_fracts1(p_size);
+        std::vector<t_fract> l_fracts2(p_size);
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            t_coef_num l_num1 = (t_coef_num)(p_generator() % (1u << l_bits)) - (t_coef_num)(1u << (l_bits - 1));
+            t_coef_num l_num2 = (t_coef_num)(p_generator() % (1u << l_bits)) - (t_coef_num)(1u << (l_bits - 1));
+            l_fracts1[l_index] = t_fract(l_num1, (t_coef_den)(1 + p_generator() % ((1u << l_bits) - 1)));
+            l_fracts2[l_index] = t_fract(l_num2, (t_coef_den)(1 + p_generator() % ((1u << l_bits) - 1)));
+        }
+        fract_array<T> l_array1(l_fracts1);
+        fract_array<T> l_array2(l_fracts2);
+        std::vector<t_fract> l_expected(p_size);
+        fract_array<T> l_result;
+
+        auto l_start = std::chrono::steady_clock::now();
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            l_expected[l_index] = l_fracts1[l_index] + l_fracts2[l_index];
+        }
+        auto l_fract_add_time = l_elapsed(l_start);
+        l_start = std::chrono::steady_clock::now();
+        fract_array<T>::add(l_array1, l_array2, l_result);
+        auto l_array_add_time = l_elapsed(l_start);
+        l_ok &= quicky_test::check_expected(l_same_lanes(l_result, l_expected), true, "fract_array add " + l_type);
+        l_start = std::chrono::steady_clock::now();
+        fract_array<T>::add(l_array1, l_array2, l_result, false);
+        auto l_deferred_add_time = l_elapsed(l_start);
+        l_start = std::chrono::steady_clock::now();
+        l_result.normalize();
+        auto l_normalize_time = l_elapsed(l_start);
+        l_ok &= quicky_test::check_expected(l_same_lanes(l_result, l_expected), true, "fract_array deferred add " + l_type);
+
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            l_expected[l_index] = l_fracts1[l_index] - l_fracts2[l_index];
+        }
+        fract_array<T>::sub(l_array1, l_array2, l_result);
+        l_ok &= quicky_test::check_expected(l_same_lanes(l_result, l_expected), true, "fract_array sub " + l_type);
+
+        l_start = std::chrono::steady_clock::now();
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            l_expected[l_index] = l_fracts1[l_index] * l_fracts2[l_index];
+        }
+        auto l_fract_mul_time = l_elapsed(l_start);
+        l_start = std::chrono::steady_clock::now();
+        fract_array<T>::mul(l_array1, l_array2, l_result);
+        auto l_array_mul_time = l_elapsed(l_start);
+        // Products of reduced fractions are reduced without normalize
+        l_ok &= quicky_test::check_expected(l_same_lanes(l_result, l_expected), true, "fract_array mul " + l_type);
+
+        std::vector<int> l_expected_compare(p_size);
+        std::vector<int> l_compare(p_size);
+        l_start = std::chrono::steady_clock::now();
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            l_expected_compare[l_index] = l_fracts1[l_index].compare(l_fracts2[l_index]);
+        }
+        auto l_fract_compare_time = l_elapsed(l_start);
+        l_start = std::chrono::steady_clock::now();
+        fract_array<T>::compare(l_array1, l_array2, l_compare.data());
+        auto l_array_compare_time = l_elapsed(l_start);
+        l_ok &= quicky_test::check_expected(l_compare == l_expected_compare, true, "fract_array compare " + l_type);
+
+        std::vector<double> l_expected_double(p_size);
+        std::vector<double> l_double(p_size);
+        l_start = std::chrono::steady_clock::now();
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            l_expected_double[l_index] = l_fracts1[l_index].to_double();
+        }
+        auto l_fract_double_time = l_elapsed(l_start);
+        l_start = std::chrono::steady_clock::now();
+        l_array1.to_double(l_double.data());
+        auto l_array_double_time = l_elapsed(l_start);
+        l_ok &= quicky_test::check_expected(l_double == l_expected_double, true, "fract_array to_double " + l_type);
+        fract_array<T> l_round_trip = fract_array<T>::from_double(l_double.data(), l_double.size(), (t_coef_den)((1u << l_bits) - 1));
+        l_ok &= quicky_test::check_expected(l_same_lanes(l_round_trip, l_fracts1), true, "fract_array from_double " + l_type);
+
+        // Results can be aliased with operands
+        fract_array<T> l_aliased(l_array1);
+        fract_array<T>::add(l_aliased, l_array2, l_aliased);
+        fract_array<T>::mul(l_aliased, l_array2, l_aliased);
+        bool l_aliased_ok = true;
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            t_fract l_sum = l_fracts1[l_index] + l_fracts2[l_index];
+            l_aliased_ok &= l_aliased.get(l_index) == l_sum * l_fracts2[l_index];
+        }
+        l_ok &= quicky_test::check_expected(l_aliased_ok, true, "fract_array aliased operands " + l_type);
+
+        quicky_test::get_bench_ostream() << p_size << " " << l_type << " fractions: add fract " << l_fract_add_time << " us, array " << l_array_add_time << " us, deferred " << l_deferred_add_time << " us + normalize " << l_normalize_time << " us. mul fract " << l_fract_mul_time << " us, array " << l_array_mul_time << " us. compare fract " << l_fract_compare_time << " us, array " << l_array_compare_time << " us. to_double fract " << l_fract_double_time << " us, array " << l_array_double_time << " us" << std::endl;
+        return l_ok;
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    test_fract_array()
+    {
+        bool l_ok = true;
+        std::mt19937_64 l_generator(46);
+
+        // Batched PGCD against scalar one, including null numbers and powers
+        // of two, with a size that is not a multiple of blocks
+        typedef fract_array<uint32_t>::t_coef_den t_coef_den;
+        std::vector<t_coef_den> l_a(1003);
+        std::vector<t_coef_den> l_b(l_a.size());
+        std::vector<t_coef_den> l_pgcd(l_a.size());
+        for(size_t l_index = 0; l_index < l_a.size(); ++l_index)
+        {
+            t_coef_den l_common = (t_coef_den)1u << (l_generator() % 8);
+            l_a[l_index] = l_index % 7 ? (t_coef_den)(l_generator() % 100000) * l_common : 0;
+            l_b[l_index] = (t_coef_den)(1 + l_generator() % 100000) * l_common;
+        }
+        l_a[1] = 0x80000000u;
+        l_b[1] = 0x80000000u;
+        l_b[2] = 0xFFFFFFFFu;
+        fract_array<uint32_t>::PGCD(l_a.data(), l_b.data(), l_pgcd.data(), l_a.size());
+        bool l_pgcd_ok = true;
+        for(size_t l_index = 0; l_index < l_a.size(); ++l_index)
+        {
+            l_pgcd_ok &= l_pgcd[l_index] == fract<uint32_t>::PGCD(l_a[l_index], l_b[l_index]);
+        }
+        l_ok &= quicky_test::check_expected(l_pgcd_ok, true, "batched PGCD");
+
+        // Null and extreme values
+        typedef fract<uint32_t> t_fract;
+        fract_array<uint32_t> l_extremes({t_fract(), t_fract(std::numeric_limits<int32_t>::min()), t_fract(std::numeric_limits<int32_t>::max(), 2u)});
+        fract_array<uint32_t> l_zeros(l_extremes.size());
+        fract_array<uint32_t> l_product;
+        fract_array<uint32_t>::mul(l_extremes, l_zeros, l_product);
+        l_ok &= quicky_test::check_expected(l_product.to_fracts() == std::vector<t_fract>(3), true, "products by 0");
+        fract_array<uint32_t>::add(l_extremes, l_zeros, l_product);
+        l_ok &= quicky_test::check_expected(l_product.to_fracts() == l_extremes.to_fracts(), true, "sums with 0");
+        l_ok &= quicky_test::check_expected(l_product.get(2), t_fract(std::numeric_limits<int32_t>::max(), 2u), "max / 2");
+
+        bool l_exception = false;
+        try
+        {
+            fract_array<uint32_t>::add(l_extremes, fract_array<uint32_t>(2), l_product);
+        }
+        catch(const quicky_exception::quicky_logic_exception & e)
+        {
+            l_exception = true;
+        }
+        l_ok &= quicky_test::check_expected(l_exception, true, "size mismatch");
+
+        l_ok &= check_fract_array<uint16_t>(quicky_test::get_bench_size(10000, 100000), l_generator);
+        l_ok &= check_fract_array<uint32_t>(quicky_test::get_bench_size(10000, 1000000), l_generator);
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF
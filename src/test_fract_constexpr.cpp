@@ -0,0 +1,134 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include <chrono>
+#include "fract.h"
+#include "quicky_test.h"
+#include <array>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstdint>
+
+namespace quicky_utils
+{
+    /**
+     * Compute values of logistic map 4 * x * (1 - x) for x = i / N so that
+     * all arithmetic operators are used to build the table
+     * @tparam T coefficient type
+     * @tparam N number of values
+     * @return table of values
+     */
+    template <typename T, size_t N>
+    constexpr
+    std::array<fract<T>, N> make_fract_logistic_table()
+    {
+        typedef fract<T> t_fract;
+        typedef typename t_fract::t_coef_den t_coef_den;
+        std::array<t_fract, N> l_table{};
+        t_fract l_x;
+        const t_fract l_step((t_coef_den)1u, (t_coef_den)N);
+        for(size_t l_index = 0; l_index < N; ++l_index)
+        {
+            l_table[l_index] = 4 * l_x * (1 - l_x);
+            l_x += l_step;
+        }
+        return l_table;
+    }
+
+    /**
+     * Check that table is symmetric and increasing on its first half
+     */
+    template <typename T, size_t N>
+    constexpr
+    bool check_fract_logistic_table(const std::array<fract<T>, N> & p_table)
+    {
+        for(size_t l_index = 1; l_index < N; ++l_index)
+        {
+            if(p_table[l_index] != p_table[N - l_index] || (l_index <= N / 2 && p_table[l_index - 1] >= p_table[l_index]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Table computed at compile time, stored in read only data
+     */
+    static constexpr std::array<fract<uint32_t>, 4096> g_fract_logistic_table = make_fract_logistic_table<uint32_t, 4096>();
+
+    static_assert(g_fract_logistic_table[1024] == fract<uint32_t>((uint32_t)3u, (uint32_t)4u), "logistic(1/4) == 3/4");
+    static_assert(g_fract_logistic_table[2048] == 1, "logistic(1/2) == 1");
+    static_assert(check_fract_logistic_table(g_fract_logistic_table), "logistic table symmetry");
+    static_assert(-fract<uint32_t>((uint32_t)1u, (int32_t)-2) / fract<uint32_t>((int32_t)-3, (int32_t)4) == fract<uint32_t>((int32_t)-2, (uint32_t)3u), "(1/2) / (-3/4) == -2/3");
+    static_assert(fract<uint32_t>((int32_t)-1, (int32_t)3) < fract<uint32_t>((int32_t)-1, (int32_t)4), "-1/3 < -1/4");
+
+#if defined(__linux__) && defined(__ELF__)
+    /**
+     * Indicate if an address belongs to memory mapped without write
+     * permission, meaning that data is not initialized at runtime
+     * @param p_address address to check
+     * @return true if memory is read only, false if it is writable or if
+     * mapping cannot be determined
+     */
+    bool is_read_only_memory(const void * p_address)
+    {
+        std::ifstream l_maps("/proc/self/maps");
+        uintptr_t l_address = (uintptr_t)p_address;
+        std::string l_line;
+        while(std::getline(l_maps, l_line))
+        {
+            std::istringstream l_stream(l_line);
+            uintptr_t l_start;
+            uintptr_t l_end;
+            char l_separator;
+            std::string l_permissions;
+            l_stream >> std::hex >> l_start >> l_separator >> l_end >> l_permissions;
+            if(l_start <= l_address && l_address < l_end)
+            {
+                return l_permissions.size() > 1 && 'r' == l_permissions[0] && '-' == l_permissions[1];
+            }
+        }
+        return false;
+    }
+#endif // __linux__ && __ELF__
+
+    //-------------------------------------------------------------------------
+    bool
+    test_fract_constexpr()
+    {
+        bool l_ok = true;
+        auto l_start = std::chrono::steady_clock::now();
+        std::array<fract<uint32_t>, 4096> l_table = make_fract_logistic_table<uint32_t, 4096>();
+        auto l_duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+        l_ok &= quicky_test::check_expected(l_table == g_fract_logistic_table, true, "compile time logistic table");
+        l_ok &= quicky_test::check_expected(check_fract_logistic_table(l_table), true, "runtime logistic table");
+#if defined(__linux__) && defined(__ELF__)
+        // Table initialized at compile time is placed in .rodata which is
+        // mapped without write permission
+        l_ok &= quicky_test::check_expected(is_read_only_memory(g_fract_logistic_table.data()), true, "logistic table in read only data");
+        l_ok &= quicky_test::check_expected(is_read_only_memory(&l_table), false, "runtime table in writable memory");
+#endif // __linux__ && __ELF__
+        quicky_test::get_bench_ostream() << "Logistic table of " << l_table.size() << " fractions: " << l_duration << " us at runtime, computed at compile time otherwise" << std::endl;
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF
@@ -0,0 +1,225 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include <random>
+#include <chrono>
+#include <thread>
+#include "fract_verifier.h"
+#include "fract.h"
+#include "quicky_test.h"
+#include <vector>
+#include <algorithm>
+#include <limits>
+
+namespace quicky_utils
+{
+    /**
+     * Compare element-wise additions of random fractions without and with
+     * sampled verification as done by fract operators when
+     * FRACT_SAMPLED_CHECK is defined
+     * @param p_size number of fractions
+     * @param p_generator random generator
+     * @return true if test is successfull
+     */
+    bool bench_fract_verifier(size_t p_size
+                             ,std::mt19937_64 & p_generator
+                             )
+    {
+        typedef fract<uint32_t> t_fract;
+        bool l_ok = true;
+        std::vector<t_fract> l_fracts1(p_size);
+        std::vector<t_fract> l_fracts2(p_size);
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            l_fracts1[l_index] = t_fract((int32_t)(p_generator() % 16384) - 8192, (uint32_t)(1 + p_generator() % 16383));
+            l_fracts2[l_index] = t_fract((int32_t)(p_generator() % 16384) - 8192, (uint32_t)(1 + p_generator() % 16383));
+        }
+        std::vector<t_fract> l_results(p_size);
+        auto l_bench = [&](bool p_verify)
+        {
+            auto l_start = std::chrono::steady_clock::now();
+            for(size_t l_index = 0; l_index < p_size; ++l_index)
+            {
+                t_fract l_result = l_fracts1[l_index] + l_fracts2[l_index];
+                if(p_verify)
+                {
+                    fract_verifier::verify(fract_verifier::operation_t::ADD, l_fracts1[l_index], l_fracts2[l_index], l_result);
+                }
+                l_results[l_index] = l_result;
+            }
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+        };
+        // Best of several interleaved runs to reduce noise
+        auto l_best = std::numeric_limits<decltype(l_bench(false))>::max();
+        auto l_best_verified = l_best;
+        uint64_t l_nb_checks = fract_verifier::get_nb_checks();
+        uint64_t l_nb_mismatches = fract_verifier::get_nb_mismatches();
+        for(unsigned int l_run = 0; l_run < 5; ++l_run)
+        {
+            l_best = std::min(l_best, l_bench(false));
+            l_best_verified = std::min(l_best_verified, l_bench(true));
+        }
+        // Operators sample additions themselves when FRACT_SAMPLED_CHECK is
+        // defined
+#ifdef FRACT_SAMPLED_CHECK
+        const uint64_t l_nb_operator_samples = 1;
+#else // FRACT_SAMPLED_CHECK
+        const uint64_t l_nb_operator_samples = 0;
+#endif // FRACT_SAMPLED_CHECK
+        uint64_t l_expected_checks = 5 * p_size * (2 * l_nb_operator_samples + 1) / fract_verifier::get_period();
+        l_nb_checks = fract_verifier::get_nb_checks() - l_nb_checks;
+        l_ok &= quicky_test::check_expected(l_nb_checks >= l_expected_checks && l_nb_checks <= l_expected_checks + 1, true, "sampled checks");
+        l_ok &= quicky_test::check_expected(fract_verifier::get_nb_mismatches(), l_nb_mismatches, "no mismatch");
+        quicky_test::get_bench_ostream() << p_size << " fract<uint32_t> additions: " << l_best << " us, verified 1 out of " << fract_verifier::get_period() << ": " << l_best_verified << " us (" << 100.0 * ((double)l_best_verified - (double)l_best) / (double)l_best << "%)" << std::endl;
+        return l_ok;
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    test_fract_verifier()
+    {
+        bool l_ok = true;
+        typedef fract_verifier::operation_t operation_t;
+        fract_verifier::mismatch l_mismatch{};
+        // Queue may hold mismatches of instrumented code
+        while(fract_verifier::pop_mismatch(l_mismatch))
+        {
+        }
+
+        // Rounding errors and cancellation are tolerated, wrong results and
+        // NaN are not
+        l_ok &= quicky_test::check_expected(fract_verifier::check(operation_t::ADD, 0.1, 0.2, 0.3), true, "0.1 + 0.2");
+        l_ok &= quicky_test::check_expected(fract_verifier::check(operation_t::SUB, 1.0 + 1e-16, 1.0, 1e-16), true, "cancellation");
+        l_ok &= quicky_test::check_expected(fract_verifier::check(operation_t::MUL, 1.0 / 3.0, 3.0, 1.0), true, "1 / 3 * 3");
+        l_ok &= quicky_test::check_expected(fract_verifier::check(operation_t::DIV, 1.0, 3.0, 1.0 / 3.0), true, "1 / 3");
+        uint64_t l_nb_mismatches = fract_verifier::get_nb_mismatches();
+        l_ok &= quicky_test::check_expected(fract_verifier::check(operation_t::MUL, 300.0, 300.0, 24464.0), false, "wrong product");
+        l_ok &= quicky_test::check_expected(fract_verifier::check(operation_t::DIV, 1.0, 0.0, std::nan("")), false, "NaN");
+        l_ok &= quicky_test::check_expected(fract_verifier::get_nb_mismatches(), l_nb_mismatches + 2, "mismatch count");
+        l_ok &= quicky_test::check_expected(fract_verifier::pop_mismatch(l_mismatch) && operation_t::MUL == l_mismatch.m_operation && 90000.0 == l_mismatch.m_expected && 24464.0 == l_mismatch.m_result, true, "recorded mismatch");
+        l_ok &= quicky_test::check_expected(fract_verifier::pop_mismatch(l_mismatch) && operation_t::DIV == l_mismatch.m_operation, true, "recorded NaN");
+        l_ok &= quicky_test::check_expected(fract_verifier::pop_mismatch(l_mismatch), false, "empty queue");
+
+        // Sampling period, countdown of thread is synchronised first
+        uint32_t l_period = fract_verifier::get_period();
+        fract_verifier::set_period(8);
+        while(!fract_verifier::sample())
+        {
+        }
+        unsigned int l_nb_sampled = 0;
+        for(unsigned int l_index = 0; l_index < 8000; ++l_index)
+        {
+            l_nb_sampled += fract_verifier::sample();
+        }
+        l_ok &= quicky_test::check_expected(l_nb_sampled, 1000u, "1 out of 8");
+        // Current period of thread ends before period is read again
+        fract_verifier::set_period(0);
+        for(unsigned int l_index = 0; l_index < 8; ++l_index)
+        {
+            (void)fract_verifier::sample();
+        }
+        l_nb_sampled = 0;
+        for(unsigned int l_index = 0; l_index < 8000; ++l_index)
+        {
+            l_nb_sampled += fract_verifier::sample();
+        }
+        l_ok &= quicky_test::check_expected(l_nb_sampled, 0u, "disabled");
+
+        // Overflow of fract<uint16_t> coefficients is reported when every
+        // operation is verified
+        fract_verifier::set_period(1);
+        while(!fract_verifier::sample())
+        {
+        }
+        // Results are built without operators which are verified too when
+        // FRACT_SAMPLED_CHECK is defined
+        typedef fract<uint16_t> t_fract16;
+        t_fract16 l_op((int16_t)300);
+        fract_verifier::verify(operation_t::MUL, l_op, l_op, t_fract16((int16_t)(90000 % 65536)));
+        l_ok &= quicky_test::check_expected(fract_verifier::pop_mismatch(l_mismatch) && 90000.0 == l_mismatch.m_expected, true, "fract<uint16_t> overflow");
+        fract_verifier::verify(operation_t::ADD, l_op, l_op, t_fract16((int16_t)600));
+        l_ok &= quicky_test::check_expected(fract_verifier::pop_mismatch(l_mismatch), false, "fract<uint16_t> 300 + 300");
+
+        // Mismatches beyond capacity are dropped, others are read in order
+        uint64_t l_nb_dropped = fract_verifier::get_nb_dropped();
+        for(unsigned int l_index = 0; l_index < fract_verifier::m_capacity + 10; ++l_index)
+        {
+            (void)fract_verifier::check(operation_t::ADD, l_index, 0.0, -1.0);
+        }
+        l_ok &= quicky_test::check_expected(fract_verifier::get_nb_dropped(), l_nb_dropped + 10, "dropped mismatches");
+        bool l_order_ok = true;
+        for(unsigned int l_index = 0; l_index < fract_verifier::m_capacity; ++l_index)
+        {
+            l_order_ok &= fract_verifier::pop_mismatch(l_mismatch) && (double)l_index == l_mismatch.m_op1;
+        }
+        l_order_ok &= !fract_verifier::pop_mismatch(l_mismatch);
+        l_ok &= quicky_test::check_expected(l_order_ok, true, "mismatch order");
+
+        // Concurrent producers and consumer: each mismatch is read once or
+        // counted as dropped
+        const unsigned int l_nb_threads = 4;
+        const unsigned int l_nb_per_thread = 20000;
+        l_nb_dropped = fract_verifier::get_nb_dropped();
+        std::vector<std::thread> l_threads;
+        for(unsigned int l_thread = 0; l_thread < l_nb_threads; ++l_thread)
+        {
+            l_threads.emplace_back([=]
+            {
+                for(unsigned int l_index = 0; l_index < l_nb_per_thread; ++l_index)
+                {
+                    (void)fract_verifier::check(operation_t::ADD, l_thread * l_nb_per_thread + l_index, 0.0, -1.0);
+                }
+            });
+        }
+        std::vector<bool> l_read(l_nb_threads * l_nb_per_thread, false);
+        bool l_unique = true;
+        size_t l_nb_read = 0;
+        auto l_drain = [&]
+        {
+            while(fract_verifier::pop_mismatch(l_mismatch))
+            {
+                size_t l_id = (size_t)l_mismatch.m_op1;
+                l_unique &= l_id < l_read.size() && !l_read[l_id] && -1.0 == l_mismatch.m_result;
+                if(l_id < l_read.size())
+                {
+                    l_read[l_id] = true;
+                }
+                ++l_nb_read;
+            }
+        };
+        while(l_nb_read + fract_verifier::get_nb_dropped() - l_nb_dropped < l_nb_threads * l_nb_per_thread)
+        {
+            l_drain();
+        }
+        for(auto & l_iter: l_threads)
+        {
+            l_iter.join();
+        }
+        l_drain();
+        l_ok &= quicky_test::check_expected(l_unique, true, "concurrent mismatches read once");
+        l_ok &= quicky_test::check_expected(l_nb_read + fract_verifier::get_nb_dropped() - l_nb_dropped, (size_t)(l_nb_threads * l_nb_per_thread), "concurrent mismatches read or dropped");
+
+        fract_verifier::set_period(l_period);
+        std::mt19937_64 l_generator(50);
+        l_ok &= bench_fract_verifier(quicky_test::get_bench_size(10000, 1000000), l_generator);
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF
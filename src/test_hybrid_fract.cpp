@@ -0,0 +1,220 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include <random>
+#include <chrono>
+#include "safe_types.h"
+#include "hybrid_fract.h"
+#include "quicky_test.h"
+#include "quicky_exception.h"
+#include <vector>
+#include <limits>
+
+namespace quicky_utils
+{
+    typedef hybrid_fract<uint32_t> t_hybrid_fract32;
+
+    /**
+     * Check an operation against the one of wide fractions and check that
+     * result is promoted only when it does not fit in inline fraction
+     * @param p_op1 first operand
+     * @param p_op2 second operand
+     * @param p_operator operator
+     * @return true if test is successfull
+     */
+    bool check_hybrid_fract_operation(const t_hybrid_fract32 & p_op1
+                                     ,const t_hybrid_fract32 & p_op2
+                                     ,char p_operator
+                                     )
+    {
+        t_hybrid_fract32::t_wide_fract l_op1 = p_op1.to_wide_fract();
+        t_hybrid_fract32::t_wide_fract l_op2 = p_op2.to_wide_fract();
+        t_hybrid_fract32 l_result;
+        t_hybrid_fract32::t_wide_fract l_expected;
+        t_hybrid_fract32 l_assigned(p_op1);
+        switch(p_operator)
+        {
+            case '+': l_result = p_op1 + p_op2; l_expected = l_op1 + l_op2; l_assigned += p_op2; break;
+            case '-': l_result = p_op1 - p_op2; l_expected = l_op1 - l_op2; l_assigned -= p_op2; break;
+            case '*': l_result = p_op1 * p_op2; l_expected = l_op1 * l_op2; l_assigned *= p_op2; break;
+            case '/': l_result = p_op1 / p_op2; l_expected = l_op1 / l_op2; l_assigned /= p_op2; break;
+            default: throw quicky_exception::quicky_logic_exception("Unsupported operator '" + std::string(1, p_operator) +"'", __LINE__, __FILE__);
+        }
+        t_hybrid_fract32 l_hybrid_expected(l_expected);
+        return l_result.to_wide_fract() == l_expected && l_result.is_promoted() == l_hybrid_expected.is_promoted() && l_assigned == l_result;
+    }
+
+    /**
+     * Compare element-wise additions and multiplications of fractions whose
+     * results never overflow with fract, fract of safe coefficients and
+     * hybrid fract
+     * @param p_size number of fractions
+     * @param p_generator random generator
+     * @return true if test is successfull
+     */
+    bool bench_hybrid_fract(size_t p_size
+                           ,std::mt19937_64 & p_generator
+                           )
+    {
+        typedef fract<uint32_t> t_fract;
+        typedef fract<safe_uint<uint32_t>> t_safe_fract;
+        bool l_ok = true;
+        std::vector<t_fract> l_fracts1(p_size);
+        std::vector<t_fract> l_fracts2(p_size);
+        std::vector<t_safe_fract> l_safe_fracts1(p_size);
+        std::vector<t_safe_fract> l_safe_fracts2(p_size);
+        std::vector<t_hybrid_fract32> l_hybrid_fracts1(p_size);
+        std::vector<t_hybrid_fract32> l_hybrid_fracts2(p_size);
+        auto l_random = [&](t_fract & p_fract
+                           ,t_safe_fract & p_safe_fract
+                           ,t_hybrid_fract32 & p_hybrid_fract
+                           )
+        {
+            // Coefficients of 14 bits so that results fit in 32 bits
+            int32_t l_num = (int32_t)(p_generator() % 16384) - 8192;
+            uint32_t l_den = (uint32_t)(1 + p_generator() % 16383);
+            p_fract = t_fract(l_num, l_den);
+            p_safe_fract = t_safe_fract(t_safe_fract::t_coef_num(l_num), t_safe_fract::t_coef_den(l_den));
+            p_hybrid_fract = p_fract;
+        };
+        for(size_t l_index = 0; l_index < p_size; ++l_index)
+        {
+            l_random(l_fracts1[l_index], l_safe_fracts1[l_index], l_hybrid_fracts1[l_index]);
+            l_random(l_fracts2[l_index], l_safe_fracts2[l_index], l_hybrid_fracts2[l_index]);
+        }
+        auto l_bench = [&](const auto & p_fracts1
+                          ,const auto & p_fracts2
+                          ,char p_operator
+                          )
+        {
+            typedef typename std::decay<decltype(p_fracts1)>::type t_vector;
+            t_vector l_results(p_fracts1.size());
+            auto l_start = std::chrono::steady_clock::now();
+            for(size_t l_index = 0; l_index < p_fracts1.size(); ++l_index)
+            {
+                l_results[l_index] = '+' == p_operator ? p_fracts1[l_index] + p_fracts2[l_index] : p_fracts1[l_index] * p_fracts2[l_index];
+            }
+            auto l_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+            return std::make_pair(std::move(l_results), l_time);
+        };
+        for(char l_operator: {'+', '*'})
+        {
+            auto l_fract = l_bench(l_fracts1, l_fracts2, l_operator);
+            auto l_safe = l_bench(l_safe_fracts1, l_safe_fracts2, l_operator);
+            auto l_hybrid = l_bench(l_hybrid_fracts1, l_hybrid_fracts2, l_operator);
+            bool l_same = true;
+            for(size_t l_index = 0; l_index < p_size; ++l_index)
+            {
+                l_same &= !l_hybrid.first[l_index].is_promoted() && l_hybrid.first[l_index].get_fract() == l_fract.first[l_index];
+                l_same &= l_safe.first[l_index].to_double() == l_fract.first[l_index].to_double();
+            }
+            l_ok &= quicky_test::check_expected(l_same, true, std::string("bench hybrid_fract ") + l_operator);
+            quicky_test::get_bench_ostream() << p_size << " fractions '" << l_operator << "': fract<uint32_t> " << l_fract.second << " us, fract<safe_uint<uint32_t>> " << l_safe.second << " us, hybrid_fract<uint32_t> " << l_hybrid.second << " us" << std::endl;
+        }
+        return l_ok;
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    test_hybrid_fract()
+    {
+        bool l_ok = true;
+        typedef t_hybrid_fract32::t_fract t_fract;
+        typedef t_hybrid_fract32::t_wide_fract t_wide_fract;
+        const int32_t l_min = std::numeric_limits<int32_t>::min();
+        const int32_t l_max = std::numeric_limits<int32_t>::max();
+        const uint32_t l_max_den = std::numeric_limits<uint32_t>::max();
+
+        // H(30) = 9304682830147 / 2329089562800 silently overflows
+        // fract<uint32_t> but is computed exactly by promotion
+        t_fract l_fract_sum;
+        t_hybrid_fract32 l_sum;
+        for(uint32_t l_index = 1; l_index <= 30; ++l_index)
+        {
+            l_fract_sum += t_fract(1, l_index);
+            l_sum += t_fract(1, l_index);
+        }
+        t_hybrid_fract32 l_harmonic(t_wide_fract((int64_t)9304682830147, (uint64_t)2329089562800));
+        l_ok &= quicky_test::check_expected(l_sum.is_promoted(), true, "H(30) promoted");
+        l_ok &= quicky_test::check_expected(l_sum == l_harmonic, true, "H(30)");
+        l_ok &= quicky_test::check_expected(l_sum == t_hybrid_fract32(l_fract_sum), false, "H(30) overflows fract<uint32_t>");
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([&]{(void)l_sum.get_fract();}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        for(uint32_t l_index = 30; l_index > 1; --l_index)
+        {
+            l_sum -= t_fract(1, l_index);
+        }
+        l_ok &= quicky_test::check_expected(l_sum.is_promoted(), false, "H(30) - H(30) + 1 demoted");
+        l_ok &= quicky_test::check_expected(l_sum.get_fract(), t_fract(1), "H(30) - H(30) + 1");
+
+        // Product exceeds 32 bits and division brings it back
+        t_hybrid_fract32 l_square = t_hybrid_fract32(t_fract(1, 65536u)) * t_hybrid_fract32(t_fract(1, 65536u));
+        l_ok &= quicky_test::check_expected(l_square.is_promoted(), true, "promotion on multiplication");
+        l_ok &= quicky_test::check_expected(l_square.to_double(), 1.0 / 4294967296.0, "promoted value");
+        l_ok &= quicky_test::check_expected((l_square / t_hybrid_fract32(t_fract(1, 65536u))).get_fract(), t_fract(1, 65536u), "demotion on division");
+        l_ok &= quicky_test::check_expected((-t_hybrid_fract32(t_fract(l_min))).is_promoted(), true, "promotion on negation");
+        l_ok &= quicky_test::check_expected((-(-t_hybrid_fract32(t_fract(l_min)))).get_fract(), t_fract(l_min), "double negation");
+
+        // Promoted operands
+        t_hybrid_fract32 l_third(t_fract(1, 3u));
+        l_ok &= quicky_test::check_expected((l_harmonic + l_third) - l_third, l_harmonic, "(H(30) + 1 / 3) - 1 / 3");
+        l_ok &= quicky_test::check_expected((l_harmonic * l_third) / l_third, l_harmonic, "(H(30) * 1 / 3) / (1 / 3)");
+        l_ok &= quicky_test::check_expected(l_harmonic / l_harmonic, t_hybrid_fract32(t_fract(1)), "H(30) / H(30)");
+        l_ok &= quicky_test::check_expected(l_square < t_hybrid_fract32(t_fract(1, l_max_den)) && -l_harmonic > t_hybrid_fract32(t_fract(-4)), true, "compare promoted");
+        l_ok &= quicky_test::check_expected(t_hybrid_fract32(t_fract(l_max)) + t_hybrid_fract32(t_fract(l_max)), t_hybrid_fract32(t_wide_fract((int64_t)l_max * 2)), "max + max");
+
+        // Operations on operands around boundaries and on random operands.
+        // Numerators have 30 bits so that wide fractions do not overflow
+        const int32_t l_max30 = (1 << 30) - 1;
+        std::vector<t_hybrid_fract32> l_operands{t_fract(), t_fract(1), t_fract(-1), t_fract(l_max30), t_fract(-l_max30 - 1), t_fract(1, l_max_den), t_fract(-1, l_max_den), t_fract(l_max30, l_max_den), t_fract(-l_max30 - 1, l_max_den - 2), t_fract(1, 2u)};
+        std::mt19937_64 l_generator(49);
+        for(unsigned int l_index = 0; l_index < 50; ++l_index)
+        {
+            l_operands.push_back(t_fract((int32_t)(l_generator() >> 34) - (1 << 29), (uint32_t)(1 + (l_generator() >> (32 + l_generator() % 32)))));
+        }
+        bool l_operations_ok = true;
+        for(const auto & l_op1: l_operands)
+        {
+            for(const auto & l_op2: l_operands)
+            {
+                for(char l_operator: {'+', '-', '*'})
+                {
+                    l_operations_ok &= check_hybrid_fract_operation(l_op1, l_op2, l_operator);
+                }
+                if(l_op2)
+                {
+                    l_operations_ok &= check_hybrid_fract_operation(l_op1, l_op2, '/');
+                }
+                l_operations_ok &= l_op1.compare(l_op2) == l_op1.to_wide_fract().compare(l_op2.to_wide_fract());
+            }
+        }
+        l_ok &= quicky_test::check_expected(l_operations_ok, true, "operations");
+
+        // Promoted coefficients overflow
+        t_hybrid_fract32 l_tiny(t_wide_fract((int64_t)1, (uint64_t)1 << 40));
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([&]{l_tiny * l_tiny;}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        // Wide sum overflows before reduction and its exact value does not fit
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([&]{t_hybrid_fract32(t_fract(l_min, l_max_den)) + t_hybrid_fract32(t_fract(l_min, l_max_den - 2));}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([&]{t_hybrid_fract32(t_fract(1)) / t_hybrid_fract32();}, true, quicky_test::auto_message(__FILE__, __LINE__));
+
+        l_ok &= bench_hybrid_fract(quicky_test::get_bench_size(10000, 1000000), l_generator);
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF
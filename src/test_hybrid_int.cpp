@@ -0,0 +1,174 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include <random>
+#include <chrono>
+#include "hybrid_int.h"
+#include "safe_types.h"
+#include "quicky_test.h"
+#include "quicky_exception.h"
+
+namespace quicky_utils
+{
+    /**
+     * Check an operation against ext_int and check that result is promoted
+     * only when it does not fit in 64 bits
+     * @param p_op1 first operand
+     * @param p_op2 second operand
+     * @param p_operator operator
+     * @return true if test is successfull
+     */
+    bool check_hybrid_operation(const hybrid_int & p_op1
+                               ,const hybrid_int & p_op2
+                               ,char p_operator
+                               )
+    {
+        hybrid_int::ext_type l_op1 = p_op1.to_ext_int();
+        hybrid_int::ext_type l_op2 = p_op2.to_ext_int();
+        hybrid_int l_result;
+        hybrid_int::ext_type l_expected;
+        hybrid_int l_assigned(p_op1);
+        switch(p_operator)
+        {
+            case '+': l_result = p_op1 + p_op2; l_expected = l_op1 + l_op2; l_assigned += p_op2; break;
+            case '-': l_result = p_op1 - p_op2; l_expected = l_op1 - l_op2; l_assigned -= p_op2; break;
+            case '*': l_result = p_op1 * p_op2; l_expected = l_op1 * l_op2; l_assigned *= p_op2; break;
+            case '/': l_result = p_op1 / p_op2; l_expected = l_op1 / l_op2; l_assigned /= p_op2; break;
+            case '%': l_result = p_op1 % p_op2; l_expected = l_op1 % l_op2; l_assigned %= p_op2; break;
+            default: throw quicky_exception::quicky_logic_exception("Unsupported operator '" + std::string(1, p_operator) +"'", __LINE__, __FILE__);
+        }
+        bool l_fits = l_expected >= hybrid_int::ext_type(std::numeric_limits<int64_t>::min()) && l_expected <= hybrid_int::ext_type(std::numeric_limits<int64_t>::max());
+        return l_result.to_ext_int() == l_expected && l_result.is_promoted() != l_fits && l_assigned == l_result;
+    }
+
+    /**
+     * Compare accumulation loops on built-in, safe, hybrid and extensible
+     * integers
+     * @param p_nb_iterations number of iterations
+     * @return true if test is successfull
+     */
+    bool bench_hybrid_int(size_t p_nb_iterations)
+    {
+        bool l_ok = true;
+        std::vector<int64_t> l_values(1024);
+        std::mt19937_64 l_generator(40);
+        for(auto & l_iter: l_values)
+        {
+            l_iter = (int64_t)(l_generator() % 2001) - 1000;
+        }
+        auto l_bench = [&](auto p_zero)
+        {
+            typedef decltype(p_zero) t_type;
+            auto l_start = std::chrono::steady_clock::now();
+            t_type l_sum(p_zero);
+            for(size_t l_index = 0; l_index < p_nb_iterations; ++l_index)
+            {
+                l_sum += t_type(l_values[l_index & 1023]) * t_type(l_values[(l_index + 1) & 1023]);
+            }
+            auto l_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+            return std::make_pair(l_sum, l_time);
+        };
+        auto l_builtin = l_bench((int64_t)0);
+        auto l_safe = l_bench(safe_int64_t(0));
+        auto l_hybrid = l_bench(hybrid_int(0));
+        auto l_ext = l_bench(ext_int<int64_t>((int64_t)0));
+        l_ok &= quicky_test::check_expected(l_safe.first.get_value(), l_builtin.first, "bench safe_int");
+        l_ok &= quicky_test::check_expected(l_hybrid.first.get_value(), l_builtin.first, "bench hybrid_int");
+        l_ok &= quicky_test::check_expected(l_ext.first, ext_int<int64_t>(l_builtin.first), "bench ext_int");
+        quicky_test::get_bench_ostream() << p_nb_iterations << " multiply-accumulate: int64_t " << l_builtin.second << " us, safe_int64_t " << l_safe.second << " us, hybrid_int " << l_hybrid.second << " us, ext_int<int64_t> " << l_ext.second << " us" << std::endl;
+        return l_ok;
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    test_hybrid_int()
+    {
+        bool l_ok = true;
+        const int64_t l_min = std::numeric_limits<int64_t>::min();
+        const int64_t l_max = std::numeric_limits<int64_t>::max();
+
+        // Promotion on overflow and demotion when value fits again
+        hybrid_int l_value(l_max);
+        l_value += 1;
+        l_ok &= quicky_test::check_expected(l_value.is_promoted(), true, "promotion on addition");
+        l_ok &= quicky_test::check_expected(l_value.to_string(), std::string("9223372036854775808"), "promoted value");
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([&]{(void)l_value.get_value();}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        l_value -= 2;
+        l_ok &= quicky_test::check_expected(l_value.is_promoted(), false, "demotion on substraction");
+        l_ok &= quicky_test::check_expected(l_value.get_value(), l_max - 1, "demoted value");
+        l_ok &= quicky_test::check_expected((-hybrid_int(l_min)).is_promoted(), true, "promotion on negation");
+        l_ok &= quicky_test::check_expected(-(-hybrid_int(l_min)), hybrid_int(l_min), "double negation");
+        l_ok &= quicky_test::check_expected(hybrid_int(l_min) / hybrid_int(-1) / hybrid_int(-1), hybrid_int(l_min), "min / -1 / -1");
+        l_ok &= quicky_test::check_expected(hybrid_int(l_min) % hybrid_int(-1), hybrid_int(0), "min % -1");
+
+        // Factorial exceeds 64 bits and division brings it back
+        hybrid_int l_factorial(1);
+        for(int64_t l_index = 2; l_index <= 30; ++l_index)
+        {
+            l_factorial *= l_index;
+        }
+        l_ok &= quicky_test::check_expected(l_factorial.to_string(), std::string("265252859812191058636308480000000"), "30!");
+        l_ok &= quicky_test::check_expected(l_factorial > hybrid_int(l_max), true, "30! > max");
+        l_ok &= quicky_test::check_expected(-l_factorial < hybrid_int(l_min), true, "-30! < min");
+        for(int64_t l_index = 30; l_index > 20; --l_index)
+        {
+            l_factorial /= l_index;
+        }
+        l_ok &= quicky_test::check_expected(l_factorial.is_promoted(), false, "20! demoted");
+        l_ok &= quicky_test::check_expected(l_factorial.get_value(), (int64_t)2432902008176640000, "20!");
+
+        // Operations on operands around boundaries
+        std::vector<hybrid_int> l_operands{hybrid_int(0), hybrid_int(1), hybrid_int(-1), hybrid_int(2), hybrid_int(-3), hybrid_int(l_max), hybrid_int(l_min), hybrid_int(l_max / 2), hybrid_int(l_min / 2), hybrid_int(3037000499), hybrid_int(-3037000500)};
+        l_operands.push_back(hybrid_int(l_max) + hybrid_int(1));
+        l_operands.push_back(hybrid_int(l_min) - hybrid_int(1));
+        hybrid_int l_square_max = hybrid_int(l_max) * hybrid_int(l_max);
+        l_operands.push_back(l_square_max);
+        std::mt19937_64 l_generator(40);
+        for(unsigned int l_index = 0; l_index < 50; ++l_index)
+        {
+            l_operands.push_back(hybrid_int((int64_t)l_generator() >> (l_generator() % 64)));
+        }
+        bool l_operations_ok = true;
+        for(const auto & l_op1: l_operands)
+        {
+            for(const auto & l_op2: l_operands)
+            {
+                for(char l_operator: {'+', '-', '*'})
+                {
+                    l_operations_ok &= check_hybrid_operation(l_op1, l_op2, l_operator);
+                }
+                if(l_op2)
+                {
+                    l_operations_ok &= check_hybrid_operation(l_op1, l_op2, '/');
+                    l_operations_ok &= check_hybrid_operation(l_op1, l_op2, '%');
+                }
+                l_operations_ok &= l_op1.compare(l_op2) == l_op1.to_ext_int().compare(l_op2.to_ext_int());
+            }
+        }
+        l_ok &= quicky_test::check_expected(l_operations_ok, true, "operations");
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([&]{hybrid_int(1) / hybrid_int(0);}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([&]{hybrid_int(1) % hybrid_int(0);}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([&]{l_square_max / hybrid_int(0);}, true, quicky_test::auto_message(__FILE__, __LINE__));
+
+        l_ok &= bench_hybrid_int(quicky_test::get_bench_size(100000, 10000000));
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF
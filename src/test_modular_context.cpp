@@ -0,0 +1,172 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include "modular_context.h"
+#include "quicky_test.h"
+#include "type_string.h"
+#include <iostream>
+#include <chrono>
+#include <random>
+
+namespace quicky_utils
+{
+    /**
+     * Reference square and multiply using ext_uint operators
+     * @tparam T limb type
+     * @param p_base base
+     * @param p_exponent exponent
+     * @param p_modulus modulus
+     * @return p_base ^ p_exponent mod p_modulus
+     */
+    template <typename T>
+    ext_uint<T> reference_powmod(const ext_uint<T> & p_base
+                                ,const ext_uint<T> & p_exponent
+                                ,const ext_uint<T> & p_modulus
+                                )
+    {
+        ext_uint<T> l_result({1});
+        ext_uint<T> l_base = p_base % p_modulus;
+        for(size_t l_index = p_exponent.bit_length(); l_index > 0; --l_index)
+        {
+            l_result = (l_result * l_result) % p_modulus;
+            if(p_exponent.test_bit(l_index - 1))
+            {
+                l_result = (l_result * l_base) % p_modulus;
+            }
+        }
+        return l_result % p_modulus;
+    }
+
+    /**
+     * Check modular_context against ext_uint operators
+     * @tparam T limb type
+     * @param p_modulus odd modulus
+     * @param p_op1 first operand
+     * @param p_op2 second operand, used as exponent
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool check_modular_context(const std::string & p_modulus
+                              ,const std::string & p_op1
+                              ,const std::string & p_op2
+                              )
+    {
+        bool l_ok = true;
+        ext_uint<T> l_modulus = ext_uint<T>::from_string(p_modulus);
+        ext_uint<T> l_op1 = ext_uint<T>::from_string(p_op1);
+        ext_uint<T> l_op2 = ext_uint<T>::from_string(p_op2);
+        modular_context<T> l_context(l_modulus);
+        std::string l_message = type_string<T>::name() + " " + p_op1 + " " + p_op2 + " mod " + p_modulus;
+
+        l_ok &= quicky_test::check_expected(l_context.mulmod(l_op1, l_op2), (l_op1 * l_op2) % l_modulus, "mulmod " + l_message);
+
+        ext_uint<T> l_base = l_op1 % l_modulus;
+        l_ok &= quicky_test::check_expected(l_context.powmod(l_op1, l_op2), reference_powmod(l_op1, l_op2, l_modulus), "powmod " + l_message);
+
+        ext_uint<T> l_inverse = l_context.invmod(l_op1);
+        l_ok &= quicky_test::check_expected((l_inverse * l_op1) % l_modulus, ext_uint<T>({1}), "invmod " + l_message);
+        l_ok &= quicky_test::check_expected(l_inverse < l_modulus, true, "invmod range " + l_message);
+
+        std::vector<T> l_montgomery(l_context.get_size());
+        l_context.to_montgomery(&l_montgomery[0], l_op1);
+        l_ok &= quicky_test::check_expected(l_context.from_montgomery(&l_montgomery[0]), l_base, "Montgomery round trip " + l_message);
+        return l_ok;
+    }
+
+    /**
+     * Report time of modular exponentiation with modular_context and with
+     * ext_uint operators for a given modulus size
+     * @param p_nb_bits size in bits of modulus, base and exponent
+     * @param p_generator random generator
+     * @return true if both exponentiations give same result
+     */
+    bool bench_modular_context(size_t p_nb_bits
+                              ,std::mt19937_64 & p_generator
+                              )
+    {
+        std::vector<uint64_t> l_limbs(p_nb_bits / 64);
+        auto l_random = [&]()
+        {
+            for(auto & l_iter: l_limbs)
+            {
+                l_iter = p_generator();
+            }
+            l_limbs.back() |= ((uint64_t)1) << 63;
+            l_limbs.front() |= 1;
+            return ext_uint<uint64_t>::from_limbs(l_limbs.data(), l_limbs.size());
+        };
+        ext_uint<uint64_t> l_modulus = l_random();
+        ext_uint<uint64_t> l_base = l_random() % l_modulus;
+        ext_uint<uint64_t> l_exponent = l_random();
+        auto l_time = [&](auto p_function)
+        {
+            auto l_start = std::chrono::steady_clock::now();
+            p_function();
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+        };
+        ext_uint<uint64_t> l_montgomery;
+        ext_uint<uint64_t> l_reference;
+        auto l_montgomery_time = l_time([&]{modular_context<uint64_t> l_context(l_modulus); l_montgomery = l_context.powmod(l_base, l_exponent);});
+        auto l_reference_time = l_time([&]{l_reference = reference_powmod(l_base, l_exponent, l_modulus);});
+        quicky_test::get_bench_ostream() << p_nb_bits << " bits powmod: modular_context " << l_montgomery_time << " us, ext_uint operators " << l_reference_time << " us" << std::endl;
+        return quicky_test::check_expected(l_montgomery, l_reference, "bench powmod " + std::to_string(p_nb_bits) + " bits");
+    }
+
+    //-------------------------------------------------------------------------
+    bool test_modular_context()
+    {
+        bool l_ok = true;
+        std::cout << "Check modular_context" << std::endl;
+        // 2^127 - 1 is prime
+        std::string l_mersenne = "170141183460469231731687303715884105727";
+        std::string l_op1 = "98765432109876543210987654321";
+        std::string l_op2 = "123456789012345678901234567890123456789";
+        l_ok &= check_modular_context<uint8_t>("251", "1000", "65537");
+        l_ok &= check_modular_context<uint8_t>(l_mersenne, l_op1, l_op2);
+        l_ok &= check_modular_context<uint16_t>(l_mersenne, l_op2, l_op1);
+        l_ok &= check_modular_context<uint32_t>(l_mersenne, l_op1, l_op2);
+        l_ok &= check_modular_context<uint64_t>(l_mersenne, l_op1, l_op2);
+        l_ok &= check_modular_context<uint32_t>("1000000000000000000000000000057", l_op2, "3");
+        l_ok &= check_modular_context<uint64_t>("18446744073709551557", "18446744073709551556", l_op2);
+
+        // Fermat little theorem
+        ext_uint<uint64_t> l_prime = ext_uint<uint64_t>::from_string(l_mersenne);
+        modular_context<uint64_t> l_context(l_prime);
+        l_ok &= quicky_test::check_expected(l_context.powmod(ext_uint<uint64_t>::from_string(l_op1), l_prime - ext_uint<uint64_t>({1})), ext_uint<uint64_t>({1}), quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected(l_context.powmod(ext_uint<uint64_t>({2}), ext_uint<uint64_t>({127})), ext_uint<uint64_t>({1}), quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_expected(l_context.powmod(ext_uint<uint64_t>({2}), ext_uint<uint64_t>()), ext_uint<uint64_t>({1}), quicky_test::auto_message(__FILE__, __LINE__));
+
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([]{modular_context<uint8_t> l_context(ext_uint<uint8_t>({0, 1}));}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([]{modular_context<uint8_t> l_context(ext_uint<uint8_t>({1}));}, true, quicky_test::auto_message(__FILE__, __LINE__));
+        l_ok &= quicky_test::check_exception<quicky_exception::quicky_logic_exception>([]{(void)modular_context<uint16_t>(ext_uint<uint16_t>({21})).invmod(ext_uint<uint16_t>({14}));}, true, quicky_test::auto_message(__FILE__, __LINE__));
+
+        std::mt19937_64 l_generator(28);
+        for(size_t l_nb_bits: {256, 1024, 2048, 4096})
+        {
+            if(l_nb_bits > quicky_test::get_bench_size(256, 4096))
+            {
+                break;
+            }
+            l_ok &= bench_modular_context(l_nb_bits, l_generator);
+        }
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF
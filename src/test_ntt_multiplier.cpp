@@ -0,0 +1,157 @@
+/*    This file is part of quicky_utils
+      Copyright (C) 2026  Julien Thevenon ( julien_thevenon at yahoo.fr )
+
+      This program is free software: you can redistribute it and/or modify
+      it under the terms of the GNU General Public License as published by
+      the Free Software Foundation, either version 3 of the License, or
+      (at your option) any later version.
+
+      This program is distributed in the hope that it will be useful,
+      but WITHOUT ANY WARRANTY; without even the implied warranty of
+      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+      GNU General Public License for more details.
+
+      You should have received a copy of the GNU General Public License
+      along with this program.  If not, see <http://www.gnu.org/licenses/>
+*/
+
+#ifdef QUICKY_UTILS_SELF_TEST
+
+#include <random>
+#include <chrono>
+#include "ntt_multiplier.h"
+#include "bignum_thread_pool.h"
+#include "ext_uint.h"
+#include "quicky_test.h"
+#include "type_string.h"
+#include <iostream>
+
+namespace quicky_utils
+{
+    /**
+     * Compare NTT product with schoolbook one
+     * @tparam T limb type
+     * @param p_op1 first operand limbs
+     * @param p_op2 second operand limbs
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool check_ntt_product(const std::vector<T> & p_op1
+                          ,const std::vector<T> & p_op2
+                          )
+    {
+        std::vector<T> l_expected(p_op1.size() + p_op2.size());
+        limb_kernel<T>::mul(l_expected.data(), p_op1.data(), p_op1.size(), p_op2.data(), p_op2.size());
+        std::vector<T> l_result(p_op1.size() + p_op2.size());
+        ntt_multiplier<T>::mul(l_result.data(), p_op1.data(), p_op1.size(), p_op2.data(), p_op2.size());
+        std::string l_message = type_string<T>::name() + " " + std::to_string(p_op1.size()) + "x" + std::to_string(p_op2.size()) + " " + std::to_string(bignum_thread_pool::get_max_threads()) + " threads";
+        return quicky_test::check_expected(l_result == l_expected, true, "NTT product " + l_message);
+    }
+
+    /**
+     * Randomized cross check of NTT products against schoolbook products
+     * @tparam T limb type
+     * @param p_generator random generator
+     * @return true if test is successfull
+     */
+    template <typename T>
+    bool check_ntt_multiplier(std::mt19937_64 & p_generator)
+    {
+        bool l_ok = true;
+        std::uniform_int_distribution<size_t> l_size_distribution(1, 2048 / limb_kernel<T>::m_nb_bits * 8);
+        auto l_random_limbs = [&](size_t p_size)
+        {
+            std::vector<T> l_limbs(p_size);
+            for(auto & l_iter: l_limbs)
+            {
+                l_iter = (T)p_generator();
+            }
+            return l_limbs;
+        };
+        // Small grain lets small transforms be split in several tasks
+        bignum_thread_pool::set_grain(16);
+        for(unsigned int l_nb_threads: {1u, 4u})
+        {
+            bignum_thread_pool::set_max_threads(l_nb_threads);
+            for(unsigned int l_iteration = 0; l_iteration < 20; ++l_iteration)
+            {
+                l_ok &= check_ntt_product(l_random_limbs(l_size_distribution(p_generator)), l_random_limbs(l_size_distribution(p_generator)));
+            }
+            // Unbalanced operands and single limb operands
+            l_ok &= check_ntt_product(l_random_limbs(1), l_random_limbs(1));
+            l_ok &= check_ntt_product(l_random_limbs(1), l_random_limbs(300));
+            l_ok &= check_ntt_product(l_random_limbs(3), l_random_limbs(5));
+            // All bits set maximize convolution coefficients and carries
+            std::vector<T> l_max(257, (T)~(T)0);
+            l_ok &= check_ntt_product(l_max, l_max);
+            l_ok &= check_ntt_product(l_max, std::vector<T>(3, (T)~(T)0));
+            std::vector<T> l_square = l_random_limbs(100);
+            std::vector<T> l_expected(200);
+            limb_kernel<T>::mul(l_expected.data(), l_square.data(), 100, l_square.data(), 100);
+            std::vector<T> l_result(200);
+            ntt_multiplier<T>::mul(l_result.data(), l_square.data(), 100, l_square.data(), 100);
+            l_ok &= quicky_test::check_expected(l_result == l_expected, true, "NTT square " + type_string<T>::name());
+        }
+        bignum_thread_pool::set_max_threads(1);
+        bignum_thread_pool::set_grain(4096);
+
+        // ext_uint switches to NTT above threshold
+        size_t l_threshold = ntt_multiplier<T>::get_threshold();
+        ext_uint<T> l_op1 = ext_uint<T>::from_string(std::string(200, '7'));
+        ext_uint<T> l_op2 = ext_uint<T>::from_string(std::string(150, '3'));
+        ext_uint<T> l_schoolbook = l_op1 * l_op2;
+        ntt_multiplier<T>::set_threshold(0);
+        l_ok &= quicky_test::check_expected(ntt_multiplier<T>::is_applicable(l_op1.get_nb_words(), l_op2.get_nb_words()), true, "NTT applicable " + type_string<T>::name());
+        l_ok &= quicky_test::check_expected(l_op1 * l_op2, l_schoolbook, "ext_uint NTT product " + type_string<T>::name());
+        l_ok &= quicky_test::check_expected(l_op1 * ext_uint<T>({1}), l_op1, "ext_uint NTT neutral " + type_string<T>::name());
+        ntt_multiplier<T>::set_threshold(l_threshold);
+        l_ok &= quicky_test::check_expected(ntt_multiplier<T>::is_applicable(1, 1), false, "NTT small operands " + type_string<T>::name());
+        return l_ok;
+    }
+
+    /**
+     * Report time of schoolbook and NTT products of a given size
+     * @param p_nb_bits size in bits of operands
+     * @param p_generator random generator
+     */
+    void bench_ntt_multiplier(size_t p_nb_bits
+                             ,std::mt19937_64 & p_generator
+                             )
+    {
+        size_t l_size = p_nb_bits / 64;
+        std::vector<uint64_t> l_op1(l_size);
+        std::vector<uint64_t> l_op2(l_size);
+        for(size_t l_index = 0; l_index < l_size; ++l_index)
+        {
+            l_op1[l_index] = p_generator();
+            l_op2[l_index] = p_generator();
+        }
+        std::vector<uint64_t> l_result(2 * l_size);
+        auto l_time = [&](auto p_function)
+        {
+            auto l_start = std::chrono::steady_clock::now();
+            p_function();
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - l_start).count();
+        };
+        auto l_schoolbook = l_time([&]{limb_kernel<uint64_t>::mul(l_result.data(), l_op1.data(), l_size, l_op2.data(), l_size);});
+        auto l_ntt = l_time([&]{ntt_multiplier<uint64_t>::mul(l_result.data(), l_op1.data(), l_size, l_op2.data(), l_size);});
+        quicky_test::get_bench_ostream() << p_nb_bits << " bits product: schoolbook " << l_schoolbook << " us, NTT " << l_ntt << " us" << std::endl;
+    }
+
+    //-------------------------------------------------------------------------
+    bool
+    test_ntt_multiplier()
+    {
+        bool l_ok = true;
+        std::mt19937_64 l_generator(34);
+        l_ok &= check_ntt_multiplier<uint8_t>(l_generator);
+        l_ok &= check_ntt_multiplier<uint16_t>(l_generator);
+        l_ok &= check_ntt_multiplier<uint32_t>(l_generator);
+        l_ok &= check_ntt_multiplier<uint64_t>(l_generator);
+        bench_ntt_multiplier(quicky_test::get_bench_size(1 << 12, 1 << 16), l_generator);
+        bench_ntt_multiplier(quicky_test::get_bench_size(1 << 14, 1 << 20), l_generator);
+        return l_ok;
+    }
+}
+#endif // QUICKY_UTILS_SELF_TEST
+// EOF